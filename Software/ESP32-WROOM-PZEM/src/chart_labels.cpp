@@ -0,0 +1,33 @@
+#include "chart_labels.hpp"
+
+ChartLabels::ChartLabels(int16_t x, int16_t y, int16_t height)
+  : topLabel(x - 32, y + 22, 1, 5, true),   // Clear of the page number in the top left corner (x 35..47, y 2..17)
+    bottomLabel(x - 32, y + height - 10, 1, 5, true),
+    spanLabel(x - 60, y + height - 40, 1, 9)
+{
+}
+
+void ChartLabels::invalidate(uint16_t bg)
+{
+  topLabel.invalidate(bg);
+  bottomLabel.invalidate(bg);
+  spanLabel.invalidate(bg);
+}
+
+void ChartLabels::draw(Adafruit_GFX & gfx, float low, float high, uint32_t samplesShown, uint16_t color, uint16_t bg)
+{
+  char text[12];
+  snprintf(text, sizeof(text), "%.0f", high);
+  topLabel.draw(gfx, text, color, bg);
+  snprintf(text, sizeof(text), "%.0f", low);
+  bottomLabel.draw(gfx, text, color, bg);
+
+  uint32_t seconds = (uint32_t)((uint64_t)samplesShown * samplePeriod / 1000);
+  if(seconds < 120)
+    snprintf(text, sizeof(text), "%us", (unsigned)seconds);
+  else if(seconds < 120 * 60)
+    snprintf(text, sizeof(text), "%um", (unsigned)(seconds / 60));
+  else
+    snprintf(text, sizeof(text), "%.1fh", seconds / 3600.0f);
+  spanLabel.draw(gfx, text, color, bg);
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+/// The axis labels the power chart has in the band to the left of its plot - the maximum and minimum of the scale at
+/// the top and bottom, and the time span shown. Shared by the panel backend (chart_st7789.hpp) and the host one in
+/// tools/host_render.cpp, so a page rendered on the host has the same labels as on the panel.
+
+#include "text_field.hpp"
+
+class ChartLabels
+{
+public:
+  /// Plot area in screen coordinates - the labels go in the 60 pixels to its left
+  ChartLabels(int16_t x, int16_t y, int16_t height);
+
+  /// Time between samples, for the time span label
+  void setSamplePeriod(uint32_t samplePeriodMs) { samplePeriod = samplePeriodMs; }
+
+  /// Forget what was drawn - the band has been cleared to "bg"
+  void invalidate(uint16_t bg);
+
+  void draw(Adafruit_GFX & gfx, float low, float high, uint32_t samplesShown, uint16_t color, uint16_t bg);
+
+private:
+  uint32_t samplePeriod = 1000;
+
+  TextField topLabel;
+  TextField bottomLabel;
+  TextField spanLabel;
+};
@@ -0,0 +1,29 @@
+#include "chart_st7789.hpp"
+
+St7789ChartBackend::St7789ChartBackend(int16_t x, int16_t y, int16_t width, int16_t height)
+  : x(x), y(y), width(width), height(height), axisLabels(x, y, height)
+{
+}
+
+void St7789ChartBackend::begin(bool full, uint16_t)
+{
+  if(full || !attached)
+  {
+    tft->setScrollArea(scrollTop(), width, CountingST7789::frameMemoryRows - scrollTop() - width);
+    attached = true;
+  }
+}
+
+void St7789ChartBackend::labels(float low, float high, uint32_t samplesShown, uint16_t color, uint16_t bg)
+{
+  axisLabels.draw(*tft, low, high, samplesShown, color, bg);
+}
+
+void St7789ChartBackend::detach()
+{
+  if(attached)
+  {
+    tft->resetScroll();
+    attached = false;
+  }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+/// ScrollingChart backend for the ST7789 panel (see scrolling_chart.hpp). The plot area is the panel's scroll area -
+/// in the landscape rotation the panel's "vertical" runs along the screen's x axis - and the fixed area to its left
+/// holds the axis labels.
+
+#include "chart_labels.hpp"
+#include "counting_st7789.hpp"
+
+class St7789ChartBackend
+{
+public:
+  /// Plot area in screen coordinates - it must reach the right hand edge of the screen and leave 60 pixels on the
+  /// left for the labels
+  St7789ChartBackend(int16_t x, int16_t y, int16_t width, int16_t height);
+
+  void setDisplay(CountingST7789 * display) { tft = display; }
+
+  /// Time between samples, for the time span label
+  void setSamplePeriod(uint32_t samplePeriodMs) { axisLabels.setSamplePeriod(samplePeriodMs); }
+
+  /// Put the panel back to unscrolled - must be called before another page is drawn
+  void detach();
+
+  /// The label band has been cleared to "bg" (a full redraw of the page). Not done by begin(): a rezoom redraws the
+  /// plot in full but leaves the band - and the page's widgets in it - alone, so the labels repaint the cells that change
+  void invalidateLabels(uint16_t bg) { axisLabels.invalidate(bg); }
+
+  int16_t left() const { return x; }
+
+  // Called by ScrollingChart::draw()
+  void begin(bool full, uint16_t bg);
+  void labels(float low, float high, uint32_t samplesShown, uint16_t color, uint16_t bg);
+  void scrollTo(int16_t slot) { tft->setScrollStart(scrollTop() + slot); }
+
+  void column(int16_t slot, const uint16_t * pixels)
+  {
+    // One address window and one burst of pixels per column
+    tft->startWrite();
+    tft->setAddrWindow(x + slot, y, 1, height);
+    tft->writePixels(const_cast<uint16_t*>(pixels), height);
+    tft->endWrite();
+    tft->countPixels(height);
+  }
+
+private:
+  CountingST7789 * tft = NULL;
+  int16_t x;
+  int16_t y;
+  int16_t width;
+  int16_t height;
+  bool attached = false;  // Scroll area programmed into the panel
+
+  ChartLabels axisLabels;
+
+  /// Frame memory rows: [fixed labels][scroll area == plot][fixed, off the right hand edge]
+  uint16_t scrollTop() const { return tft->xOffset() + x; }
+};
@@ -0,0 +1,393 @@
+#define ARDUINOJSON_ENABLE_COMMENTS 1
+#include <ArduinoJson.h>
+#include <Preferences.h>
+
+#include <atomic>
+
+#include "device_settings.hpp"
+
+/// settings.json is linked into the firmware via COMPONENT_EMBED_TXTFILES (see platformio.ini)
+extern const uint8_t settings_json_start[] asm("_binary_src_settings_json_start");
+extern const uint8_t settings_json_end[]   asm("_binary_src_settings_json_end");
+
+namespace
+{
+  const char * nvsNamespace = "settings";
+
+  /// Hash of the sources the settings were loaded from at boot - runtime updates are cached under the same hash
+  /// so they survive a reboot, but a firmware with a different settings.json takes precedence
+  uint32_t loadedSourceHash = 0;
+
+  /// FNV-1a - cheap enough to run over the embedded file on every boot (far cheaper than parsing it)
+  uint32_t fnv1a(const uint8_t * data, size_t len, uint32_t hash = 2166136261u)
+  {
+    for(size_t i = 0; i < len; ++i)
+    {
+      hash ^= data[i];
+      hash *= 16777619u;
+    }
+    return hash;
+  }
+
+  /// Identifies the inputs the cached blob was built from: the embedded JSON, the schema and the compiled in defaults
+  uint32_t settingsSourceHash(const DeviceSettings & defaults)
+  {
+    const uint32_t version = DEVICE_SETTINGS_VERSION;
+    const uint32_t size = sizeof(DeviceSettings);
+
+    uint32_t hash = fnv1a(settings_json_start, settings_json_end - settings_json_start);
+    hash = fnv1a((const uint8_t*)&version, sizeof(version), hash);
+    hash = fnv1a((const uint8_t*)&size, sizeof(size), hash);
+
+    // Field by field rather than the whole struct - padding bytes are not guaranteed to be initialised
+#define DEVICE_SETTINGS_HASH(name, ...) hash = fnv1a((const uint8_t*)&defaults.name, sizeof(defaults.name), hash);
+    DEVICE_SETTINGS_STRINGS(DEVICE_SETTINGS_HASH)
+    DEVICE_SETTINGS_NUMBERS(DEVICE_SETTINGS_HASH)
+#undef DEVICE_SETTINGS_HASH
+
+    return hash;
+  }
+
+  /// Allocator for the JsonDocument that keeps track of the high water mark of heap it has used
+  class PeakTrackingAllocator : public ArduinoJson::Allocator
+  {
+  public:
+    size_t current = 0;
+    size_t peak = 0;
+
+    void* allocate(size_t size) override
+    {
+      size_t * p = (size_t*)malloc(size + sizeof(size_t));
+      if(!p)
+        return nullptr;
+
+      *p = size;
+      track(size);
+      return p + 1;
+    }
+
+    void deallocate(void* ptr) override
+    {
+      if(!ptr)
+        return;
+
+      size_t * p = ((size_t*)ptr) - 1;
+      current -= *p;
+      free(p);
+    }
+
+    void* reallocate(void* ptr, size_t new_size) override
+    {
+      if(!ptr)
+        return allocate(new_size);
+
+      size_t * p = ((size_t*)ptr) - 1;
+      size_t old_size = *p;
+      p = (size_t*)realloc(p, new_size + sizeof(size_t));
+      if(!p)
+        return nullptr;
+
+      *p = new_size;
+      current -= old_size;
+      track(new_size);
+      return p + 1;
+    }
+
+  private:
+    void track(size_t size)
+    {
+      current += size;
+      if(current > peak)
+        peak = current;
+    }
+  };
+
+  /// Copy a JSON string into a fixed size field.
+  /// Lenient (boot): empty / missing values leave the default in place and long values are truncated.
+  /// Strict (runtime update): any value that is present is applied, but it must be a string that fits.
+  bool copySetting(char * field, size_t size, JsonVariantConst value, const char * name, bool strict, String & error)
+  {
+    if(value.isNull())
+      return true;
+
+    if(strict && !value.is<const char*>())
+    {
+      error = String(name) + " must be a string";
+      return false;
+    }
+
+    const char * str = value | "";
+    if(!strict && !str[0])
+      return true;
+
+    if(strlen(str) >= size)
+    {
+      if(strict)
+      {
+        error = String(name) + " is longer than " + String((unsigned)(size - 1)) + " chars";
+        return false;
+      }
+      Serial.printf("WARNING: setting %s truncated to %u chars\n", name, (unsigned)(size - 1));
+    }
+
+    strlcpy(field, str, size);
+    return true;
+  }
+
+  /// Copy a JSON number into a field, checking it against the schema range
+  template<typename T>
+  bool copySetting(T & field, T min, T max, JsonVariantConst value, const char * name, bool strict, String & error)
+  {
+    if(value.isNull())
+      return true;
+
+    if(!value.is<T>() || value.as<T>() < min || value.as<T>() > max)
+    {
+      error = String(name) + " must be a number between " + String(min) + " and " + String(max);
+      if(strict)
+        return false;
+
+      Serial.printf("WARNING: setting %s ignored - %s\n", name, error.c_str());
+      return true;
+    }
+
+    field = value.as<T>();
+    return true;
+  }
+
+  bool isKnownSetting(const char * key)
+  {
+#define DEVICE_SETTINGS_NAME(name, ...) #name,
+    static const char * const names[] = { DEVICE_SETTINGS_STRINGS(DEVICE_SETTINGS_NAME) DEVICE_SETTINGS_NUMBERS(DEVICE_SETTINGS_NAME) };
+#undef DEVICE_SETTINGS_NAME
+
+    for(const char * name : names)
+    {
+      if(strcmp(name, key) == 0)
+        return true;
+    }
+    return false;
+  }
+
+  bool parseSettingsObject(JsonObjectConst root, DeviceSettings & settings, bool strict, String & error)
+  {
+    if(root.isNull())
+    {
+      error = "settings must be a JSON object";
+      return false;
+    }
+
+    if(strict)
+    {
+      for(JsonPairConst kv : root)
+      {
+        if(!isKnownSetting(kv.key().c_str()))
+        {
+          error = String("unknown setting ") + kv.key().c_str();
+          return false;
+        }
+      }
+    }
+
+#define DEVICE_SETTINGS_PARSE(name, size, def, subsystem) \
+    if(!copySetting(settings.name, size, root[#name], #name, strict, error)) return false;
+    DEVICE_SETTINGS_STRINGS(DEVICE_SETTINGS_PARSE)
+#undef DEVICE_SETTINGS_PARSE
+
+#define DEVICE_SETTINGS_PARSE(name, type, def, min, max, subsystem) \
+    if(!copySetting<type>(settings.name, min, max, root[#name], #name, strict, error)) return false;
+    DEVICE_SETTINGS_NUMBERS(DEVICE_SETTINGS_PARSE)
+#undef DEVICE_SETTINGS_PARSE
+
+    return true;
+  }
+
+  bool parseSettingsJson(DeviceSettings & settings, SettingsLoadStats & stats)
+  {
+    PeakTrackingAllocator allocator;
+    bool ok = false;
+
+    {
+      JsonDocument doc(&allocator);
+      DeserializationError err = deserializeJson(doc, (const char*)settings_json_start, settings_json_end - settings_json_start);
+
+      if(err)
+      {
+        Serial.printf("ERROR: settings.json failed to parse (%s)\n", err.c_str());
+      }
+      else
+      {
+        String error;
+        ok = parseSettingsObject(doc.as<JsonObjectConst>(), settings, false, error);
+
+        if(!ok)
+          Serial.printf("ERROR: settings.json %s\n", error.c_str());
+      }
+    }
+
+    stats.peakHeapBytes = allocator.peak;
+    return ok;
+  }
+}
+
+bool LoadDeviceSettings(DeviceSettings & settings, SettingsLoadStats & stats)
+{
+  unsigned long start = micros();
+
+  const uint32_t hash = settingsSourceHash(settings);
+  loadedSourceHash = hash;
+
+  Preferences prefs;
+  prefs.begin(nvsNamespace, false);
+
+  stats.fromCache = prefs.getUInt("hash", 0) == hash
+                    && prefs.getBytesLength("blob") == sizeof(DeviceSettings)
+                    && prefs.getBytes("blob", &settings, sizeof(DeviceSettings)) == sizeof(DeviceSettings);
+
+  bool ok = stats.fromCache;
+
+  if(!ok)
+  {
+    ok = parseSettingsJson(settings, stats);
+
+    if(ok)
+    {
+      // Only cache a good parse - a broken settings.json gets reported (and re-parsed) every boot until fixed
+      prefs.putBytes("blob", &settings, sizeof(DeviceSettings));
+      prefs.putUInt("hash", hash);
+    }
+  }
+
+  prefs.end();
+
+  stats.loadMicros = micros() - start;
+
+  Serial.printf("Settings loaded from %s in %u us, peak heap %u bytes\n", stats.fromCache ? "NVS cache" : "settings.json",
+                stats.loadMicros, stats.peakHeapBytes);
+  return ok;
+}
+
+bool ApplyDeviceSettingsJson(DeviceSettings & settings, const char * json, size_t length, String & error)
+{
+  JsonDocument doc;
+  DeserializationError err = deserializeJson(doc, json, length);
+
+  if(err)
+  {
+    error = String("invalid JSON: ") + err.c_str();
+    return false;
+  }
+
+  // Parse into a scratch copy so that a rejected update leaves "settings" untouched
+  DeviceSettings updated = settings;
+
+  if(!parseSettingsObject(doc.as<JsonObjectConst>(), updated, true, error))
+    return false;
+
+  settings = updated;
+  return true;
+}
+
+bool SaveDeviceSettings(const DeviceSettings & settings)
+{
+  Preferences prefs;
+  prefs.begin(nvsNamespace, false);
+
+  bool ok = prefs.putBytes("blob", &settings, sizeof(DeviceSettings)) == sizeof(DeviceSettings)
+            && prefs.putUInt("hash", loadedSourceHash) == sizeof(uint32_t);
+
+  prefs.end();
+  return ok;
+}
+
+uint32_t DiffDeviceSettings(const DeviceSettings & a, const DeviceSettings & b)
+{
+  uint32_t changed = SETTINGS_NONE;
+
+#define DEVICE_SETTINGS_DIFF(name, size, def, subsystem) \
+  if(strcmp(a.name, b.name) != 0) changed |= subsystem;
+  DEVICE_SETTINGS_STRINGS(DEVICE_SETTINGS_DIFF)
+#undef DEVICE_SETTINGS_DIFF
+
+#define DEVICE_SETTINGS_DIFF(name, type, def, min, max, subsystem) \
+  if(a.name != b.name) changed |= subsystem;
+  DEVICE_SETTINGS_NUMBERS(DEVICE_SETTINGS_DIFF)
+#undef DEVICE_SETTINGS_DIFF
+
+  return changed;
+}
+
+String DeviceSettingsToJson(const DeviceSettings & settings)
+{
+  JsonDocument doc;
+
+#define DEVICE_SETTINGS_JSON(name, size, def, subsystem) \
+  doc[#name] = strstr(#name, "password") ? "**" : settings.name;
+  DEVICE_SETTINGS_STRINGS(DEVICE_SETTINGS_JSON)
+#undef DEVICE_SETTINGS_JSON
+
+#define DEVICE_SETTINGS_JSON(name, type, def, min, max, subsystem) doc[#name] = settings.name;
+  DEVICE_SETTINGS_NUMBERS(DEVICE_SETTINGS_JSON)
+#undef DEVICE_SETTINGS_JSON
+
+  String json;
+  serializeJson(doc, json);
+  return json;
+}
+
+
+/// RCU style publication of the live settings
+namespace
+{
+  const DeviceSettings defaultSettings; // Live until the first PublishDeviceSettings() call at boot
+
+  std::atomic<const DeviceSettings*> liveSettings(&defaultSettings);
+
+  /// The settings replaced by the last publish - freed once every reader has moved past a quiescent state
+  std::atomic<const DeviceSettings*> retiredSettings(nullptr);
+
+  std::atomic<uint32_t> quiescentCount[SETTINGS_READER_COUNT];
+  uint32_t retiredAtCount[SETTINGS_READER_COUNT];
+}
+
+const DeviceSettings & CurrentSettings()
+{
+  return *liveSettings.load(std::memory_order_acquire);
+}
+
+bool PublishDeviceSettings(const DeviceSettings * settings)
+{
+  if(retiredSettings.load(std::memory_order_acquire) != nullptr)
+    return false;
+
+  const DeviceSettings * old = liveSettings.exchange(settings, std::memory_order_acq_rel);
+
+  if(old == &defaultSettings)
+    return true;
+
+  // Snapshot where every reader is now - each must report at least one more quiescent state before "old" can go
+  for(int reader = 0; reader < SETTINGS_READER_COUNT; ++reader)
+    retiredAtCount[reader] = quiescentCount[reader].load(std::memory_order_acquire);
+
+  retiredSettings.store(old, std::memory_order_release);
+  return true;
+}
+
+void SettingsQuiescentState(SettingsReader reader)
+{
+  quiescentCount[reader].fetch_add(1, std::memory_order_acq_rel);
+
+  const DeviceSettings * old = retiredSettings.load(std::memory_order_acquire);
+  if(!old)
+    return;
+
+  for(int r = 0; r < SETTINGS_READER_COUNT; ++r)
+  {
+    if(quiescentCount[r].load(std::memory_order_acquire) == retiredAtCount[r])
+      return;
+  }
+
+  // Only one reader gets to free it
+  if(retiredSettings.compare_exchange_strong(old, nullptr, std::memory_order_acq_rel))
+    delete old;
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+/// Device settings for the PZEM monitor.
+///
+/// The schema is defined ONCE in the X-macros below - they generate the (fixed size, POD) settings struct, the
+/// JSON parsing / validation code and the "what changed" comparison. The parsed struct is cached as a binary blob
+/// in NVS so that later boots do not need to parse settings.json at all - the JSON is only parsed again when the
+/// blob is missing or the embedded file (or the schema / compiled in defaults) changes.
+///
+/// At runtime the live settings are an immutable object swapped RCU style: readers call CurrentSettings() (a
+/// single atomic load, no locks) and report SettingsQuiescentState() once per loop when they hold no references.
+/// The previous object is freed once every reader has passed a quiescent state.
+
+#include <Arduino.h>
+
+/// Which part of the firmware needs restarting when a setting changes
+enum SettingsSubsystem : uint32_t
+{
+  SETTINGS_NONE     = 0,
+  SETTINGS_WIFI     = 1 << 0,
+  SETTINGS_MQTT     = 1 << 1,
+  SETTINGS_OTA      = 1 << 2,
+  SETTINGS_SSDP     = 1 << 3,   // Only applied at boot - SSDP cannot be re-registered with the web server
+  SETTINGS_SAMPLING = 1 << 4,   // Picked up on the next loop() pass - no restart needed
+  SETTINGS_PUBLISH  = 1 << 5,   // Picked up on the next MQTT publish - no restart needed
+  SETTINGS_POWER    = 1 << 6,   // Power management mode - reconfigured on the fly
+};
+
+/// X(name, size in bytes incl. terminator, default value, subsystem)
+#define DEVICE_SETTINGS_STRINGS(X)                                        \
+  X(ssid,            33, "",                    SETTINGS_WIFI)            \
+  X(password,        65, "",                    SETTINGS_WIFI)            \
+  X(ota_user,        33, "",                    SETTINGS_OTA)             \
+  X(ota_password,    65, "",                    SETTINGS_OTA)             \
+  X(ssdp_name,       33, "ESP32-PZEM",          SETTINGS_SSDP)            \
+  X(ssdp_modelname,  49, "",                    SETTINGS_SSDP)            \
+  X(mqtt_server,     65, "",                    SETTINGS_MQTT)            \
+  X(mqtt_user,       33, "iot",                 SETTINGS_MQTT)            \
+  X(mqtt_password,   65, "iot1",                SETTINGS_MQTT)            \
+  X(mqtt_topicOUT,   49, "/esp32/Electricity/", SETTINGS_PUBLISH)         \
+  X(mqtt_topicName,  33, "house",               SETTINGS_PUBLISH)
+
+/// X(name, type, default value, min, max, subsystem)
+#define DEVICE_SETTINGS_NUMBERS(X)                                        \
+  X(mqtt_port,            uint16_t, 1883,  1,    65535,    SETTINGS_MQTT)      \
+  X(sample_period_ms,     uint32_t, 1000,  200,  60000,    SETTINGS_SAMPLING)  \
+  X(deadband_power_w,     float,    0.0f,  0.0f, 10000.0f, SETTINGS_PUBLISH)   \
+  X(deadband_voltage_v,   float,    0.0f,  0.0f, 50.0f,    SETTINGS_PUBLISH)   \
+  X(publish_heartbeat_ms, uint32_t, 60000, 1000, 3600000,  SETTINGS_PUBLISH)   \
+  X(metrics_period_ms,    uint32_t, 60000, 5000, 3600000,  SETTINGS_PUBLISH)   \
+  X(power_save,           uint8_t,  0,     0,    2,        SETTINGS_POWER)
+
+/// Bump this if the meaning of a field changes without its size changing - it forces the NVS cache to be rebuilt
+#define DEVICE_SETTINGS_VERSION 2
+
+struct DeviceSettings
+{
+#define DEVICE_SETTINGS_FIELD(name, size, def, subsystem) char name[size] = def;
+  DEVICE_SETTINGS_STRINGS(DEVICE_SETTINGS_FIELD)
+#undef DEVICE_SETTINGS_FIELD
+
+#define DEVICE_SETTINGS_FIELD(name, type, def, min, max, subsystem) type name = def;
+  DEVICE_SETTINGS_NUMBERS(DEVICE_SETTINGS_FIELD)
+#undef DEVICE_SETTINGS_FIELD
+};
+
+/// How the settings were obtained at boot - reported over serial (and later as a device metric)
+struct SettingsLoadStats
+{
+  bool fromCache = false;     // true if the NVS blob was used, false if settings.json was parsed
+  uint32_t loadMicros = 0;    // Time taken to produce the settings struct
+  uint32_t peakHeapBytes = 0; // Peak heap used by the JSON document while parsing (0 when loaded from the cache)
+};
+
+/// Fill "settings" from the NVS cache, or from the embedded settings.json if the cache is missing / stale.
+/// "settings" should hold the compiled in defaults on entry - JSON values override them, empty JSON strings do not.
+/// Returns false only if neither source could be used (in which case the defaults are left in place)
+bool LoadDeviceSettings(DeviceSettings & settings, SettingsLoadStats & stats);
+
+/// Apply a (partial) JSON settings document on top of "settings". Unlike the boot time load this is strict - unknown
+/// keys, wrong types, out of range numbers and over long strings are all rejected with a message in "error"
+bool ApplyDeviceSettingsJson(DeviceSettings & settings, const char * json, size_t length, String & error);
+
+/// Write "settings" to the NVS cache so that it survives a reboot (until settings.json itself is changed)
+bool SaveDeviceSettings(const DeviceSettings & settings);
+
+/// Bitmask of SettingsSubsystem values for the fields that differ between a and b
+uint32_t DiffDeviceSettings(const DeviceSettings & a, const DeviceSettings & b);
+
+/// Serialise the settings as JSON - secrets (passwords) are masked
+String DeviceSettingsToJson(const DeviceSettings & settings);
+
+
+/// Tasks that read CurrentSettings() - each must call SettingsQuiescentState() regularly
+enum SettingsReader
+{
+  SETTINGS_READER_CORE1,    // loop() - acquisition and display
+  SETTINGS_READER_NETWORK,  // NetworkThreadCode()
+  SETTINGS_READER_COUNT
+};
+
+/// The live settings. Do not hold on to the reference past the caller's next SettingsQuiescentState()
+const DeviceSettings & CurrentSettings();
+
+/// Make "settings" (heap allocated, never modified afterwards) the live settings.
+/// Returns false if the previously replaced settings have not been reclaimed yet - try again later
+bool PublishDeviceSettings(const DeviceSettings * settings);
+
+/// Called by each reader at a point where it holds no references to the settings (e.g. the top of its loop)
+void SettingsQuiescentState(SettingsReader reader);
@@ -0,0 +1,128 @@
+#include "digit_font.hpp"
+#include "digit_font_data.hpp"
+
+#ifdef DIGIT_FONT_BENCHMARK
+#include <esp_timer.h>
+#endif
+
+namespace
+{
+  Adafruit_GFX * display = NULL;
+  DigitFontBlitFn blit = NULL;
+  uint16_t cell[DIGIT_FONT_WIDTH * DIGIT_FONT_HEIGHT];
+
+  static_assert(DigitFontData::width == DIGIT_FONT_WIDTH && DigitFontData::height == DIGIT_FONT_HEIGHT,
+                "digit_font_data.hpp is out of date - run tools/make_digit_font.py");
+
+  const DigitFontData::Glyph * findGlyph(char c)
+  {
+    for(const DigitFontData::Glyph & glyph : DigitFontData::glyphs)
+    {
+      if(glyph.character == c)
+        return &glyph;
+    }
+    return NULL;
+  }
+
+  /// Mix two RGB565 colours - "level" out of 3 of "color" over "bg"
+  uint16_t blend(uint16_t color, uint16_t bg, uint8_t level)
+  {
+    uint16_t r = (((color >> 11) & 0x1f) * level + ((bg >> 11) & 0x1f) * (3 - level)) / 3;
+    uint16_t g = (((color >> 5) & 0x3f) * level + ((bg >> 5) & 0x3f) * (3 - level)) / 3;
+    uint16_t b = ((color & 0x1f) * level + (bg & 0x1f) * (3 - level)) / 3;
+    return (r << 11) | (g << 5) | b;
+  }
+
+  /// Expand a glyph's runs into "cell"
+  void decode(const DigitFontData::Glyph & glyph, uint16_t color, uint16_t bg)
+  {
+    const uint16_t palette[4] = {bg, blend(color, bg, 1), blend(color, bg, 2), color};
+
+    uint16_t * pixel = cell;
+    uint16_t * end = cell + DIGIT_FONT_WIDTH * DIGIT_FONT_HEIGHT;
+    for(uint16_t i = 0; i < glyph.length; ++i)
+    {
+      uint8_t run = pgm_read_byte(&DigitFontData::runs[glyph.offset + i]);
+      uint16_t value = palette[run >> 6];
+      for(uint8_t count = (run & 0x3f) + 1; count > 0 && pixel < end; --count)
+        *pixel++ = value;
+    }
+
+    while(pixel < end)
+      *pixel++ = bg;
+  }
+}
+
+void DigitFontBegin(Adafruit_GFX * gfx, DigitFontBlitFn blitFn)
+{
+  display = gfx;
+  blit = blitFn;
+}
+
+bool DigitFontHasGlyph(char c)
+{
+  return findGlyph(c) != NULL;
+}
+
+bool DigitFontDrawChar(Adafruit_GFX & gfx, int16_t x, int16_t y, char c, uint16_t color, uint16_t bg)
+{
+  const DigitFontData::Glyph * glyph = findGlyph(c);
+  if(glyph == NULL)
+    return false;
+
+  decode(*glyph, color, bg);
+
+  if(&gfx == display && blit)
+  {
+    blit(x, y, DIGIT_FONT_WIDTH, DIGIT_FONT_HEIGHT, cell);
+    return true;
+  }
+
+  gfx.startWrite();
+  const uint16_t * pixel = cell;
+  for(int16_t row = 0; row < DIGIT_FONT_HEIGHT; ++row)
+  {
+    for(int16_t column = 0; column < DIGIT_FONT_WIDTH; ++column)
+      gfx.writePixel(x + column, y + row, *pixel++);
+  }
+  gfx.endWrite();
+  return true;
+}
+
+void DigitFontDrawText(Adafruit_GFX & gfx, int16_t x, int16_t y, const char * text, uint16_t color, uint16_t bg)
+{
+  for(; *text; ++text, x += DIGIT_FONT_WIDTH)
+  {
+    if(!DigitFontDrawChar(gfx, x, y, *text, color, bg))
+      gfx.drawChar(x, y, *text, color, bg, 3);
+  }
+}
+
+#ifdef DIGIT_FONT_BENCHMARK
+void DigitFontBenchmark(CountingST7789 & tft)
+{
+  const int repeats = 5;
+  const char digits[] = "0123456789";
+  const int count = repeats * (sizeof(digits) - 1);
+
+  for(int pass = 0; pass < 2; ++pass)
+  {
+    tft.resetCounters();
+    int64_t start = esp_timer_get_time();
+
+    for(int i = 0; i < count; ++i)
+    {
+      int16_t x = (i % 10) * DIGIT_FONT_WIDTH;
+      if(pass == 0)
+        DigitFontDrawChar(tft, x, 0, digits[i % 10], ST77XX_WHITE, ST77XX_BLACK);
+      else
+        tft.drawChar(x, 0, digits[i % 10], ST77XX_WHITE, ST77XX_BLACK, 3);
+    }
+
+    uint32_t micros = esp_timer_get_time() - start;
+    Serial.printf("Digit font: %s %u us, %u SPI bytes per digit\n", pass == 0 ? "sprite" : "setTextSize(3)",
+                  (unsigned)(micros / count), (unsigned)(tft.spiBytes() / count));
+  }
+  tft.resetCounters();
+}
+#endif
@@ -0,0 +1,36 @@
+#pragma once
+
+/// Large anti-aliased digits for the readings, as pre-rendered sprites instead of the 6x8 font scaled up.
+///
+/// A scaled Adafruit glyph is a fillRect (address window + pixels) per font pixel; a sprite is decoded from the run
+/// length encoded data in flash (digit_font_data.hpp, generated by tools/make_digit_font.py) into one 18x24 cell and
+/// sent with a single address window. The cell is the same size as the 6x8 font at setTextSize(3), so the two can be
+/// mixed in one line - characters without a sprite fall back to drawChar().
+
+#include <Adafruit_GFX.h>
+
+const uint8_t DIGIT_FONT_WIDTH = 18;
+const uint8_t DIGIT_FONT_HEIGHT = 24;
+
+/// Sends a w x h block of pixels, row by row, to the display in one burst
+typedef void (*DigitFontBlitFn)(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t * pixels);
+
+/// Cells drawn to "display" (the panel) are sent with "blit" - drawing to any other Adafruit_GFX (the strip canvas, a
+/// host framebuffer) goes through writePixel(), which is fine for a RAM canvas
+void DigitFontBegin(Adafruit_GFX * display, DigitFontBlitFn blit);
+
+bool DigitFontHasGlyph(char c);
+
+/// Draw one cell at x,y (top left). Returns false, drawing nothing, if c has no sprite
+bool DigitFontDrawChar(Adafruit_GFX & gfx, int16_t x, int16_t y, char c, uint16_t color, uint16_t bg);
+
+/// Draw a run of text one cell per character, using drawChar() at size 3 for characters without a sprite
+void DigitFontDrawText(Adafruit_GFX & gfx, int16_t x, int16_t y, const char * text, uint16_t color, uint16_t bg);
+
+#ifdef DIGIT_FONT_BENCHMARK
+#include "counting_st7789.hpp"
+
+/// Time drawing digits to the panel as sprites and with setTextSize(3) drawChar() - printed to Serial. A bench build
+/// only (build_flags = -DDIGIT_FONT_BENCHMARK): it draws over the top of the screen at boot
+void DigitFontBenchmark(CountingST7789 & tft);
+#endif
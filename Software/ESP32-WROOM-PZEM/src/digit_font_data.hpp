@@ -0,0 +1,169 @@
+#pragma once
+
+/// Generated by tools/make_digit_font.py - do not edit by hand.
+/// 20 glyphs, 1944 bytes of 2bpp run length encoded sprites (see the script for the encoding)
+
+#include <Arduino.h>
+
+namespace DigitFontData
+{
+  const uint8_t width = 18;
+  const uint8_t height = 24;
+
+  struct Glyph
+  {
+    char character;
+    uint16_t offset;
+    uint16_t length;
+  };
+
+  const Glyph glyphs[] =
+  {
+    { ' ', 0, 7 },
+    { '-', 7, 14 },
+    { '.', 21, 14 },
+    { '0', 35, 137 },
+    { '1', 172, 88 },
+    { '2', 260, 103 },
+    { '3', 363, 121 },
+    { '4', 484, 105 },
+    { '5', 589, 104 },
+    { '6', 693, 118 },
+    { '7', 811, 71 },
+    { '8', 882, 143 },
+    { '9', 1025, 118 },
+    { 'A', 1143, 109 },
+    { 'F', 1252, 84 },
+    { 'H', 1336, 157 },
+    { 'P', 1493, 114 },
+    { 'V', 1607, 117 },
+    { 'W', 1724, 163 },
+    { 'z', 1887, 57 },
+  };
+
+  const uint8_t runs[] PROGMEM =
+  {
+    0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x2f, 0x3f, 0x3f, 0x3f, 0x0a, 0x47, 0x08, 0xc9, 0x07, 0xc9,
+    0x08, 0x47, 0x3f, 0x3f, 0x26, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x1d, 0x81, 0x0e, 0x40, 0xc1, 0x40,
+    0x0e, 0x81, 0x2b, 0x18, 0x40, 0x81, 0x40, 0x0c, 0x80, 0xc3, 0x80, 0x0a, 0x80, 0xc5, 0x80, 0x08,
+    0x80, 0xc1, 0x80, 0x01, 0x80, 0xc1, 0x80, 0x07, 0xc1, 0x80, 0x03, 0x80, 0xc1, 0x06, 0x40, 0xc1,
+    0x40, 0x03, 0x40, 0xc1, 0x40, 0x05, 0x80, 0xc1, 0x05, 0xc1, 0x80, 0x05, 0xc1, 0x80, 0x05, 0x80,
+    0xc1, 0x05, 0xc1, 0x80, 0x05, 0x80, 0xc1, 0x04, 0x40, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x40, 0x03,
+    0x40, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x40, 0x03, 0x40, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x40, 0x03,
+    0x40, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x40, 0x04, 0xc1, 0x80, 0x05, 0x80, 0xc1, 0x05, 0xc1, 0x80,
+    0x05, 0x80, 0xc1, 0x05, 0x80, 0xc1, 0x05, 0xc1, 0x80, 0x05, 0x40, 0xc1, 0x40, 0x03, 0x40, 0xc1,
+    0x40, 0x06, 0xc1, 0x80, 0x03, 0x80, 0xc1, 0x07, 0x80, 0xc1, 0x80, 0x01, 0x80, 0xc1, 0x80, 0x08,
+    0x80, 0xc5, 0x80, 0x0a, 0x80, 0xc3, 0x80, 0x0c, 0x40, 0x81, 0x40, 0x18, 0x19, 0x40, 0xc1, 0x0d,
+    0x40, 0xc2, 0x40, 0x0b, 0x40, 0xc3, 0x40, 0x0a, 0x40, 0xc4, 0x40, 0x0a, 0xc2, 0x80, 0xc1, 0x40,
+    0x0a, 0xc1, 0x41, 0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1,
+    0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1,
+    0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1,
+    0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1,
+    0x40, 0x0e, 0xc1, 0x18, 0x07, 0x41, 0x0c, 0x40, 0x80, 0xc3, 0x80, 0x40, 0x08, 0x40, 0xc7, 0x40,
+    0x06, 0x40, 0xc2, 0x80, 0x41, 0x80, 0xc2, 0x40, 0x05, 0x80, 0xc1, 0x40, 0x03, 0x40, 0xc1, 0x80,
+    0x05, 0xc1, 0x80, 0x05, 0x80, 0xc1, 0x04, 0x40, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x40, 0x04, 0xc1,
+    0x06, 0x40, 0xc1, 0x40, 0x0d, 0x80, 0xc1, 0x0d, 0x40, 0xc1, 0x80, 0x0d, 0xc2, 0x40, 0x0c, 0x80,
+    0xc1, 0x40, 0x0c, 0x80, 0xc1, 0x80, 0x0c, 0x40, 0xc1, 0x80, 0x0d, 0xc2, 0x40, 0x0c, 0x80, 0xc1,
+    0x40, 0x0c, 0x40, 0xc1, 0x80, 0x0c, 0x40, 0xc2, 0x0d, 0xc2, 0x40, 0x0c, 0x80, 0xc1, 0x40, 0x0c,
+    0x40, 0xc1, 0x80, 0x46, 0x06, 0xcb, 0x05, 0xcb, 0x06, 0x49, 0x03, 0x07, 0x41, 0x0c, 0x40, 0x80,
+    0xc3, 0x80, 0x40, 0x08, 0x40, 0xc7, 0x40, 0x06, 0x40, 0xc2, 0x80, 0x41, 0x80, 0xc2, 0x40, 0x05,
+    0x80, 0xc1, 0x40, 0x03, 0x40, 0xc1, 0x80, 0x05, 0xc1, 0x80, 0x05, 0x80, 0xc1, 0x05, 0x40, 0x80,
+    0x06, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x80, 0xc1, 0x0d, 0x40, 0xc1, 0x80, 0x0b,
+    0x40, 0x80, 0xc2, 0x40, 0x0a, 0xc4, 0x40, 0x0b, 0xc4, 0x40, 0x0c, 0x40, 0x80, 0xc2, 0x40, 0x0d,
+    0x40, 0xc1, 0x80, 0x0e, 0x80, 0xc1, 0x0e, 0x40, 0xc1, 0x40, 0x04, 0x40, 0x80, 0x06, 0x40, 0xc1,
+    0x40, 0x04, 0xc1, 0x80, 0x05, 0x80, 0xc1, 0x05, 0x80, 0xc1, 0x40, 0x03, 0x40, 0xc1, 0x80, 0x05,
+    0x40, 0xc2, 0x80, 0x41, 0x80, 0xc2, 0x40, 0x06, 0x40, 0xc7, 0x40, 0x08, 0x40, 0x80, 0xc3, 0x80,
+    0x40, 0x0c, 0x41, 0x07, 0x1b, 0x40, 0xc1, 0x0e, 0x80, 0xc1, 0x40, 0x0c, 0x40, 0xc2, 0x40, 0x0c,
+    0xc3, 0x40, 0x0b, 0x80, 0xc3, 0x40, 0x0a, 0x40, 0xc1, 0x80, 0xc1, 0x40, 0x0a, 0xc2, 0x40, 0xc1,
+    0x40, 0x09, 0x80, 0xc1, 0x41, 0xc1, 0x40, 0x08, 0x40, 0xc1, 0x80, 0x00, 0x40, 0xc1, 0x40, 0x08,
+    0xc2, 0x01, 0x40, 0xc1, 0x40, 0x07, 0x80, 0xc1, 0x40, 0x01, 0x40, 0xc1, 0x40, 0x06, 0x40, 0xc1,
+    0x80, 0x02, 0x40, 0xc1, 0x40, 0x06, 0xc2, 0x03, 0x40, 0xc1, 0x40, 0x05, 0x80, 0xc1, 0x80, 0x44,
+    0xc1, 0x41, 0x04, 0xcd, 0x03, 0xcd, 0x04, 0x47, 0xc1, 0x41, 0x0c, 0x40, 0xc1, 0x40, 0x0d, 0x40,
+    0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0e, 0xc1, 0x16, 0x04, 0x48, 0x07,
+    0xca, 0x05, 0x40, 0xca, 0x05, 0x80, 0xc1, 0x47, 0x06, 0x80, 0xc1, 0x0e, 0x80, 0xc1, 0x0e, 0x80,
+    0xc0, 0x80, 0x0e, 0xc1, 0x80, 0x0e, 0xc1, 0x80, 0x01, 0x41, 0x0a, 0xc1, 0x81, 0xc3, 0x80, 0x07,
+    0x40, 0xc9, 0x40, 0x06, 0xc3, 0x80, 0x41, 0x80, 0xc1, 0x80, 0x07, 0x42, 0x03, 0x80, 0xc1, 0x80,
+    0x0e, 0xc2, 0x0e, 0x40, 0xc1, 0x0e, 0x40, 0xc1, 0x40, 0x04, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x40,
+    0x04, 0xc1, 0x80, 0x05, 0x80, 0xc1, 0x05, 0xc2, 0x05, 0xc2, 0x05, 0x40, 0xc1, 0x80, 0x03, 0x80,
+    0xc1, 0x40, 0x06, 0x80, 0xc1, 0x80, 0x41, 0x80, 0xc1, 0x80, 0x07, 0x40, 0xc7, 0x40, 0x09, 0x80,
+    0xc3, 0x80, 0x0d, 0x41, 0x07, 0x1c, 0x40, 0x81, 0x0c, 0x80, 0xc3, 0x40, 0x09, 0x40, 0xc4, 0x80,
+    0x09, 0x40, 0xc2, 0x80, 0x40, 0x0a, 0x40, 0xc2, 0x40, 0x0c, 0xc2, 0x40, 0x0c, 0x80, 0xc1, 0x40,
+    0x0d, 0xc1, 0x80, 0x00, 0x41, 0x0a, 0x40, 0xc6, 0x80, 0x08, 0x80, 0xc8, 0x40, 0x06, 0x80, 0xc2,
+    0x80, 0x41, 0x80, 0xc1, 0x80, 0x06, 0xc2, 0x80, 0x03, 0x80, 0xc1, 0x80, 0x05, 0xc2, 0x05, 0xc2,
+    0x05, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x04, 0x40, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x40, 0x03, 0x40,
+    0xc1, 0x40, 0x05, 0x40, 0xc1, 0x40, 0x04, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x05, 0xc2, 0x05, 0xc2,
+    0x05, 0x80, 0xc1, 0x80, 0x03, 0x80, 0xc1, 0x80, 0x06, 0x80, 0xc1, 0x80, 0x41, 0x80, 0xc1, 0x80,
+    0x07, 0x40, 0xc7, 0x40, 0x09, 0x80, 0xc3, 0x80, 0x0d, 0x41, 0x07, 0x02, 0x4b, 0x04, 0xcd, 0x03,
+    0xcd, 0x04, 0x49, 0xc1, 0x80, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x80, 0xc1, 0x0e, 0xc1, 0x80, 0x0d,
+    0x80, 0xc1, 0x0e, 0xc1, 0x80, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x80, 0xc1, 0x0e, 0xc1, 0x80, 0x0d,
+    0x80, 0xc1, 0x0e, 0xc1, 0x80, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x80, 0xc1, 0x0e, 0xc1, 0x80, 0x0d,
+    0x80, 0xc1, 0x0e, 0xc1, 0x80, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x80, 0xc1, 0x0e, 0xc1, 0x80, 0x0e,
+    0xc1, 0x1b, 0x07, 0x41, 0x0d, 0x80, 0xc3, 0x80, 0x0a, 0xc7, 0x08, 0x80, 0xc1, 0x80, 0x41, 0x80,
+    0xc1, 0x80, 0x06, 0x40, 0xc1, 0x80, 0x03, 0x80, 0xc1, 0x40, 0x05, 0x80, 0xc1, 0x05, 0xc1, 0x80,
+    0x05, 0x80, 0xc0, 0x80, 0x05, 0x80, 0xc0, 0x80, 0x05, 0x80, 0xc0, 0x80, 0x05, 0x80, 0xc0, 0x80,
+    0x05, 0x40, 0xc1, 0x40, 0x03, 0x40, 0xc1, 0x40, 0x06, 0xc2, 0x40, 0x01, 0x40, 0xc2, 0x07, 0x40,
+    0xc2, 0x81, 0xc2, 0x40, 0x08, 0x80, 0xc5, 0x80, 0x08, 0x80, 0xc7, 0x80, 0x06, 0x80, 0xc2, 0x80,
+    0x41, 0x80, 0xc2, 0x80, 0x05, 0xc1, 0x80, 0x05, 0x80, 0xc1, 0x04, 0x80, 0xc1, 0x07, 0xc1, 0x80,
+    0x03, 0x80, 0xc0, 0x80, 0x07, 0x80, 0xc0, 0x80, 0x03, 0x80, 0xc0, 0x80, 0x07, 0x80, 0xc0, 0x80,
+    0x03, 0x80, 0xc1, 0x07, 0xc1, 0x80, 0x04, 0xc1, 0x80, 0x05, 0x80, 0xc1, 0x05, 0x80, 0xc2, 0x80,
+    0x41, 0x80, 0xc2, 0x80, 0x06, 0x80, 0xc7, 0x80, 0x08, 0x40, 0x80, 0xc3, 0x80, 0x40, 0x0c, 0x41,
+    0x07, 0x07, 0x41, 0x0d, 0x80, 0xc3, 0x80, 0x09, 0x40, 0xc7, 0x40, 0x07, 0x80, 0xc1, 0x80, 0x41,
+    0x80, 0xc1, 0x80, 0x06, 0x80, 0xc1, 0x80, 0x03, 0x80, 0xc1, 0x80, 0x05, 0xc2, 0x05, 0xc2, 0x05,
+    0xc1, 0x40, 0x05, 0x40, 0xc1, 0x04, 0x40, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x40, 0x03, 0x40, 0xc1,
+    0x40, 0x05, 0x40, 0xc1, 0x40, 0x04, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x05, 0xc2, 0x05, 0xc2, 0x05,
+    0x80, 0xc1, 0x80, 0x03, 0x80, 0xc2, 0x06, 0x80, 0xc1, 0x80, 0x41, 0x80, 0xc2, 0x80, 0x06, 0x40,
+    0xc8, 0x80, 0x08, 0x80, 0xc6, 0x40, 0x0a, 0x41, 0x00, 0x80, 0xc1, 0x0d, 0x40, 0xc1, 0x80, 0x0c,
+    0x40, 0xc2, 0x0c, 0x40, 0xc2, 0x40, 0x0a, 0x40, 0x80, 0xc2, 0x40, 0x09, 0x80, 0xc4, 0x40, 0x09,
+    0x40, 0xc3, 0x80, 0x0c, 0x81, 0x40, 0x1c, 0x19, 0xc1, 0x0e, 0x40, 0xc1, 0x40, 0x0d, 0x80, 0xc1,
+    0x80, 0x0d, 0xc3, 0x0c, 0x40, 0xc3, 0x40, 0x0b, 0x80, 0xc3, 0x80, 0x0b, 0xc1, 0x81, 0xc1, 0x0a,
+    0x40, 0xc1, 0x41, 0xc1, 0x40, 0x09, 0x80, 0xc1, 0x01, 0xc1, 0x80, 0x09, 0xc1, 0x80, 0x01, 0x80,
+    0xc1, 0x09, 0xc1, 0x40, 0x01, 0x40, 0xc1, 0x08, 0x40, 0xc1, 0x03, 0xc1, 0x40, 0x07, 0x80, 0xc1,
+    0x43, 0xc1, 0x80, 0x07, 0xc9, 0x06, 0x40, 0xc9, 0x40, 0x05, 0x80, 0xc1, 0x45, 0xc1, 0x80, 0x05,
+    0xc1, 0x80, 0x05, 0x80, 0xc1, 0x04, 0x40, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x40, 0x03, 0x80, 0xc1,
+    0x07, 0xc1, 0x80, 0x03, 0xc1, 0x80, 0x07, 0x80, 0xc1, 0x03, 0xc1, 0x40, 0x07, 0x40, 0xc1, 0x03,
+    0xc1, 0x09, 0xc1, 0x13, 0x03, 0x49, 0x06, 0xcb, 0x04, 0x40, 0xcb, 0x04, 0x40, 0xc1, 0x48, 0x05,
+    0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d,
+    0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x45, 0x08, 0x40, 0xc8, 0x07, 0x40, 0xc8, 0x07, 0x40, 0xc1,
+    0x45, 0x08, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1,
+    0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1,
+    0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0e, 0xc1, 0x1e, 0x14, 0xc1, 0x07, 0xc1, 0x04, 0x40, 0xc1, 0x40,
+    0x05, 0x40, 0xc1, 0x40, 0x03, 0x40, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x40, 0x03, 0x40, 0xc1, 0x40,
+    0x05, 0x40, 0xc1, 0x40, 0x03, 0x40, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x40, 0x03, 0x40, 0xc1, 0x40,
+    0x05, 0x40, 0xc1, 0x40, 0x03, 0x40, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x40, 0x03, 0x40, 0xc1, 0x40,
+    0x05, 0x40, 0xc1, 0x40, 0x03, 0x40, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x40, 0x03, 0x40, 0xc1, 0x47,
+    0xc1, 0x40, 0x03, 0x40, 0xcb, 0x40, 0x03, 0x40, 0xcb, 0x40, 0x03, 0x40, 0xc1, 0x47, 0xc1, 0x40,
+    0x03, 0x40, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x40, 0x03, 0x40, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x40,
+    0x03, 0x40, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x40, 0x03, 0x40, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x40,
+    0x03, 0x40, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x40, 0x03, 0x40, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x40,
+    0x03, 0x40, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x40, 0x03, 0x40, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x40,
+    0x04, 0xc1, 0x07, 0xc1, 0x14, 0x03, 0x46, 0x09, 0xc8, 0x80, 0x06, 0x40, 0xc9, 0x80, 0x05, 0x40,
+    0xc1, 0x45, 0x80, 0xc1, 0x40, 0x04, 0x40, 0xc1, 0x40, 0x05, 0xc1, 0x80, 0x04, 0x40, 0xc1, 0x40,
+    0x05, 0x80, 0xc1, 0x04, 0x40, 0xc1, 0x40, 0x05, 0x40, 0xc1, 0x40, 0x03, 0x40, 0xc1, 0x40, 0x05,
+    0x40, 0xc1, 0x40, 0x03, 0x40, 0xc1, 0x40, 0x05, 0x80, 0xc1, 0x04, 0x40, 0xc1, 0x40, 0x05, 0xc1,
+    0x80, 0x04, 0x40, 0xc1, 0x45, 0x80, 0xc1, 0x40, 0x04, 0x40, 0xc9, 0x80, 0x05, 0x40, 0xc8, 0x80,
+    0x06, 0x40, 0xc1, 0x45, 0x08, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x40,
+    0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x40, 0x0d, 0x40, 0xc1, 0x40,
+    0x0d, 0x40, 0xc1, 0x40, 0x0e, 0xc1, 0x1e, 0x13, 0xc1, 0x09, 0xc1, 0x03, 0xc1, 0x40, 0x07, 0x40,
+    0xc1, 0x03, 0xc1, 0x80, 0x07, 0x80, 0xc1, 0x03, 0x80, 0xc1, 0x07, 0xc1, 0x80, 0x03, 0x40, 0xc1,
+    0x40, 0x05, 0x40, 0xc1, 0x40, 0x04, 0xc1, 0x80, 0x05, 0x80, 0xc1, 0x05, 0x80, 0xc1, 0x05, 0xc1,
+    0x80, 0x05, 0x40, 0xc1, 0x40, 0x03, 0x40, 0xc1, 0x40, 0x06, 0xc1, 0x80, 0x03, 0x80, 0xc1, 0x07,
+    0x80, 0xc1, 0x03, 0xc1, 0x80, 0x07, 0x40, 0xc1, 0x03, 0xc1, 0x40, 0x08, 0xc1, 0x40, 0x01, 0x40,
+    0xc1, 0x09, 0xc1, 0x80, 0x01, 0x80, 0xc1, 0x09, 0x80, 0xc1, 0x01, 0xc1, 0x80, 0x09, 0x40, 0xc1,
+    0x41, 0xc1, 0x40, 0x0a, 0xc1, 0x81, 0xc1, 0x0b, 0x80, 0xc3, 0x80, 0x0b, 0x40, 0xc3, 0x40, 0x0c,
+    0xc3, 0x0d, 0x80, 0xc1, 0x80, 0x0d, 0x40, 0xc1, 0x40, 0x0e, 0xc1, 0x19, 0x13, 0xc1, 0x09, 0xc1,
+    0x02, 0x40, 0xc1, 0x40, 0x07, 0x40, 0xc1, 0x40, 0x02, 0xc1, 0x80, 0x07, 0x80, 0xc1, 0x03, 0xc1,
+    0x80, 0x07, 0x80, 0xc1, 0x03, 0x80, 0xc0, 0x80, 0x07, 0x80, 0xc0, 0x80, 0x03, 0x80, 0xc1, 0x07,
+    0xc1, 0x80, 0x03, 0x80, 0xc1, 0x02, 0xc1, 0x02, 0xc1, 0x80, 0x03, 0x40, 0xc1, 0x40, 0x00, 0x40,
+    0xc1, 0x40, 0x00, 0x40, 0xc1, 0x40, 0x04, 0xc1, 0x40, 0x00, 0x80, 0xc1, 0x80, 0x00, 0x40, 0xc1,
+    0x05, 0xc1, 0x80, 0x00, 0x80, 0xc1, 0x80, 0x00, 0x80, 0xc1, 0x05, 0x80, 0xc0, 0x80, 0x00, 0xc3,
+    0x00, 0x80, 0xc0, 0x80, 0x05, 0x80, 0xc0, 0x80, 0x40, 0xc3, 0x40, 0x80, 0xc0, 0x80, 0x05, 0x80,
+    0xc1, 0x80, 0xc3, 0x80, 0xc1, 0x80, 0x05, 0x40, 0xc1, 0x80, 0xc3, 0x80, 0xc1, 0x40, 0x05, 0x40,
+    0xc3, 0x81, 0xc3, 0x40, 0x06, 0xc3, 0x81, 0xc3, 0x07, 0xc3, 0x41, 0xc3, 0x07, 0x80, 0xc2, 0x01,
+    0xc2, 0x80, 0x07, 0x80, 0xc1, 0x80, 0x01, 0x80, 0xc1, 0x80, 0x07, 0x80, 0xc1, 0x80, 0x01, 0x80,
+    0xc1, 0x80, 0x07, 0x40, 0xc1, 0x40, 0x01, 0x40, 0xc1, 0x40, 0x08, 0xc1, 0x03, 0xc1, 0x16, 0x3f,
+    0x3f, 0x14, 0x47, 0x08, 0xc9, 0x07, 0xc9, 0x08, 0x44, 0x80, 0xc1, 0x80, 0x0c, 0x40, 0xc1, 0x80,
+    0x0d, 0x80, 0xc1, 0x40, 0x0c, 0x80, 0xc1, 0x80, 0x0c, 0x40, 0xc1, 0x80, 0x0d, 0x80, 0xc1, 0x40,
+    0x0c, 0x80, 0xc1, 0x80, 0x0c, 0x40, 0xc1, 0x80, 0x0d, 0x80, 0xc1, 0x40, 0x0c, 0x80, 0xc1, 0x80,
+    0x44, 0x08, 0xc9, 0x07, 0xc9, 0x08, 0x47, 0x04,
+  };
+}
@@ -0,0 +1,151 @@
+#include "framebuffer_gfx.hpp"
+
+FramebufferGFX::FramebufferGFX(int16_t width, int16_t height)
+  : Adafruit_GFX(width, height), buffer(new (std::nothrow) uint16_t[(int32_t)width * height])
+{
+  if(buffer)
+    memset(buffer, 0, (int32_t)width * height * sizeof(uint16_t));
+}
+
+FramebufferGFX::~FramebufferGFX()
+{
+  delete[] buffer;
+}
+
+void FramebufferGFX::countWindow(uint32_t count)
+{
+  bytes += addressWindowBytes + 2 * count;
+  windows += 1;
+  pixels += count;
+}
+
+void FramebufferGFX::store(int16_t x, int16_t y, uint16_t color)
+{
+  // Screen to framebuffer (unrotated panel) coordinates - as GFXcanvas16 does
+  int16_t t;
+  switch(rotation)
+  {
+    case 1:
+      t = x;
+      x = WIDTH - 1 - y;
+      y = t;
+      break;
+    case 2:
+      x = WIDTH - 1 - x;
+      y = HEIGHT - 1 - y;
+      break;
+    case 3:
+      t = x;
+      x = y;
+      y = HEIGHT - 1 - t;
+      break;
+  }
+
+  buffer[(int32_t)y * WIDTH + x] = color;
+}
+
+uint16_t FramebufferGFX::getPixel(int16_t x, int16_t y) const
+{
+  if(buffer == NULL || x < 0 || y < 0 || x >= _width || y >= _height)
+    return 0;
+
+  int16_t t;
+  switch(rotation)
+  {
+    case 1:
+      t = x;
+      x = WIDTH - 1 - y;
+      y = t;
+      break;
+    case 2:
+      x = WIDTH - 1 - x;
+      y = HEIGHT - 1 - y;
+      break;
+    case 3:
+      t = x;
+      x = y;
+      y = HEIGHT - 1 - t;
+      break;
+  }
+  return buffer[(int32_t)y * WIDTH + x];
+}
+
+void FramebufferGFX::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+  if(buffer == NULL || x < 0 || y < 0 || x >= _width || y >= _height)
+    return;
+
+  countWindow(1);
+  store(x, y, color);
+}
+
+void FramebufferGFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  if(w < 0) { x += w + 1; w = -w; }
+  if(h < 0) { y += h + 1; h = -h; }
+
+  int16_t x1 = min<int32_t>(x + w, _width);
+  int16_t y1 = min<int32_t>(y + h, _height);
+  x = max<int16_t>(x, 0);
+  y = max<int16_t>(y, 0);
+
+  if(buffer == NULL || x1 <= x || y1 <= y)
+    return;
+
+  countWindow((uint32_t)(x1 - x) * (y1 - y));
+  for(int16_t row = y; row < y1; ++row)
+  {
+    for(int16_t column = x; column < x1; ++column)
+      store(column, row, color);
+  }
+}
+
+void FramebufferGFX::setAddrWindow(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  windowX = x;
+  windowY = y;
+  windowW = w;
+  windowH = h;
+  windowNext = 0;
+
+  bytes += addressWindowBytes;
+  windows += 1;
+}
+
+void FramebufferGFX::writePixels(const uint16_t * colors, uint32_t len)
+{
+  bytes += 2 * len;
+  pixels += len;
+
+  for(uint32_t i = 0; i < len && windowW > 0; ++i, ++windowNext)
+  {
+    // The panel wraps back to the start of the window once it is full
+    int32_t offset = windowNext % ((int32_t)windowW * windowH);
+    int16_t x = windowX + offset % windowW;
+    int16_t y = windowY + offset / windowW;
+
+    if(buffer && x >= 0 && y >= 0 && x < _width && y < _height)
+      store(x, y, colors[i]);
+  }
+}
+
+void FramebufferGFX::writePPM(Print & out) const
+{
+  out.printf("P6\n%d %d\n255\n", _width, _height);
+
+  uint8_t rgb[3];
+  for(int16_t y = 0; y < _height; ++y)
+  {
+    for(int16_t x = 0; x < _width; ++x)
+    {
+      uint16_t pixel = getPixel(x, y);
+      uint8_t r = (pixel >> 11) & 0x1f;
+      uint8_t g = (pixel >> 5) & 0x3f;
+      uint8_t b = pixel & 0x1f;
+      rgb[0] = (r << 3) | (r >> 2);
+      rgb[1] = (g << 2) | (g >> 4);
+      rgb[2] = (b << 3) | (b >> 2);
+      out.write(rgb, sizeof(rgb));
+    }
+  }
+}
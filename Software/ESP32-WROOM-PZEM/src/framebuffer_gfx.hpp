@@ -0,0 +1,67 @@
+#pragma once
+
+/// Adafruit_GFX that draws into an RGB565 framebuffer in RAM instead of the panel, while counting what the same calls
+/// would have cost over SPI to the ST7789 - the same model as CountingST7789: every drawing primitive is one address
+/// window (CASET + 4 bytes, RASET + 4 bytes, RAMWR = 11 bytes) plus 2 bytes per pixel after clipping, and
+/// setAddrWindow() / writePixels() stream like Adafruit_SPITFT.
+///
+/// It only needs Adafruit_GFX and Print, so it builds for the host as well (see tools/host_render.cpp) - page code can
+/// be rendered there pixel for pixel, with deterministic transfer costs, and written out with writePPM().
+
+#include <Adafruit_GFX.h>
+
+class FramebufferGFX : public Adafruit_GFX
+{
+public:
+  static const uint32_t addressWindowBytes = 11;
+
+  /// The framebuffer is allocated here - check valid() on small devices (a 280x240 frame is 131KB)
+  FramebufferGFX(int16_t width, int16_t height);
+  ~FramebufferGFX();
+
+  bool valid() const { return buffer != NULL; }
+
+  /// Pixel in screen (rotated) coordinates - 0 if outside the screen
+  uint16_t getPixel(int16_t x, int16_t y) const;
+  const uint16_t * getBuffer() const { return buffer; }
+
+  uint32_t spiBytes() const { return bytes; }
+  uint32_t addressWindows() const { return windows; }
+  uint32_t pixelsWritten() const { return pixels; }
+  void resetCounters() { bytes = windows = pixels = 0; }
+
+  /// Binary PPM (P6) of the panel as it would look - RGB565 expanded to 8 bits per channel
+  void writePPM(Print & out) const;
+
+  /// Stream pixels the way Adafruit_SPITFT does: setAddrWindow() then writePixels() fills the window row by row
+  void setAddrWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+  void writePixels(const uint16_t * colors, uint32_t len);
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void writePixel(int16_t x, int16_t y, uint16_t color) override { drawPixel(x, y, color); }
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override { fillRect(x, y, w, h, color); }
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override { fillRect(x, y, w, 1, color); }
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override { fillRect(x, y, 1, h, color); }
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override { fillRect(x, y, w, 1, color); }
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override { fillRect(x, y, 1, h, color); }
+  void fillScreen(uint16_t color) override { fillRect(0, 0, _width, _height, color); }
+
+private:
+  uint16_t * buffer;
+
+  uint32_t bytes = 0;
+  uint32_t windows = 0;
+  uint32_t pixels = 0;
+
+  // The current address window and the next pixel in it
+  int16_t windowX = 0;
+  int16_t windowY = 0;
+  int16_t windowW = 0;
+  int16_t windowH = 0;
+  int32_t windowNext = 0;
+
+  /// Store a pixel given in screen coordinates (already clipped)
+  void store(int16_t x, int16_t y, uint16_t color);
+  void countWindow(uint32_t count);
+};
@@ -0,0 +1,339 @@
+#include <ArduinoJson.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+
+#include <atomic>
+
+#include "instrumentation.hpp"
+#include "power.hpp"
+
+namespace
+{
+  SemaphoreHandle_t metricsMutex = NULL; // SampleDeviceMetrics() runs on the network thread, the web server reads from its own task
+  DeviceMetrics latest;
+  SettingsLoadStats bootSettingsStats;
+
+  const char * const latencyNames[LATENCY_COUNT] = { "touch_event", "input_to_screen" };
+  std::atomic<uint32_t> latencyLast[LATENCY_COUNT];
+  std::atomic<uint32_t> latencyMax[LATENCY_COUNT];
+
+  volatile uint32_t renderSpiBytes = 0;
+  volatile uint32_t renderMicros = 0;
+  volatile uint32_t renderPixels = 0;
+  uint32_t renderMaxSpiBytes = 0;
+  uint32_t renderMaxMicros = 0;
+  PageRenderStats pageStats[DISPLAY_PAGE_COUNT];
+
+  /// Frames are counted over windows of at least a second - the rate is updated as each window closes
+  const uint32_t fpsWindowMicros = 1000000;
+  uint32_t fpsWindowStart = 0;
+  uint32_t fpsWindowFrames = 0;
+  volatile uint32_t lastRenderMicros = 0;
+  volatile float renderFps = 0;
+  volatile uint32_t frameMicros = 0;
+  volatile uint32_t framePaintMicros = 0;
+
+  uint32_t previousIdleMicros = 0;
+  int64_t previousSampleMicros = 0;
+
+#if configUSE_TRACE_FACILITY
+  TaskStatus_t taskStatus[DeviceMetrics::maxTasks];
+
+#if configGENERATE_RUN_TIME_STATS
+  /// Run time counters from the previous sample - CPU usage is reported as the change between samples
+  struct PreviousRunTime
+  {
+    TaskHandle_t handle;
+    uint32_t runTime;
+  };
+  PreviousRunTime previousRunTime[DeviceMetrics::maxTasks];
+  int previousCount = 0;
+  uint32_t previousTotalRunTime = 0;
+
+  uint32_t previousRunTimeFor(TaskHandle_t handle)
+  {
+    for(int i = 0; i < previousCount; ++i)
+    {
+      if(previousRunTime[i].handle == handle)
+        return previousRunTime[i].runTime;
+    }
+    return 0; // New task since the last sample - count everything it has used so far
+  }
+#endif
+#endif
+
+  /// A percentage for the JSON - null when it is not known (-1) rather than a number a dashboard would plot
+  template<typename Value> void setPercent(Value value, float percent)
+  {
+    if(percent < 0)
+      value = nullptr;
+    else
+      value = percent;
+  }
+
+  void sampleTasks(DeviceMetrics & metrics)
+  {
+    for(int core = 0; core < portNUM_PROCESSORS; ++core)
+      metrics.coreBusyPercent[core] = -1;
+
+#if configUSE_TRACE_FACILITY
+    uint32_t totalRunTime = 0;
+    UBaseType_t count = uxTaskGetSystemState(taskStatus, DeviceMetrics::maxTasks, &totalRunTime);
+
+    if(count == 0)
+    {
+      // More tasks than we have room for - uxTaskGetSystemState() returns nothing rather than a partial list
+      Serial.println("Metrics: too many tasks to sample, increase DeviceMetrics::maxTasks");
+    }
+
+    metrics.taskCount = count;
+
+#if configGENERATE_RUN_TIME_STATS
+    // The run time clock is shared by both cores - so the elapsed time is also the time available to each core
+    uint32_t elapsed = totalRunTime - previousTotalRunTime;
+#endif
+
+    for(UBaseType_t i = 0; i < count; ++i)
+    {
+      const TaskStatus_t & status = taskStatus[i];
+      TaskMetrics & task = metrics.tasks[i];
+
+      strlcpy(task.name, status.pcTaskName, sizeof(task.name));
+      task.priority = status.uxCurrentPriority;
+      task.stackFreeMinBytes = status.usStackHighWaterMark;
+#if configTASKLIST_INCLUDE_COREID
+      task.core = status.xCoreID < portNUM_PROCESSORS ? status.xCoreID : -1;
+#endif
+
+#if configGENERATE_RUN_TIME_STATS
+      if(previousTotalRunTime != 0 && elapsed != 0)
+      {
+        task.cpuPercent = 100.0f * (status.ulRunTimeCounter - previousRunTimeFor(status.xHandle)) / elapsed;
+
+        for(int core = 0; core < portNUM_PROCESSORS; ++core)
+        {
+          if(status.xHandle == xTaskGetIdleTaskHandleForCPU(core))
+            metrics.coreBusyPercent[core] = 100.0f - task.cpuPercent;
+        }
+      }
+      else
+      {
+        task.cpuPercent = -1;
+      }
+#endif
+    }
+
+#if configGENERATE_RUN_TIME_STATS
+    for(UBaseType_t i = 0; i < count; ++i)
+    {
+      previousRunTime[i].handle = taskStatus[i].xHandle;
+      previousRunTime[i].runTime = taskStatus[i].ulRunTimeCounter;
+    }
+    previousCount = count;
+    previousTotalRunTime = totalRunTime;
+#endif
+#endif
+  }
+}
+
+void InitDeviceMetrics(const SettingsLoadStats & settingsStats)
+{
+  bootSettingsStats = settingsStats;
+  metricsMutex = xSemaphoreCreateMutex();
+}
+
+void SampleDeviceMetrics()
+{
+  static DeviceMetrics metrics; // Static as it is too large to comfortably put on the calling task's stack
+
+  metrics.uptimeSeconds = millis() / 1000;
+
+  metrics.heapFree = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  metrics.heapMinFree = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+  metrics.heapLargestBlock = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  metrics.heapFragmentation = metrics.heapFree ? 1.0f - (float)metrics.heapLargestBlock / metrics.heapFree : 0.0f;
+
+  sampleTasks(metrics);
+
+  int64_t sampleMicros = esp_timer_get_time();
+  uint32_t idleMicros = SchedulerIdleMicros();
+  if(previousSampleMicros != 0 && sampleMicros > previousSampleMicros)
+    metrics.loopIdlePercent = 100.0f * (idleMicros - previousIdleMicros) / (sampleMicros - previousSampleMicros);
+  previousIdleMicros = idleMicros;
+  previousSampleMicros = sampleMicros;
+
+  const SchedulerJobStats * jobs = SchedulerGetJobStats(metrics.jobCount);
+  for(int i = 0; i < metrics.jobCount; ++i)
+    metrics.jobs[i] = jobs[i];
+
+  metrics.renderSpiBytes = renderSpiBytes;
+  metrics.renderMicros = renderMicros;
+  metrics.renderPixels = renderPixels;
+  metrics.renderMaxSpiBytes = renderMaxSpiBytes;
+  metrics.renderMaxMicros = renderMaxMicros;
+  metrics.renderFps = RenderFramesPerSecond();
+  for(int page = 0; page < DISPLAY_PAGE_COUNT; ++page)
+    metrics.pages[page] = pageStats[page];
+  metrics.frameMicros = frameMicros;
+  metrics.framePaintMicros = framePaintMicros;
+
+  for(int i = 0; i < LATENCY_COUNT; ++i)
+  {
+    metrics.latencyLastMicros[i] = latencyLast[i].load();
+    metrics.latencyMaxMicros[i] = latencyMax[i].load();
+  }
+
+  xSemaphoreTake(metricsMutex, portMAX_DELAY);
+  latest = metrics;
+  xSemaphoreGive(metricsMutex);
+}
+
+void RecordLatency(LatencyMetric metric, uint32_t micros)
+{
+  latencyLast[metric].store(micros);
+
+  uint32_t max = latencyMax[metric].load();
+  while(micros > max && !latencyMax[metric].compare_exchange_weak(max, micros))
+    ;
+}
+
+void RecordRender(int page, uint32_t spiBytes, uint32_t pixels, uint32_t micros)
+{
+  // Only ever written from the render task - the network thread just reads the words (a page's stats may be a mix
+  // of two refreshes, which is fine for monitoring)
+  renderSpiBytes = spiBytes;
+  renderMicros = micros;
+  renderPixels = pixels;
+  renderMaxSpiBytes = max(renderMaxSpiBytes, spiBytes);
+  renderMaxMicros = max(renderMaxMicros, micros);
+
+  if(page >= 0 && page < DISPLAY_PAGE_COUNT)
+  {
+    PageRenderStats & stats = pageStats[page];
+    ++stats.frames;
+    stats.micros = micros;
+    stats.spiBytes = spiBytes;
+    stats.pixels = pixels;
+    stats.maxMicros = max(stats.maxMicros, micros);
+    stats.maxSpiBytes = max(stats.maxSpiBytes, spiBytes);
+  }
+
+  uint32_t now = esp_timer_get_time();
+  lastRenderMicros = now;
+  ++fpsWindowFrames;
+  if(now - fpsWindowStart >= fpsWindowMicros)
+  {
+    renderFps = fpsWindowFrames * 1000000.0f / (now - fpsWindowStart);
+    fpsWindowStart = now;
+    fpsWindowFrames = 0;
+  }
+}
+
+PageRenderStats GetPageRenderStats(int page)
+{
+  return pageStats[page];
+}
+
+float RenderFramesPerSecond()
+{
+  // No frame for a couple of windows - the screen is idle rather than still running at the last rate
+  if((uint32_t)esp_timer_get_time() - lastRenderMicros > 2 * fpsWindowMicros)
+    return 0;
+  return renderFps;
+}
+
+void RecordFrame(uint32_t micros, uint32_t paintMicros)
+{
+  frameMicros = micros;
+  framePaintMicros = paintMicros;
+}
+
+String DeviceMetricsToJson()
+{
+  JsonDocument doc;
+
+  xSemaphoreTake(metricsMutex, portMAX_DELAY);
+
+  doc["uptime"] = latest.uptimeSeconds;
+
+  JsonObject heap = doc["heap"].to<JsonObject>();
+  heap["free"] = latest.heapFree;
+  heap["min_free"] = latest.heapMinFree;
+  heap["largest_block"] = latest.heapLargestBlock;
+  heap["fragmentation"] = latest.heapFragmentation;
+
+  JsonArray cores = doc["core_busy"].to<JsonArray>();
+  for(int core = 0; core < portNUM_PROCESSORS; ++core)
+    setPercent(cores.add<JsonVariant>(), latest.coreBusyPercent[core]);
+
+  JsonArray tasks = doc["tasks"].to<JsonArray>();
+  for(int i = 0; i < latest.taskCount; ++i)
+  {
+    const TaskMetrics & task = latest.tasks[i];
+    JsonObject t = tasks.add<JsonObject>();
+    t["name"] = task.name;
+    t["core"] = task.core;
+    t["prio"] = task.priority;
+    t["stack_free"] = task.stackFreeMinBytes;
+    setPercent(t["cpu"], task.cpuPercent);
+  }
+
+  JsonObject scheduler = doc["scheduler"].to<JsonObject>();
+  setPercent(scheduler["idle"], latest.loopIdlePercent);
+  JsonArray jobs = scheduler["jobs"].to<JsonArray>();
+  for(int i = 0; i < latest.jobCount; ++i)
+  {
+    const SchedulerJobStats & job = latest.jobs[i];
+    JsonObject j = jobs.add<JsonObject>();
+    j["name"] = job.name;
+    j["runs"] = job.runs;
+    j["missed"] = job.missed;
+    j["max_late_ms"] = job.maxLateMs;
+    j["max_run_us"] = job.maxRunMicros;
+  }
+
+  JsonObject display = doc["display"].to<JsonObject>();
+  display["spi_bytes"] = latest.renderSpiBytes;
+  display["render_us"] = latest.renderMicros;
+  display["max_spi_bytes"] = latest.renderMaxSpiBytes;
+  display["max_render_us"] = latest.renderMaxMicros;
+  display["pixels"] = latest.renderPixels;
+  display["fps"] = latest.renderFps;
+  display["frame_us"] = latest.frameMicros;
+  display["frame_paint_us"] = latest.framePaintMicros;
+  JsonArray pages = display["pages"].to<JsonArray>();
+  for(int page = 0; page < DISPLAY_PAGE_COUNT; ++page)
+  {
+    const PageRenderStats & stats = latest.pages[page];
+    JsonObject p = pages.add<JsonObject>();
+    p["frames"] = stats.frames;
+    p["render_us"] = stats.micros;
+    p["spi_bytes"] = stats.spiBytes;
+    p["pixels"] = stats.pixels;
+    p["max_render_us"] = stats.maxMicros;
+    p["max_spi_bytes"] = stats.maxSpiBytes;
+  }
+
+  JsonObject power = doc["power"].to<JsonObject>();
+  power["mode"] = (int)PowerCurrentMode();
+  power["cpu_mhz"] = getCpuFrequencyMhz();
+
+  JsonObject latency = doc["latency"].to<JsonObject>();
+  for(int i = 0; i < LATENCY_COUNT; ++i)
+  {
+    JsonObject l = latency[latencyNames[i]].to<JsonObject>();
+    l["last_us"] = latest.latencyLastMicros[i];
+    l["max_us"] = latest.latencyMaxMicros[i];
+  }
+
+  xSemaphoreGive(metricsMutex);
+
+  JsonObject settings = doc["settings_load"].to<JsonObject>();
+  settings["cached"] = bootSettingsStats.fromCache;
+  settings["us"] = bootSettingsStats.loadMicros;
+  settings["peak_heap"] = bootSettingsStats.peakHeapBytes;
+
+  String json;
+  serializeJson(doc, json);
+  return json;
+}
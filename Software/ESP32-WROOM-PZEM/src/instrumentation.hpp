@@ -0,0 +1,101 @@
+#pragma once
+
+/// Run time instrumentation - per task CPU usage and stack high water marks plus heap usage / fragmentation.
+///
+/// SampleDeviceMetrics() is called periodically (at the "metrics_period_ms" rate from the settings) and the latest
+/// sample is published over MQTT and served from the web server. The numbers are intended for right-sizing task
+/// stacks and spotting heap leaks / fragmentation from String churn on devices in the field.
+///
+/// Per task CPU usage and the core busy figures need CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS, which the prebuilt
+/// Arduino-ESP32 libraries leave off - without it they are null in the JSON (see platformio.ini for turning it on).
+///
+/// Note: ESP-IDF measures stacks in BYTES (both xTaskCreate's stack depth and the high water marks) - not words.
+
+#include <Arduino.h>
+
+#include "device_settings.hpp"
+#include "pages.hpp"
+#include "scheduler.hpp"
+
+/// Latencies recorded with RecordLatency()
+enum LatencyMetric
+{
+  LATENCY_TOUCH_EVENT,      // Touch interrupt to the debounced press event being queued
+  LATENCY_INPUT_TO_SCREEN,  // Touch interrupt to the page reflecting it having been drawn
+  LATENCY_COUNT
+};
+
+struct PageRenderStats
+{
+  uint32_t frames = 0;              // Refreshes of this page since boot
+  uint32_t micros = 0;              // The most recent refresh
+  uint32_t spiBytes = 0;
+  uint32_t pixels = 0;
+  uint32_t maxMicros = 0;           // Worst refresh since boot
+  uint32_t maxSpiBytes = 0;
+};
+
+struct TaskMetrics
+{
+  char name[16] = "";
+  int8_t core = -1;                 // -1 == not pinned to a core
+  uint8_t priority = 0;
+  uint32_t stackFreeMinBytes = 0;   // Stack high water mark - the least free stack the task has ever had
+  float cpuPercent = -1;            // Share of one core since the previous sample (-1 if run time stats are off)
+};
+
+struct DeviceMetrics
+{
+  static const int maxTasks = 24;
+
+  uint32_t uptimeSeconds = 0;
+
+  uint32_t heapFree = 0;
+  uint32_t heapMinFree = 0;         // Low water mark since boot
+  uint32_t heapLargestBlock = 0;
+  float heapFragmentation = 0;      // 1 - largest free block / free heap (0 == one contiguous free block)
+
+  float coreBusyPercent[portNUM_PROCESSORS] = {};  // 100 - idle task share of each core since the previous sample (-1 if unknown)
+
+  int taskCount = 0;
+  TaskMetrics tasks[maxTasks];
+
+  float loopIdlePercent = -1;       // Share of the time the core 1 scheduler spent asleep since the previous sample
+  int jobCount = 0;
+  SchedulerJobStats jobs[SCHEDULER_MAX_JOBS];
+
+  uint32_t renderSpiBytes = 0;      // The most recent screen refresh
+  uint32_t renderMicros = 0;
+  uint32_t renderPixels = 0;
+  uint32_t renderMaxSpiBytes = 0;   // Worst refresh since boot
+  uint32_t renderMaxMicros = 0;
+  float renderFps = 0;              // Refreshes per second over the last second or so (0 when the screen is idle)
+  PageRenderStats pages[DISPLAY_PAGE_COUNT];
+  uint32_t frameMicros = 0;         // The most recent full frame redraw through the strip renderer
+  uint32_t framePaintMicros = 0;    // ...and the CPU time spent painting it
+
+  uint32_t latencyLastMicros[LATENCY_COUNT] = {};
+  uint32_t latencyMaxMicros[LATENCY_COUNT] = {};
+};
+
+/// Must be called once before any of the other functions (before the network thread is started)
+void InitDeviceMetrics(const SettingsLoadStats & settingsStats);
+
+/// Take a new sample - replaces the snapshot returned by DeviceMetricsToJson()
+void SampleDeviceMetrics();
+
+/// Record a latency measurement - may be called from any task
+void RecordLatency(LatencyMetric metric, uint32_t micros);
+
+/// Record the cost of a refresh of "page" - called from the render task
+void RecordRender(int page, uint32_t spiBytes, uint32_t pixels, uint32_t micros);
+
+/// Render costs of one page and the achieved screen refreshes per second - for the on-screen overlay
+PageRenderStats GetPageRenderStats(int page);
+float RenderFramesPerSecond();
+
+/// Record the cost of a full frame redraw through the strip renderer
+void RecordFrame(uint32_t frameMicros, uint32_t paintMicros);
+
+/// The most recent sample as a JSON object
+String DeviceMetricsToJson();
@@ -5,17 +5,21 @@
 /// The aim is to use both CPU cores - one for the PZEM monitoring and display and the other for monitoring 
 /// the network side / the MQTT connection and capacitiative touch buttons
 
-
-#define ARDUINOJSON_ENABLE_COMMENTS 1
 #include <Arduino.h>
 #include <WiFi.h>
+#include <esp_timer.h>
+#include <freertos/event_groups.h>
 
 #include <SPI.h>
 #include <Wire.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_ST7789.h> // Hardware-specific library for ST7789
-
-#include <SparkLine.h>
+#include "chart_st7789.hpp"
+#include "counting_st7789.hpp"
+#include "digit_font.hpp"
+#include "scrolling_chart.hpp"
+#include "strip_renderer.hpp"
+#include "text_field.hpp"
 
 /// Used for the simple MQTT publisher
 #include <PubSubClient.h>
@@ -26,15 +30,20 @@
 #include <ElegantOTA.h>
 #include <WiFi.h>
 
-#include "json_settings.hpp"
+#include "device_settings.hpp"
+#include "instrumentation.hpp"
 #include "ota_default.hpp"
+#include "pages.hpp"
+#include "power.hpp"
+#include "scheduler.hpp"
+#include "touch_input.hpp"
+#include "trace.hpp"
+#include "widgets.hpp"
 
 /// Below are the PZEM specific bits - i.e. initialising the right GPIO to use etc
 #include <HardwareSerial.h>
 
-// The below "define" controls whether it uses the V3 or V2 serial interface (which depends on which PZEM-004T board you have).
-// V3 outputs a few extra parameters and the board has leds that pulse when readings are being taken
-#define PZEM_V3
+#include "pzem_config.hpp"
 
 
 /// NOTE 10.0.1.75 - solar monitor
@@ -51,6 +60,7 @@
 #include <PZEM004T.h>   // See https://github.com/olehs/PZEM004T
 #endif
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -101,7 +111,9 @@ esp_err_t reset_pzem(PsychicRequest *request)
   response.setCode(200);
   response.setContentType("text/json");
 
+  PowerLockAcquire(POWER_LOCK_MODBUS);
   bool ret = pzem.resetEnergy();
+  PowerLockRelease(POWER_LOCK_MODBUS);
   
   const char * txt = ret ? "{\"reset\":\"true\"}" : "{\"reset\":\"false\"}";
   response.setContent((const uint8_t*)txt,strlen(txt));
@@ -109,17 +121,13 @@ esp_err_t reset_pzem(PsychicRequest *request)
 }
 
 
-// Enum to keep track of the current state for each button
-enum TouchState {TouchUndefined, ButtonUp, ButtonFirstPress, ButtonPressed, ButtonDown};
-
 /// Note: The TFT / SPI api has param for  a reset pin - but for this board I have connected RESET of TFT to the "enable" pin of the ESP32 - i.e. it resets upon startup
+/// The TFT, the page number and the chart are only touched by the render task - other tasks ask it to redraw via RenderNotify()
 struct core1_state
 {  
   //uninitalised pointers to SPI objects
   SPIClass * hspi = NULL;
-  Adafruit_ST7789 * tft = NULL; 
-
-  bool isDirty = true; // Does the screen need a refresh
+  CountingST7789 * tft = NULL; // Counts the bytes sent over SPI - reported per refresh in /metrics
 
   uint8_t pzemAddress = 0;
   float voltage=0.0;
@@ -129,12 +137,18 @@ struct core1_state
   float frequency=0.0;
   float pf=0.0;
 
-  int pageNumber = 0; // We have multiple pages for display in this app - changed by pressing the capacitative 'touch' button
+  int pageNumber = 0; // We have multiple pages for display in this app - changed by pressing the capacitative 'touch' button (render task only)
 
   bool pzemConnected = false;
 
-  /// Sparklines let us draw simple 2d line charts that update as new values are pushed in - this will show the power usage
-  std::shared_ptr<SparkLine<uint16_t> > powerUsage; // Keep track of the latest X values (where X is set in the constructor below)
+  /// The last readings sent over MQTT - used to apply the publish deadbands from the settings
+  float publishedVoltage = 0.0;
+  float publishedPower = 0.0;
+  unsigned long lastPublish = 0;
+
+  /// Power usage chart on page 1 - up to a day of samples, zoomed with pad 1. The left 60 pixels are kept for the labels
+  ScrollingChart<float, 220, 240, St7789ChartBackend> powerUsage;
+  St7789ChartBackend powerChart{60, 0, 220, 240};
 
 };
 
@@ -143,28 +157,14 @@ struct core2_state
   bool networkConnected = false;
   bool mqttConnected = false;
 
-  /// MQTT details
-  String mqtt_server = "";
-
-  String mqtt_user = "iot"; // Again, this is hardwired to an MQTT user on Pidesktop1
-  String mqtt_password = "iot1";
-
-  String mqtt_topicOUT ="/esp32/Electricity/";
-
-  /// TEMPORARY HACK - FOR NOW I KNOW THAT THE PZEM IN THE HOUSE IS V3 and is for the household power and the
-  /// PZEM in the workshop is V2 and for monitoring the solar - hence this temporary hardwiring...
-#ifndef SOLAR
-  String mqtt_topicName = "house";   // "house" for the household power usage and "solar" for the Solar PV generated power
-#else
-  String mqtt_topicName = "solar";   // "house" for the household power usage and "solar" for the Solar PV generated power
-#endif
-  String mqtt_port  = "1883";  
-
   char mqtt_client_id[23]; // This is auto generated in connection functions below 
   std::vector< std::pair< String, int32_t> > ssidList;
 
-  String ssdp_name;
-  String ssdp_modelname;
+  // The IP address as text for the display - formatted by the network thread when the address changes (see
+  // updateIPAddress) into the buffer that is not being shown, which is then flipped to
+  uint32_t ipAddress = 0;
+  char ipText[2][16] = {"0.0.0.0", "0.0.0.0"};
+  std::atomic<uint8_t> ipAddressShown{0};
 };
 
 
@@ -174,203 +174,450 @@ void reconnectMQTT(int retryCount);
 
 const int numberTouchPins = 3; /// Ensure this value is consistent with the C array below
 const int touchPins[]={T9,T8,T7}; 
-bool touchPinsState[] = {false,false,false}; // Keep track of the read in value
-
-TouchState touchPinsInternalState[] = {TouchUndefined,TouchUndefined,TouchUndefined};
-
-const uint16_t touchPressThreshold = 20; // Magic number:  This is determined / calibrated by doing a simple runtime test of the board and seeing what is returned from touchRead()
 
 /// Main state variables
 core1_state tftState;
 core2_state networkState;
+
+/// Settings from settings.json (or the NVS cache of it) are read through CurrentSettings(). See device_settings.hpp for the schema
+SettingsLoadStats settingsLoadStats;
+
+/// SettingsSubsystem bits changed by PUT /config that the network thread has yet to restart
+std::atomic<uint32_t> pendingSettingsChanges(0);
+
+/// The settings from before a WiFi change made with PUT /config. The change is only saved to flash once the new network
+/// has connected - if it has not within wifiTrialMs the network thread puts these back, so bad credentials cannot
+/// leave the device offline after a reboot. Set by put_config(), owned by the network thread from then on
+std::atomic<DeviceSettings*> wifiFallback(nullptr);
+const unsigned long wifiTrialMs = 30000;
 TaskHandle_t Task1;  // Second thread for managing network / mqtt and touch buttons
 
 WiFiClient espClient;
 PubSubClient mqttClient(espClient);
 
-// Simple handler for index page 
-esp_err_t get_index_html(PsychicRequest *request)
+// Rest endpoint returning the current settings (passwords masked)
+esp_err_t get_config(PsychicRequest *request)
 {
   PsychicResponse response(request);
   response.setCode(200);
   response.setContentType("text/json");
 
-  String json = "{\"v\":" + String(tftState.voltage) + "}";   
+  String json = DeviceSettingsToJson(CurrentSettings());
   response.setContent((const uint8_t*)json.c_str(),json.length());
   return response.send();
 }
 
+// Rest endpoint to change settings without a reflash / reboot. The body is a JSON object holding just the settings to change.
+// The new settings are validated, swapped in atomically and saved to flash - only the affected subsystems are restarted.
+// It needs the OTA user and password (HTTP basic auth, as ElegantOTA checks them) - and is refused if they are not set
+esp_err_t put_config(PsychicRequest *request)
+{
+  const DeviceSettings & current = CurrentSettings();
 
-void NetworkThreadCode( void * parameter); // Fwd declare function for the second thread
-void extractPZEM_Info();
+  if(current.ota_user[0] == '\0' || current.ota_password[0] == '\0')
+  {
+    return request->reply(403, "text/json", "{\"error\":\"set ota_user and ota_password to allow settings changes\"}");
+  }
 
-void displayPage0(bool fullRedraw)
-{
-  if(fullRedraw)
+  if(!request->authenticate(current.ota_user, current.ota_password))
   {
-    tftState.tft->fillScreen(ST77XX_BLACK);
+    return request->requestAuthentication();
   }
-  tftState.tft->setTextColor(ST77XX_WHITE,ST77XX_BLACK);
 
-  tftState.tft->setCursor(35, 2);
-  tftState.tft->setTextSize(2);
-  tftState.tft->println("0");
+  PsychicResponse response(request);
+  response.setContentType("text/json");
 
+  DeviceSettings * updated = new DeviceSettings(current);
 
-  tftState.tft->setCursor(65, 2);
-  tftState.tft->setTextSize(2);
-  tftState.tft->println("ETH");
-  uint16_t col = networkState.networkConnected ? ST77XX_GREEN : ST77XX_RED;
-  tftState.tft->fillRect(105,2,20,20,col);
+  String body = request->body();
+  String error;
+  String json;
+  uint32_t changes = SETTINGS_NONE;
 
-  tftState.tft->setCursor(135, 2);
-  tftState.tft->setTextSize(2);
-  tftState.tft->println("MQTT");
-  col = networkState.mqttConnected ? ST77XX_GREEN : ST77XX_RED;
-  tftState.tft->fillRect(185,2,20,20,col);  
+  if(!ApplyDeviceSettingsJson(*updated, body.c_str(), body.length(), error))
+  {
+    response.setCode(400);
+  }
+  else if((changes = DiffDeviceSettings(current, *updated)) == SETTINGS_NONE)
+  {
+    response.setCode(200);
+    json = "{\"changed\":0}";
+  }
+  else if(wifiFallback.load() != nullptr)
+  {
+    // Nothing else may be saved while the WiFi change is unproven - and going back would undo it
+    response.setCode(503);
+    error = "previous WiFi change is still being tried, try again";
+  }
+  else
+  {
+    // Copied before the new settings are published - "current" is freed once the other tasks have moved on from it
+    DeviceSettings * fallback = (changes & SETTINGS_WIFI) ? new DeviceSettings(current) : nullptr;
 
-/// PZEM address looks pretty bland so removing it from the display (for now?)
+    if(!PublishDeviceSettings(updated))
+    {
+      response.setCode(503);
+      error = "previous settings change is still being applied, try again";
+    }
+    else if(fallback)
+    {
+      updated = nullptr; // Owned by the settings module now
+      wifiFallback = fallback;
+      fallback = nullptr;
+      pendingSettingsChanges.fetch_or(changes);
+
+      // Saved by the network thread once the new network connects (see checkWifiTrial)
+      response.setCode(202);
+      json = "{\"changed\":" + String(changes) + ",\"saved\":false}";
+    }
+    else
+    {
+      updated = nullptr; // Owned by the settings module now
+      pendingSettingsChanges.fetch_or(changes);
 
-  tftState.tft->setTextSize(2); 
-  tftState.tft->setCursor(0,25); 
-  tftState.tft->print(String(tftState.pzemAddress));
+      if(!SaveDeviceSettings(CurrentSettings()))
+      {
+        response.setCode(500);
+        error = "settings applied but could not be saved to flash";
+      }
+      else
+      {
+        response.setCode(200);
+        json = "{\"changed\":" + String(changes) + "}";
+      }
+    }
 
+    delete fallback;
+  }
 
-  tftState.tft->setTextSize(3);
-  tftState.tft->setCursor(0,50); 
-  tftState.tft->print(String(tftState.voltage) + " V");
+  delete updated;
 
-  tftState.tft->setCursor(0,90); 
-  tftState.tft->print(String(tftState.current) + " A");
+  if(error.length())
+  {
+    error.replace("\"", "'");
+    json = "{\"error\":\"" + error + "\"}";
+  }
 
-  tftState.tft->setCursor(0,130); 
-  tftState.tft->print(String(tftState.power) + " W");
+  response.setContent((const uint8_t*)json.c_str(),json.length());
+  return response.send();
+}
 
-  tftState.tft->setCursor(120,130); 
-  tftState.tft->print(String(tftState.energy) + " VA");
+// Rest endpoint returning the latest run time metrics - task CPU / stack usage and heap
+esp_err_t get_metrics(PsychicRequest *request)
+{
+  PsychicResponse response(request);
+  response.setCode(200);
+  response.setContentType("text/json");
 
-#ifdef PZEM_V3
-  tftState.tft->setCursor(0,160); 
-  tftState.tft->print(String(tftState.frequency) + " Hz");
+  String json = DeviceMetricsToJson();
+  response.setContent((const uint8_t*)json.c_str(),json.length());
+  return response.send();
+}
 
-  tftState.tft->setCursor(0,190); 
-  tftState.tft->print(String(tftState.pf) + " PF");
-#endif  
+// Rest endpoint dumping the tracepoint rings as Chrome trace_event JSON - open it in chrome://tracing or Perfetto
+esp_err_t get_trace(PsychicRequest *request)
+{
+  PsychicStreamResponse response(request, "application/json");
 
-  //if(!tftState.pzemConnected)
-  {
-    tftState.tft->setCursor(210, 2);
-    tftState.tft->setTextSize(2);
-#ifdef PZEM_V3    
-    tftState.tft->println("P3");  
-#else
-    tftState.tft->println("P2");  
-#endif
-    col = tftState.pzemConnected ? ST77XX_GREEN : ST77XX_RED;
-    tftState.tft->fillRect(235,2,20,20,col);  
-  }
+  response.beginSend();
+  TraceDumpChromeJson(response);
+  return response.endSend();
+}
 
-  
-  tftState.tft->setCursor(160, 220);
-  tftState.tft->setTextSize(2);
-  String ip = WiFi.localIP().toString();
-  tftState.tft->println(ip);
+// Simple handler for index page 
+esp_err_t get_index_html(PsychicRequest *request)
+{
+  PsychicResponse response(request);
+  response.setCode(200);
+  response.setContentType("text/json");
+
+  String json = "{\"v\":" + String(tftState.voltage) + "}";   
+  response.setContent((const uint8_t*)json.c_str(),json.length());
+  return response.send();
 }
 
-void displayPage1(bool fullRedraw)
+
+void NetworkThreadCode( void * parameter); // Fwd declare function for the second thread
+void extractPZEM_Info();
+
+/// Data for the page widgets (see pages.hpp) - the layout tables in pages.cpp only hold pointers to these
+float pzemVoltage() { return tftState.voltage; }
+float pzemCurrent() { return tftState.current; }
+float pzemPower() { return tftState.power; }
+float pzemEnergy() { return tftState.energy; }
+float pzemFrequency() { return tftState.frequency; }
+float pzemPowerFactor() { return tftState.pf; }
+
+bool networkUp() { return networkState.networkConnected; }
+bool mqttUp() { return networkState.mqttConnected; }
+bool pzemUp() { return tftState.pzemConnected; }
+
+void pzemAddressText(int, char * text, size_t size)
 {
-  // Always do a full refresh as we are showing a line graph that will update frequently
-  //if(fullRedraw)
-  {
-    tftState.tft->fillScreen(ST77XX_ORANGE);
-  }
+  snprintf(text, size, "%u", tftState.pzemAddress);
+}
 
-  tftState.tft->setTextColor(ST77XX_WHITE, ST77XX_ORANGE);
+void ipAddressText(int, char * text, size_t size)
+{
+  strlcpy(text, networkState.ipText[networkState.ipAddressShown], size);
+}
 
-  tftState.tft->setCursor(35, 2);
-  tftState.tft->setTextSize(2);
-  tftState.tft->println("1");
+int networkCount() { return networkState.ssidList.size(); }
 
-  // Display the sparkline 2d line graph showing power usage information
-  if(tftState.powerUsage)
-  {              
-      tftState.tft->setTextSize(3);
-      tftState.powerUsage->draw(5, 230, 260, 220);
-      tftState.tft->setCursor(2,22);
-      tftState.tft->print(String(tftState.power));
-  }
+void networkName(int index, char * text, size_t size)
+{
+  strlcpy(text, networkState.ssidList[index].first.c_str(), size);
+}
 
+void networkStrength(int index, char * text, size_t size)
+{
+  snprintf(text, size, "%d", (int)networkState.ssidList[index].second);
 }
 
-void displayPage2(bool fullRedraw)
+std::atomic<uint32_t> chartSamplePeriodMs(1000); // The chart's time per sample - set by the sample job
+
+void drawPowerChart(Adafruit_GFX &, bool full)
 {
-  if(fullRedraw)
+  if(full)
   {
-    tftState.tft->fillScreen(ST77XX_ORANGE);
+    tftState.powerChart.invalidateLabels(ST77XX_ORANGE);
   }
+  tftState.powerChart.setSamplePeriod(chartSamplePeriodMs);
+  tftState.powerUsage.draw(tftState.powerChart, full, ST77XX_BLACK, ST77XX_ORANGE);
+}
 
-  tftState.tft->setTextColor(ST77XX_WHITE, ST77XX_ORANGE);
+/// One address window and one burst of pixels - the digit font's cells on the panel
+void blitToPanel(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t * pixels)
+{
+  CountingST7789 & tft = *tftState.tft;
+  tft.startWrite();
+  tft.setAddrWindow(x, y, w, h);
+  tft.writePixels(const_cast<uint16_t*>(pixels), (uint32_t)w * h);
+  tft.endWrite();
+  tft.countPixels((uint32_t)w * h);
+}
 
-  tftState.tft->setCursor(35, 2);
-  tftState.tft->setTextSize(2);
-  tftState.tft->println("2");
+PageView pageViews[DISPLAY_PAGE_COUNT] = { PageView(pageSpecs[0]), PageView(pageSpecs[1]), PageView(pageSpecs[2]) };
 
-  int y = 50;
+// Draw the current page of the TFT screen - there are multiple pages of info that can be shown
+void display(bool fullRedraw)
+{
+  static const TraceEventId pageTraces[DISPLAY_PAGE_COUNT] = { TRACE_DISPLAY_PAGE0, TRACE_DISPLAY_PAGE1, TRACE_DISPLAY_PAGE2 };
+  TRACE_SCOPE(pageTraces[tftState.pageNumber]);
 
-  for(int ctr=0; ctr< networkState.ssidList.size(); ++ctr)
+  // Page 1 scrolls the panel in hardware - put it back before any other page is drawn
+  if(tftState.pageNumber != 1)
   {
-    const std::pair<String, int32_t> & item(networkState.ssidList[ctr]);
+    tftState.powerChart.detach();
+  }
+
+  pageViews[tftState.pageNumber].render(*tftState.tft, fullRedraw);
+}
 
-    tftState.tft->setCursor(10, y);
-    tftState.tft->print( item.first);
 
-    tftState.tft->setCursor(220, y);
-    tftState.tft->print( item.second);
-    
-    y+= 20;
-  }
+/// Jobs run by the core 1 scheduler (see scheduler.hpp) - registered in setup()
+int touchJob = -1;
+int sampleJob = -1;
+int statusJob = -1;
+
+/// Reasons for the render task to draw, set in renderEvents by the other tasks
+const EventBits_t RENDER_DATA = 1 << 0;       // New readings or connection status - paced to minRenderIntervalMs
+const EventBits_t RENDER_NEXT_PAGE = 1 << 1;  // Touch - move on a page, drawn straight away
+const EventBits_t RENDER_FULL = 1 << 2;       // Redraw the current page from scratch
+const EventBits_t RENDER_OVERLAY = 1 << 3;    // Long press - show / hide the render stats overlay
+const EventBits_t RENDER_ZOOM = 1 << 4;       // Touch - next time span on the power chart
+const EventBits_t RENDER_IMMEDIATE = RENDER_NEXT_PAGE | RENDER_FULL | RENDER_OVERLAY | RENDER_ZOOM;
+const EventBits_t RENDER_ALL = RENDER_DATA | RENDER_IMMEDIATE;
+
+const uint32_t minRenderIntervalMs = 200; // Data driven refreshes are paced to this - user input is not
 
+EventGroupHandle_t renderEvents = NULL;
+QueueHandle_t chartSamples = NULL;        // Power readings for the page 1 chart - the chart belongs to the render task
+TaskHandle_t renderTask = NULL;
 
+std::atomic<uint32_t> inputMicros(0);     // Time of the touch that changed the page (esp_timer / micros()) - 0 once it has been rendered
+
+// Ask the render task to redraw - safe from any task
+void RenderNotify(EventBits_t reasons)
+{
+  xEventGroupSetBits(renderEvents, reasons);
+}
+
+// The display needs a refresh because of something on the network side (connection state etc)
+void markDisplayDirty()
+{
+  RenderNotify(RENDER_DATA);
 }
 
-unsigned long lastDisplay = 0;
+// Top left of the render stats overlay on each page - a spot the page leaves free. On page 1 it must stay in the
+// fixed label band left of the chart, as the chart area scrolls
+const int16_t overlayOrigin[DISPLAY_PAGE_COUNT][2] = {{200, 50}, {0, 160}, {220, 2}};
 
-// Display loop for the TFT screen - there are multiple pages of info that can be shown
-void display(unsigned long now, bool fullRedraw)
+/// Render stats drawn over a corner of the page - toggled by a long press on pad 2
+struct RenderOverlay
 {
-  if(!tftState.isDirty)
+  bool visible = false;
+  TextField lines[4] = {{0, 0, 1, 10}, {0, 8, 1, 10}, {0, 16, 1, 10}, {0, 24, 1, 10}};
+
+  void draw(Adafruit_GFX & gfx, int page, bool fullRedraw)
   {
-    return;
+    int16_t x = overlayOrigin[page][0];
+    int16_t y = overlayOrigin[page][1];
+
+    if(fullRedraw)
+    {
+      for(int i = 0; i < 4; ++i)
+      {
+        lines[i].moveTo(x, y + 8 * i);
+        lines[i].invalidate(ST77XX_BLUE);
+      }
+      gfx.fillRect(x, y, lines[0].right() - x, 32, ST77XX_BLUE);
+    }
+
+    PageRenderStats stats = GetPageRenderStats(page);
+    char text[TextField::maxLength + 1];
+    snprintf(text, sizeof(text), "%uus", (unsigned)stats.micros);
+    lines[0].draw(gfx, text, ST77XX_WHITE, ST77XX_BLUE);
+    snprintf(text, sizeof(text), "%uB", (unsigned)stats.spiBytes);
+    lines[1].draw(gfx, text, ST77XX_WHITE, ST77XX_BLUE);
+    snprintf(text, sizeof(text), "%upx", (unsigned)stats.pixels);
+    lines[2].draw(gfx, text, ST77XX_WHITE, ST77XX_BLUE);
+    snprintf(text, sizeof(text), "%.1ffps", RenderFramesPerSecond());
+    lines[3].draw(gfx, text, ST77XX_WHITE, ST77XX_BLUE);
   }
+};
+
+RenderOverlay overlay;
+
+// Draw one frame, recording what it cost - the overlay is drawn afterwards so it does not count towards the page
+void renderFrameNow(bool fullRedraw)
+{
+  PowerLockGuard powerLock(POWER_LOCK_SPI);
+
+  tftState.tft->resetCounters();
+  int64_t start = esp_timer_get_time();
+
+  display(fullRedraw);
 
-  if((now - lastDisplay) < 200)
+  RecordRender(tftState.pageNumber, tftState.tft->spiBytes(), tftState.tft->pixelsWritten(), esp_timer_get_time() - start);
+
+  if(overlay.visible)
   {
-    return;
+    overlay.draw(*tftState.tft, tftState.pageNumber, fullRedraw);
   }
 
-  lastDisplay = now; // Only refresh every 100ms max
+  uint32_t input = inputMicros.exchange(0);
+  if(input)
+  {
+    RecordLatency(LATENCY_INPUT_TO_SCREEN, micros() - input);
+  }
+}
 
-  tftState.isDirty = false;
+// Render task - owns the TFT. Sleeps until another task sets a reason to draw, so a slow page never holds up sampling
+// or touch handling on the scheduler, which runs at a higher priority on the same core
+void RenderTaskCode(void * parameter)
+{
+  uint32_t lastFrame = millis() - minRenderIntervalMs;
 
-  switch(tftState.pageNumber)
+  while(true)
   {
-    case 0:
-    displayPage0(fullRedraw);
-    break;
+    EventBits_t reasons = xEventGroupWaitBits(renderEvents, RENDER_ALL, pdTRUE, pdFALSE, portMAX_DELAY);
 
-    case 1:
-    displayPage1(fullRedraw);
-    break;
+    // Pace data driven frames - but stop waiting as soon as the user asks for something
+    uint32_t sinceLast = millis() - lastFrame;
+    if(!(reasons & RENDER_IMMEDIATE) && sinceLast < minRenderIntervalMs)
+    {
+      xEventGroupWaitBits(renderEvents, RENDER_IMMEDIATE, pdFALSE, pdFALSE, pdMS_TO_TICKS(minRenderIntervalMs - sinceLast));
+    }
+    reasons |= xEventGroupClearBits(renderEvents, RENDER_ALL);
 
-    case 2:
-    default:
-    displayPage2(fullRedraw);
-    break;
+    bool fullRedraw = (reasons & RENDER_FULL) != 0;
+    if(reasons & RENDER_NEXT_PAGE)
+    {
+      tftState.pageNumber = (tftState.pageNumber + 1) % DISPLAY_PAGE_COUNT;
+      fullRedraw = true;
+    }
+    if(reasons & RENDER_OVERLAY)
+    {
+      // Hiding it needs the page underneath back
+      overlay.visible = !overlay.visible;
+      fullRedraw = true;
+    }
+    if((reasons & RENDER_ZOOM) && tftState.pageNumber == 1)
+    {
+      tftState.powerUsage.zoom();
+    }
+
+    float sample;
+    while(xQueueReceive(chartSamples, &sample, 0) == pdTRUE)
+    {
+      tftState.powerUsage.add(sample);
+    }
+
+    renderFrameNow(fullRedraw);
+    lastFrame = millis();
   }
 }
 
+// Scheduler job - requested by the touch interrupt, then re-scheduled by the touch code while a pad is held
+void touchJobRun(uint32_t now)
+{
+  TraceEmit(TRACE_TOUCH_SCAN, TRACE_BEGIN);
+  uint32_t nextPoll = TouchInputPoll(now);
+  TraceEmit(TRACE_TOUCH_SCAN, TRACE_END);
 
-bool fullRedraw = false;
+  SchedulerTrigger(touchJob, nextPoll);
+
+  TouchEvent event;
+  while(TouchInputGetEvent(event))
+  {
+    if(event.pad == 0 && event.type == TOUCH_PRESS)
+    {
+      inputMicros = event.touchMicros;
+      RenderNotify(RENDER_NEXT_PAGE);
+    }
+    else if(event.pad == 1 && event.type == TOUCH_PRESS)
+    {
+      inputMicros = event.touchMicros;
+      RenderNotify(RENDER_ZOOM);
+    }
+    else if(event.pad == 2 && event.type == TOUCH_LONG_PRESS)
+    {
+      RenderNotify(RENDER_OVERLAY);
+    }
+  }
+}
+
+// Scheduler job - read the PZEM every "sample_period_ms" (a second by default)
+void sampleJobRun(uint32_t now)
+{
+  uint32_t period = CurrentSettings().sample_period_ms; // Pick up changes from PUT /config
+  SchedulerSetPeriod(sampleJob, period);
+  chartSamplePeriodMs = period;
+
+  if(!tftState.pzemConnected)
+  {
+    return;
+  }
+
+  extractPZEM_Info();
+}
+
+// Scheduler job - low rate housekeeping: PZEM connection check
+void statusJobRun(uint32_t now)
+{
+  if(!SerialPZEM)
+  {
+     Serial.println("HWSerialPZEM not initialised");
+  }
+
+  PowerLockGuard powerLock(POWER_LOCK_MODBUS);
+  if(SerialPZEM && pzem.isConnected() && !tftState.pzemConnected)
+  {
+    tftState.pzemConnected = true;      
+    RenderNotify(RENDER_DATA);
+  }
+}
 
 void setup()
 {
@@ -389,67 +636,67 @@ void setup()
   //SCLK = 14, MISO = 12, MOSI = 13, SS = 15
   tftState.hspi->begin();
 
-  tftState.tft = new Adafruit_ST7789(tftState.hspi,HSPI_SS, TFT_DC, -1);
+  tftState.tft = new CountingST7789(tftState.hspi,HSPI_SS, TFT_DC, -1);
   tftState.tft->init(240, 280);           // Init ST7789 280x240
   // default rotation is if the screen was rotated 90 deg clockwise
   // rotation 1 is upside down
   // rotation 2 is rotated 90 anti-clockwise
   tftState.tft->setRotation(3);
+  tftState.tft->setSPISpeed(40000000); // 80MHz / 2 - HSPI on its IOMUX pins, within the ST7789's write cycle limit
+
+  DigitFontBegin(tftState.tft, blitToPanel);
+  tftState.powerChart.setDisplay(tftState.tft);
+#ifdef DIGIT_FONT_BENCHMARK
+  DigitFontBenchmark(*tftState.tft);    // Sprite vs setTextSize(3) digit timings to Serial - overwritten below
+#endif
 
   tftState.tft->fillScreen(ST77XX_RED);
+  StripRendererBegin(tftState.tft, 20); // 2 x 280x20 pixel strips (22KB) for full page redraws
   Serial.println(F("TFT initialised - reading "));
 
-  JsonDocument doc;
-  if(!LoadJsonSettings(doc))
+  /// TEMPORARY HACK - FOR NOW I KNOW THAT THE PZEM IN THE HOUSE IS V3 and is for the household power and the
+  /// PZEM in the workshop is V2 and for monitoring the solar - hence this temporary hardwiring of the default topic...
+  DeviceSettings * settings = new DeviceSettings();
+#ifdef SOLAR
+  strlcpy(settings->mqtt_topicName, "solar", sizeof(settings->mqtt_topicName));
+#endif
+
+  if(!LoadDeviceSettings(*settings, settingsLoadStats))
   {
       /// TODO HANDLE THIS ERROR - e.g. FLASH THE LED
       Serial.println("ERROR: Investigate what went wrong in loading JSON file");
   }
 
-  JsonObject root = doc.as<JsonObject>();
+  PublishDeviceSettings(settings); // From here on the settings are only read via CurrentSettings()
 
-  if(!LoadDefaultParameters(root))
-  {
-    //// TODO HANDLE THIS ERROR
-    Serial.println("ERROR: Investigate what went wrong in processing the JSON object");
-  }
+  Serial.printf("SSDP Name: (%s), model name (%s)",settings->ssdp_name, settings->ssdp_modelname);
+  Serial.println("");
 
-  try
-  {
-    networkState.ssdp_name      =   root["ssdp_name"].as<String>();
-    networkState.ssdp_modelname =   root["ssdp_modelname"].as<String>();
+  Serial.printf("MQTT Server: (%s), User (%s), Password (%s)",settings->mqtt_server, settings->mqtt_user, settings->mqtt_password);
+  Serial.println("");
+  
+  InitDeviceMetrics(settingsLoadStats);
 
-    Serial.printf("SSDP Name: (%s), model name (%s)",networkState.ssdp_name.c_str(), networkState.ssdp_modelname.c_str());
-    Serial.println("");
+  PowerInit();
+  PowerSetMode((PowerMode)settings->power_save);
 
-    String tmp = root["mqtt_server"].as<String>();
+  // Sampling and touch must not wait for a frame - the scheduler (this task) runs above the render task on this core
+  vTaskPrioritySet(NULL, 2);
 
-    if(tmp.length())
-      networkState.mqtt_server  = tmp;
-    
-    tmp = root["mqtt_user"].as<String>();
+  // Created before the network thread starts as it can request renders
+  renderEvents = xEventGroupCreate();
+  chartSamples = xQueueCreate(16, sizeof(float));
+  xTaskCreatePinnedToCore(RenderTaskCode, "Render", 4096, NULL, 1, &renderTask, 1);
 
-    if(tmp.length())
-      networkState.mqtt_user     = tmp;
+  touchJob = SchedulerAddJob("touch", touchJobRun, 0);
+  sampleJob = SchedulerAddJob("sample", sampleJobRun, settings->sample_period_ms, 50);
+  statusJob = SchedulerAddJob("status", statusJobRun, 1000, 100);
 
-    tmp = root["mqtt_password"].as<String>();
-    
-    if(tmp.length())
-      networkState.mqtt_password = tmp;
-
-    Serial.printf("MQTT Server: (%s), User (%s), Password (%s)",networkState.mqtt_server.c_str(), networkState.mqtt_user.c_str(), networkState.mqtt_password.c_str());
-    Serial.println("");
-  }
-  catch(const std::exception& e)
-  {
-    Serial.println(e.what());
-  }
-  
   Serial.println(F("Starting Network thread"));
   xTaskCreatePinnedToCore(
       NetworkThreadCode, /* Function to implement the task */
       "Network", /* Name of the task */
-      10000,  /* Stack size in words */
+      10000,  /* Stack size in bytes (ESP-IDF) - see /metrics for the high water mark */
       NULL,  /* Task input parameter */
       0,  /* Priority of the task */
       &Task1,  /* Task handle. */
@@ -475,85 +722,23 @@ void setup()
   // pzem.resetEnergy();
 
   Serial.println(F("CORE1: End setup"));
-  fullRedraw=true;
-}
-
-
-unsigned long lastPZEMSample=0; // milli second at which we took a PZEM reading
-
-// Main loop for one thread (running on Core 1)
-void loop() { 
-  
-  unsigned long now = millis();
-
-  // Scan through Touch pins
-  for(int counter=0; counter<numberTouchPins; ++counter)
+  if(!TouchInputBegin(touchPins, numberTouchPins, touchJob))
   {
-    uint16_t touch_sensor = touchRead(touchPins[counter]);     
-
-    if(touch_sensor < touchPressThreshold)
-    {
-      switch(touchPinsInternalState[counter])
-      {
-        case TouchUndefined:
-        case ButtonUp:
-        default:
-          touchPinsInternalState[counter] = ButtonFirstPress; // Button must be pressed for two cycles to become 'ButtonDown' - to stop fake presses          
-          break;
-        case ButtonFirstPress:
-          touchPinsInternalState[counter] = ButtonPressed;
-          touchPinsState[counter] = true;
-          break;
-        case ButtonPressed:
-          // We differentiate between when the button is first pressed and then separately being held down
-          touchPinsInternalState[counter] = ButtonDown;
-          break;
-
-        case ButtonDown:
-          // Do nothing as button is still being pressed
-          break;
-      }
-    }
-    else
-    {
-      touchPinsInternalState[counter] = ButtonUp;
-    }
+    Serial.println("ERROR: touch input could not be started");
   }
+  SchedulerTrigger(touchJob); // Starts the baseline tracking
 
-  if(touchPinsState[0])
-  {    
-    touchPinsState[0] = false; // Reset the state 
-    ++tftState.pageNumber;
-    tftState.isDirty = true;
-    fullRedraw = true;
-
-    if(tftState.pageNumber >2)
-    {
-      tftState.pageNumber = 0;
-    }
-  }
-
-  if(!SerialPZEM)
-  {
-     Serial.println("HWSerialPZEM not initialised");
-  }
-
-  if(SerialPZEM && pzem.isConnected() ) //!tftState.pzemConnected)
-  {
-    tftState.pzemConnected = true;      
-  }
+  RenderNotify(RENDER_FULL);
+}
 
-  // Only sample the power information every second max
-  if(tftState.pzemConnected && ((now - lastPZEMSample) > 1000))
-  {
-    lastPZEMSample = now;
-    extractPZEM_Info();
-  }
 
-  display(now, fullRedraw); 
-  fullRedraw = false;
+// Main loop for one thread (running on Core 1) - the scheduler sleeps until the next job is due
+void loop() { 
+  
+  SettingsQuiescentState(SETTINGS_READER_CORE1); // No references to the settings are held between passes
+  TraceSync();
 
-  delay(50);
+  SchedulerRunOnce();
 }
 
 void scanNetworks() {
@@ -578,13 +763,30 @@ void scanNetworks() {
   }
 }
 
+// Network thread - reformat the display's copy of the IP address if it has changed
+void updateIPAddress()
+{
+  IPAddress ip = WiFi.localIP();
+  if((uint32_t)ip == networkState.ipAddress)
+    return;
+
+  uint8_t next = networkState.ipAddressShown ^ 1;
+  snprintf(networkState.ipText[next], sizeof(networkState.ipText[next]), "%u.%u.%u.%u",
+           ip[0], ip[1], ip[2], ip[3]);
+  networkState.ipAddressShown = next;
+  networkState.ipAddress = ip;
+  markDisplayDirty();
+}
+
 void setup_network()
 {
   scanNetworks();
-  tftState.isDirty = true;
+  markDisplayDirty();
+
+  const DeviceSettings & cfg = CurrentSettings();
 
   WiFi.mode(WIFI_STA);
-  WiFi.begin(ssid, password); // These were loaded from the JSON settings file.
+  WiFi.begin(cfg.ssid, cfg.password); // These were loaded from the JSON settings file.
   Serial.println("Connected");
 
   // Wait for connection
@@ -594,14 +796,127 @@ void setup_network()
   }
   Serial.println("");
   Serial.print("Connected to ");
-  Serial.println(ssid);
+  Serial.println(cfg.ssid);
   Serial.print("IP address: ");
   Serial.println(WiFi.localIP());
 
   networkState.networkConnected = WiFi.status() == WL_CONNECTED;
-  tftState.isDirty = true;   
+  updateIPAddress();
+  markDisplayDirty();   
+}
+
+
+// Send the latest run time metrics to "<topic>/metrics" - at a low rate as the message is large
+void publishMetrics()
+{
+  if(!mqttClient.connected())
+  {
+    return;
+  }
+
+  const DeviceSettings & cfg = CurrentSettings();
+  String topic = cfg.mqtt_topicOUT;
+  topic += cfg.mqtt_topicName;
+  topic += "/metrics";
+
+  String json = DeviceMetricsToJson();
+  if(!mqttClient.publish(topic.c_str(), json.c_str()))
+  {
+    Serial.println("MQTT: metrics publish failed (" + String(json.length()) + " bytes)");
+  }
+}
+
+const DeviceSettings * appliedSettings = nullptr; // The settings the network clients were last configured from
+bool wifiOnTrial = false;                         // A WiFi change from PUT /config is waiting to connect (see checkWifiTrial)
+unsigned long wifiTrialStart = 0;                 // ...since then
+
+// Pick up settings changed at runtime (PUT /config) and restart only the subsystems whose settings changed
+void applySettingsChanges()
+{
+  const DeviceSettings & cfg = CurrentSettings();
+  uint32_t changes = pendingSettingsChanges.exchange(0);
+
+  if(&cfg == appliedSettings && changes == SETTINGS_NONE)
+  {
+    return;
+  }
+
+  appliedSettings = &cfg;
+
+  // PubSubClient keeps a pointer to the server name rather than a copy - so always re-point it at the live settings
+  // (the old settings object is freed once this thread reports its next quiescent state)
+  mqttClient.setServer(cfg.mqtt_server, cfg.mqtt_port);
+
+  if(changes & SETTINGS_OTA)
+  {
+    ElegantOTA.setAuth(cfg.ota_user, cfg.ota_password);
+  }
+
+  if(changes & SETTINGS_WIFI)
+  {
+    Serial.println("Settings: WiFi changed - reconnecting");
+    WiFi.disconnect();
+    WiFi.begin(cfg.ssid, cfg.password);
+    networkState.networkConnected = false;
+    markDisplayDirty();
+
+    // A change from PUT /config is on trial until it connects - going back to the fallback settings ends the trial
+    wifiOnTrial = wifiFallback.load() != nullptr;
+    wifiTrialStart = millis();
+  }
+
+  if(changes & SETTINGS_MQTT)
+  {
+    Serial.println("Settings: MQTT changed - reconnecting");
+    mqttClient.disconnect();
+    networkState.mqttConnected = (WiFi.status() == WL_CONNECTED) && setup_mqtt();
+    markDisplayDirty();
+  }
+
+  if(changes & SETTINGS_SSDP)
+  {
+    Serial.println("Settings: SSDP changes take effect after a reboot");
+  }
+
+  if(changes & SETTINGS_POWER)
+  {
+    PowerSetMode((PowerMode)cfg.power_save);
+  }
 }
 
+// Save a WiFi change from PUT /config once the new network has connected, or put the previous settings back if it
+// has not connected within wifiTrialMs
+void checkWifiTrial()
+{
+  if(!wifiOnTrial)
+  {
+    return;
+  }
+
+  DeviceSettings * fallback = wifiFallback.load();
+  if(WiFi.status() == WL_CONNECTED)
+  {
+    Serial.println("Settings: new WiFi network connected - saving the settings");
+    if(!SaveDeviceSettings(CurrentSettings()))
+    {
+      Serial.println("Settings: could not be saved to flash");
+    }
+    wifiOnTrial = false;
+    wifiFallback = nullptr;
+    delete fallback;
+  }
+  else if(millis() - wifiTrialStart >= wifiTrialMs)
+  {
+    uint32_t changes = DiffDeviceSettings(CurrentSettings(), *fallback);
+    if(PublishDeviceSettings(fallback)) // Otherwise the previous change has not been reclaimed yet - try next pass
+    {
+      Serial.println("Settings: new WiFi network did not connect - going back to the previous settings");
+      wifiOnTrial = false;
+      wifiFallback = nullptr; // Owned by the settings module now
+      pendingSettingsChanges.fetch_or(changes);
+    }
+  }
+}
 
 // Main loop for second thread (running on Core 0) - this function should not exit as that would cause the ESP32 to abort and reboot(!)
 void NetworkThreadCode( void * parameter)
@@ -615,16 +930,17 @@ void NetworkThreadCode( void * parameter)
   Serial.print("WIFI configured ");
   Serial.println(WiFi.status() == WL_CONNECTED);
 
+  mqttClient.setBufferSize(3072); // The default 256 bytes is too small for the metrics message
   setup_mqtt(); // TODO should check if network is ok etc
   networkState.mqttConnected = mqttClient.connected();
-  tftState.isDirty = true; 
+  markDisplayDirty(); 
 
     // Set Authentication Credentials
-   ElegantOTA.setAuth(ota_user.c_str(), ota_password.c_str());
+   ElegantOTA.setAuth(CurrentSettings().ota_user, CurrentSettings().ota_password);
   // start server
   server.listen(80); // MUST call listen() before registering any urls using .on()
 
-  ssdp_helper params{"/update",networkState.ssdp_name,"Esp32",networkState.ssdp_modelname,"https://aitchpea.com"};
+  ssdp_helper params{"/update",CurrentSettings().ssdp_name,"Esp32",CurrentSettings().ssdp_modelname,"https://aitchpea.com"};
   
   setup_ssdp(params,server);  // REMEMBER must call thios AFTER server.lkisten()
 
@@ -632,6 +948,13 @@ void NetworkThreadCode( void * parameter)
 
   server.on("/reset", HTTP_GET, reset_pzem);
 
+  server.on("/config", HTTP_GET, get_config);
+  server.on("/config", HTTP_PUT, put_config);
+
+  server.on("/metrics", HTTP_GET, get_metrics);
+
+  server.on("/trace", HTTP_GET, get_trace);
+
   // The below function registers a handler with the Web server to generically handle HTTP_OPTIONS and add the flags that we are not worried about CORS
   disable_cors(server); // CORS is pointless for an IOT device here
 
@@ -643,22 +966,45 @@ void NetworkThreadCode( void * parameter)
   ElegantOTA.onProgress(onOTAProgress);
   ElegantOTA.onEnd(onOTAEnd);
 
+  unsigned long lastMetrics = 0;
+  SampleDeviceMetrics();
+
   // This is the mainloop for the second thread (and will never exit)
   while(true)
   {
+    TraceSync();
+    TraceEmit(TRACE_NETWORK_LOOP, TRACE_BEGIN);
+    PowerLockAcquire(POWER_LOCK_NETWORK);
+
+    applySettingsChanges();
+    checkWifiTrial();
+    SettingsQuiescentState(SETTINGS_READER_NETWORK); // No references to the settings are held between passes
+
+    unsigned long now = millis();
+    if((now - lastMetrics) >= CurrentSettings().metrics_period_ms)
+    {
+      lastMetrics = now;
+      SampleDeviceMetrics();
+      publishMetrics();
+    }
+
     networkState.networkConnected = WiFi.status() == WL_CONNECTED;
+    updateIPAddress();
     
     if ( WiFi.status() ==  WL_CONNECTED ) 
     {
       // Allow the MQTT client to do 'keep alives' etc      
+      TraceEmit(TRACE_MQTT_LOOP, TRACE_BEGIN);
       bool ret =  mqttClient.loop(); // returns false if MQTT not connected
+      TraceEmit(TRACE_MQTT_LOOP, TRACE_END);
       yield(); 
 
       if(!ret)
       {
+        TRACE_SCOPE(TRACE_MQTT_RECONNECT);
         reconnectMQTT(1);
         networkState.mqttConnected = false;
-        tftState.isDirty = true; 
+        markDisplayDirty(); 
       }
 
     }
@@ -674,6 +1020,8 @@ void NetworkThreadCode( void * parameter)
       }      
     }  
 
+    PowerLockRelease(POWER_LOCK_NETWORK);
+    TraceEmit(TRACE_NETWORK_LOOP, TRACE_END); // Before the delay so that idle time does not show as loop time
     delay(50);
   }
 }
@@ -697,7 +1045,7 @@ void reconnectMQTT(int retryCount=5) {
   {
     Serial.println("MQTT re-connecting");
     // Attempt to connect
-    if (mqttClient.connect(networkState.mqtt_client_id, networkState.mqtt_user.c_str(), networkState.mqtt_password.c_str())) {
+    if (mqttClient.connect(networkState.mqtt_client_id, CurrentSettings().mqtt_user, CurrentSettings().mqtt_password)) {
       Serial.println("connected");
     } 
     else
@@ -715,21 +1063,23 @@ void reconnectMQTT(int retryCount=5) {
 // If MQTT server parameters have been defined then we try and connect
 bool setup_mqtt()
 {
-  if(networkState.mqtt_server[0] == '0' && networkState.mqtt_server[1] == '.')
+  const DeviceSettings & cfg = CurrentSettings();
+
+  if(cfg.mqtt_server[0] == '\0' || (cfg.mqtt_server[0] == '0' && cfg.mqtt_server[1] == '.'))
   {
     Serial.println("MQTT fail, no server is defined");
     
     return false;
   }
 
-  if(networkState.mqtt_user[0] == '\0')
+  if(cfg.mqtt_user[0] == '\0')
   {
     Serial.println("MQTT fail, no user is defined");
     return false;
   }
 
-  Serial.println("MQTT -> user: " + String(networkState.mqtt_user) + " Server: " + networkState.mqtt_server.c_str());
-  mqttClient.setServer(networkState.mqtt_server.c_str(), 1883);
+  Serial.println("MQTT -> user: " + String(cfg.mqtt_user) + " Server: " + cfg.mqtt_server);
+  mqttClient.setServer(cfg.mqtt_server, cfg.mqtt_port);
   mqttClient.setCallback(mqtt_callback);
 
   uint64_t chipid = ESP.getEfuseMac();
@@ -739,7 +1089,7 @@ bool setup_mqtt()
 
   // Ensure we use a random "client id" - Mosquitto MQTT server will disconnect if two clients connect with same id
   
-  if(!mqttClient.connect(networkState.mqtt_client_id, networkState.mqtt_user.c_str(), networkState.mqtt_password.c_str()))
+  if(!mqttClient.connect(networkState.mqtt_client_id, cfg.mqtt_user, cfg.mqtt_password))
   {
     Serial.println("MQTT fail");
     return false;
@@ -752,6 +1102,10 @@ bool setup_mqtt()
 
 void extractPZEM_Info()
 {
+  TRACE_SCOPE(TRACE_PZEM_READ);
+
+  PowerLockAcquire(POWER_LOCK_MODBUS); // No light sleep part way through a UART exchange
+
 #ifdef PZEM_V3
 
   Serial.println(String(" IS CONN") + String(pzem.isConnected()));
@@ -773,14 +1127,12 @@ void extractPZEM_Info()
   tftState.energy     = pzem.energy(ip);
 #endif
 
+  PowerLockRelease(POWER_LOCK_MODBUS);
+
   if(tftState.voltage> 0) // Dont bother sending any MQTT msgs if no readings are present
   {
-    tftState.isDirty = true;
-
-    if(!tftState.powerUsage)
-      tftState.powerUsage.reset(new SparkLine<uint16_t>(240, [&](const uint16_t x0, const uint16_t y0, const uint16_t x1, const uint16_t y1) { tftState.tft->drawLine(x0, y0, x1, y1, 1);}));
-
-    tftState.powerUsage->add(tftState.power);
+    xQueueSend(chartSamples, &tftState.power, 0); // Dropped if the render task has fallen 16 samples behind
+    RenderNotify(RENDER_DATA);
     
     String jsonStr = "{\"voltage\": ";
     jsonStr += String(tftState.voltage);
@@ -796,15 +1148,30 @@ void extractPZEM_Info()
     jsonStr += String(tftState.pf);
     jsonStr += "}";
 
+    const DeviceSettings & cfg = CurrentSettings();
+    unsigned long now = millis();
+
+    // Only publish when a reading has moved by more than its deadband - or as a heartbeat so the broker knows we are alive
+    bool publish = fabs(tftState.power - tftState.publishedPower) >= cfg.deadband_power_w
+                || fabs(tftState.voltage - tftState.publishedVoltage) >= cfg.deadband_voltage_v
+                || (now - tftState.lastPublish) >= cfg.publish_heartbeat_ms;
+
     // Handle wifi reconnect / mqtt reconnect etc
-    if(mqttClient.connected())
+    if(publish && mqttClient.connected())
     {
       /// TODO make use of the return code to display an error
       //bool ret = 
-      String sensorTopic = networkState.mqtt_topicOUT;
-      sensorTopic += networkState.mqtt_topicName;  
+      String sensorTopic = cfg.mqtt_topicOUT;
+      sensorTopic += cfg.mqtt_topicName;  
+
+      {
+        TRACE_SCOPE(TRACE_MQTT_PUBLISH, jsonStr.length());
+        mqttClient.publish(sensorTopic.c_str(),jsonStr.c_str());
+      }
 
-      mqttClient.publish(sensorTopic.c_str(),jsonStr.c_str());
+      tftState.publishedPower = tftState.power;
+      tftState.publishedVoltage = tftState.voltage;
+      tftState.lastPublish = now;
 
       /// TODO display an X on the screen or flash the led or something to show an error
       networkState.mqttConnected = mqttClient.connected();
@@ -814,7 +1181,7 @@ void extractPZEM_Info()
     else{          
       reconnectMQTT();
       networkState.mqttConnected = false;
-      tftState.isDirty = true; 
+      markDisplayDirty();
     }
     */
   }
@@ -0,0 +1,55 @@
+#include <Adafruit_ST77xx.h>
+
+#include "pages.hpp"
+
+/// Page 0 - the live readings
+constexpr WidgetSpec page0Widgets[] =
+{
+  Label(35, 2, 2, "0"),
+  Label(65, 2, 2, "ETH"),
+  Status(105, 2, 20, 20, networkUp),
+  Label(135, 2, 2, "MQTT"),
+  Status(185, 2, 20, 20, mqttUp),
+#ifdef PZEM_V3
+  Label(210, 2, 2, "P3"),
+#else
+  Label(210, 2, 2, "P2"),
+#endif
+  Status(235, 2, 20, 20, pzemUp),
+  Text(0, 25, 2, 3, pzemAddressText),
+  Value(0, 50, 3, 6, pzemVoltage, "%.2f", " V"),
+  Value(0, 90, 3, 6, pzemCurrent, "%.2f", " A"),
+  Value(0, 130, 3, 5, pzemPower, "%.0f", "W"),
+  Value(120, 130, 3, 6, pzemEnergy, "%.1f", "VA"),
+#ifdef PZEM_V3
+  Value(0, 160, 3, 6, pzemFrequency, "%.2f", " Hz"),
+  Value(0, 190, 3, 6, pzemPowerFactor, "%.2f", " PF"),
+#endif
+  Text(160, 220, 2, 10, ipAddressText),
+};
+
+/// Page 1 - power chart, with the current power in the label band to its left
+constexpr WidgetSpec page1Widgets[] =
+{
+  Label(35, 2, 2, "1"),
+  Value(0, 110, 2, 5, pzemPower, "%.0f", ""),
+  Label(24, 130, 2, "W"),
+  Chart(60, 0, 220, 240, drawPowerChart),
+};
+
+/// Page 2 - WiFi networks and their signal strength
+constexpr WidgetSpec page2Widgets[] =
+{
+  Label(35, 2, 2, "2"),
+  List(10, 50, 2, 16, 9, 20, networkCount, networkName),
+  List(220, 50, 2, 4, 9, 20, networkCount, networkStrength),
+};
+
+#define PAGE(widgets, color, bg) PageSpec{widgets, sizeof(widgets) / sizeof(widgets[0]), color, bg}
+
+const PageSpec pageSpecs[DISPLAY_PAGE_COUNT] =
+{
+  PAGE(page0Widgets, ST77XX_WHITE, ST77XX_BLACK),
+  PAGE(page1Widgets, ST77XX_WHITE, ST77XX_ORANGE),
+  PAGE(page2Widgets, ST77XX_WHITE, ST77XX_ORANGE),
+};
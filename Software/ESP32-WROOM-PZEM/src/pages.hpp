@@ -0,0 +1,37 @@
+#pragma once
+
+/// The TFT pages - the layout tables PageView draws (see widgets.hpp).
+///
+/// The tables only point at the data functions below. The firmware implements them over its state in main.cpp, and
+/// tools/host_render.cpp implements them with fixed readings to render the same pages on the host.
+
+#include "pzem_config.hpp"
+#include "widgets.hpp"
+
+/// Pages on the TFT - render costs are kept per page
+const int DISPLAY_PAGE_COUNT = 3;
+
+extern const PageSpec pageSpecs[DISPLAY_PAGE_COUNT];
+
+/// Page data
+float pzemVoltage();
+float pzemCurrent();
+float pzemPower();
+float pzemEnergy();
+float pzemFrequency();
+float pzemPowerFactor();
+
+bool networkUp();
+bool mqttUp();
+bool pzemUp();
+
+void pzemAddressText(int, char * text, size_t size);
+void ipAddressText(int, char * text, size_t size);
+
+/// The list of WiFi networks found at boot
+int networkCount();
+void networkName(int index, char * text, size_t size);
+void networkStrength(int index, char * text, size_t size);
+
+/// The power chart on page 1 - it reaches the right hand edge of the screen and leaves 60 pixels on its left
+void drawPowerChart(Adafruit_GFX & gfx, bool full);
@@ -0,0 +1,95 @@
+#include <esp_pm.h>
+#include <esp_sleep.h>
+
+#include "power.hpp"
+
+namespace
+{
+  const int maxFrequencyMhz = 240;
+  const int minFrequencyMhz = 80; // Lowest that keeps the APB (UART / SPI clock source) at 80MHz
+
+  struct LockDefinition
+  {
+    const char * name;
+    esp_pm_lock_type_t type;
+  };
+
+  const LockDefinition lockDefinitions[POWER_LOCK_COUNT] =
+  {
+    { "modbus",  ESP_PM_NO_LIGHT_SLEEP },
+    { "spi",     ESP_PM_CPU_FREQ_MAX },
+    { "network", ESP_PM_CPU_FREQ_MAX },
+  };
+
+  esp_pm_lock_handle_t locks[POWER_LOCK_COUNT] = {};
+  PowerMode currentMode = POWER_FULL_SPEED;
+
+  esp_err_t configure(PowerMode mode)
+  {
+    esp_pm_config_esp32_t config;
+    config.max_freq_mhz = maxFrequencyMhz;
+    config.min_freq_mhz = mode == POWER_FULL_SPEED ? maxFrequencyMhz : minFrequencyMhz;
+    config.light_sleep_enable = mode == POWER_DFS_LIGHT_SLEEP;
+    return esp_pm_configure(&config);
+  }
+}
+
+void PowerInit()
+{
+  for(int i = 0; i < POWER_LOCK_COUNT; ++i)
+  {
+    esp_err_t err = esp_pm_lock_create(lockDefinitions[i].type, 0, lockDefinitions[i].name, &locks[i]);
+    if(err != ESP_OK)
+    {
+      // ESP_ERR_NOT_SUPPORTED when the IDF build has no power management - the locks are then simply not used
+      Serial.printf("Power: lock '%s' not created (%s)\n", lockDefinitions[i].name, esp_err_to_name(err));
+      locks[i] = NULL;
+    }
+  }
+}
+
+PowerMode PowerSetMode(PowerMode mode)
+{
+  // Try the requested mode and fall back a step at a time - light sleep in particular depends on the IDF build
+  for(int m = mode; m >= POWER_FULL_SPEED; --m)
+  {
+    esp_err_t err = configure((PowerMode)m);
+    if(err == ESP_OK)
+    {
+      currentMode = (PowerMode)m;
+      break;
+    }
+    Serial.printf("Power: mode %d not available (%s)\n", m, esp_err_to_name(err));
+  }
+
+  // Automatic light sleep stops the CPU between scheduler deadlines - the touch pad interrupt has to be a wakeup
+  // source as well or a press is only seen at the next timer wakeup
+  if(currentMode == POWER_DFS_LIGHT_SLEEP)
+  {
+    esp_err_t err = esp_sleep_enable_touchpad_wakeup();
+    if(err != ESP_OK)
+      Serial.printf("Power: touch wakeup not enabled (%s)\n", esp_err_to_name(err));
+  }
+  else
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TOUCHPAD);
+
+  Serial.printf("Power: mode %d, CPU at %u MHz\n", currentMode, (unsigned)getCpuFrequencyMhz());
+  return currentMode;
+}
+
+PowerMode PowerCurrentMode()
+{
+  return currentMode;
+}
+
+void PowerLockAcquire(PowerLock lock)
+{
+  if(locks[lock])
+    esp_pm_lock_acquire(locks[lock]);
+}
+
+void PowerLockRelease(PowerLock lock)
+{
+  if(locks[lock])
+    esp_pm_lock_release(locks[lock]);
+}
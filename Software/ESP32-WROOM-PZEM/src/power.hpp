@@ -0,0 +1,51 @@
+#pragma once
+
+/// CPU power management - dynamic frequency scaling (240MHz down to 80MHz when idle) and automatic light sleep.
+///
+/// The mode comes from the "power_save" setting. While power saving is on, the code that needs the clocks (Modbus
+/// exchanges with the PZEM, SPI transfers to the TFT and network processing) holds an ESP-IDF PM lock for the
+/// duration - everything else lets the CPU slow down / sleep between the scheduler's deadlines.
+///
+/// Light sleep needs tickless idle in the IDF build (CONFIG_FREERTOS_USE_TICKLESS_IDLE). Without it the power save
+/// mode falls back to frequency scaling only - the mode actually in use is reported in /metrics. With light sleep on,
+/// the touch pads are enabled as a wakeup source so a press wakes the CPU straight away.
+
+#include <Arduino.h>
+
+enum PowerMode : uint8_t
+{
+  POWER_FULL_SPEED = 0,       // Fixed 240MHz - no power management (the previous behaviour)
+  POWER_DFS = 1,              // 80-240MHz
+  POWER_DFS_LIGHT_SLEEP = 2,  // 80-240MHz plus automatic light sleep when both cores are idle
+};
+
+enum PowerLock
+{
+  POWER_LOCK_MODBUS,    // UART exchange with the PZEM - must not light sleep part way through
+  POWER_LOCK_SPI,       // TFT drawing - full CPU and APB clock so a redraw finishes quickly
+  POWER_LOCK_NETWORK,   // MQTT / web server processing
+  POWER_LOCK_COUNT
+};
+
+/// Create the PM locks - call once at boot before PowerSetMode()
+void PowerInit();
+
+/// Configure power management. Returns the mode actually in effect (lower than requested if not supported)
+PowerMode PowerSetMode(PowerMode mode);
+
+/// The mode currently in effect
+PowerMode PowerCurrentMode();
+
+void PowerLockAcquire(PowerLock lock);
+void PowerLockRelease(PowerLock lock);
+
+/// Holds a PM lock for the lifetime of the object
+class PowerLockGuard
+{
+public:
+  PowerLockGuard(PowerLock lock) : lock(lock) { PowerLockAcquire(lock); }
+  ~PowerLockGuard() { PowerLockRelease(lock); }
+
+private:
+  PowerLock lock;
+};
@@ -0,0 +1,7 @@
+#pragma once
+
+/// Which PZEM-004T board is fitted - the firmware (main.cpp) and the page layouts (pages.cpp) both depend on it.
+
+// The below "define" controls whether it uses the V3 or V2 serial interface (which depends on which PZEM-004T board you have).
+// V3 outputs a few extra parameters and the board has leds that pulse when readings are being taken
+#define PZEM_V3
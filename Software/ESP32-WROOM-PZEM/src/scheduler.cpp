@@ -0,0 +1,255 @@
+#include <esp_timer.h>
+
+#include <atomic>
+
+#include "scheduler.hpp"
+
+namespace
+{
+  const uint32_t wheelSlots = 256; // One slot per millisecond - must be a power of two
+  const int8_t noJob = -1;
+
+  struct Job
+  {
+    SchedulerJobFunction function = NULL;
+    uint32_t periodMs = 0;
+    uint32_t slackMs = 0;
+    uint32_t deadline = 0;    // millis() at which the job is next due (only valid while "scheduled")
+    bool scheduled = false;
+    int8_t next = noJob;      // Next job in the same wheel slot
+  };
+
+  Job jobs[SCHEDULER_MAX_JOBS];
+  SchedulerJobStats jobStats[SCHEDULER_MAX_JOBS];
+  int jobCount = 0;
+
+  int8_t wheel[wheelSlots];
+  bool wheelInitialised = false;
+  uint32_t processedUpTo = 0;  // Every slot up to this millisecond has been run (this one is visited again, a job
+                               // triggered with no delay during the last pass may have landed in it)
+
+  TaskHandle_t schedulerTask = NULL;
+  std::atomic<uint32_t> requestedJobs(0);
+  uint32_t idleMicros = 0;
+
+  uint32_t slotFor(uint32_t deadline)
+  {
+    return deadline & (wheelSlots - 1);
+  }
+
+  void insertJob(int id, uint32_t deadline)
+  {
+    Job & job = jobs[id];
+    job.deadline = deadline;
+    job.scheduled = true;
+    job.next = wheel[slotFor(deadline)];
+    wheel[slotFor(deadline)] = id;
+  }
+
+  void removeJob(int id)
+  {
+    Job & job = jobs[id];
+    if(!job.scheduled)
+      return;
+
+    int8_t * link = &wheel[slotFor(job.deadline)];
+    while(*link != noJob && *link != id)
+      link = &jobs[*link].next;
+
+    if(*link == id)
+      *link = job.next;
+
+    job.scheduled = false;
+    job.next = noJob;
+  }
+
+  void runJob(int id)
+  {
+    Job & job = jobs[id];
+    SchedulerJobStats & stats = jobStats[id];
+    uint32_t deadline = job.deadline;
+
+    removeJob(id);
+
+    uint32_t start = millis();
+    uint32_t late = start - deadline;
+    if(late > stats.maxLateMs)
+      stats.maxLateMs = late;
+    if(late > job.slackMs)
+      ++stats.missed;
+
+    int64_t startMicros = esp_timer_get_time();
+    job.function(start);
+    uint32_t runMicros = esp_timer_get_time() - startMicros;
+
+    ++stats.runs;
+    if(runMicros > stats.maxRunMicros)
+      stats.maxRunMicros = runMicros;
+
+    // Periodic jobs are rescheduled from their deadline (not from when they ran) so they do not drift. The job may
+    // have been re-triggered while it ran, in which case that deadline stands
+    if(job.periodMs && !job.scheduled)
+    {
+      uint32_t next = deadline + job.periodMs;
+      uint32_t now = millis();
+      if((int32_t)(now - next) > 0)
+      {
+        uint32_t skipped = (now - next) / job.periodMs + 1;
+        stats.missed += skipped;
+        next += skipped * job.periodMs;
+      }
+      insertJob(id, next);
+    }
+  }
+
+  /// Run every job in the slots between the last pass and "now"
+  void runDueJobs(uint32_t now)
+  {
+    uint32_t slots = now - processedUpTo;
+    if(slots >= wheelSlots)
+      slots = wheelSlots - 1; // Fell behind by more than a revolution - every slot gets visited once
+
+    for(uint32_t i = 0; i <= slots; ++i)
+    {
+      uint32_t slot = slotFor(processedUpTo + i);
+
+      // Restart from the head after each run - the job can change the contents of the slot
+      bool ran = true;
+      while(ran)
+      {
+        ran = false;
+        for(int8_t id = wheel[slot]; id != noJob; id = jobs[id].next)
+        {
+          if((int32_t)(now - jobs[id].deadline) >= 0)
+          {
+            runJob(id);
+            ran = true;
+            break;
+          }
+        }
+      }
+    }
+    processedUpTo = now;
+  }
+
+  /// Milliseconds until the next deadline - 0 if a job is already due (capped at one revolution of the wheel)
+  uint32_t millisToNextDeadline(uint32_t now)
+  {
+    for(uint32_t ms = 0; ms < wheelSlots; ++ms)
+    {
+      for(int8_t id = wheel[slotFor(now + ms)]; id != noJob; id = jobs[id].next)
+      {
+        if((int32_t)(now + ms - jobs[id].deadline) >= 0)
+          return ms;
+      }
+    }
+    return wheelSlots;
+  }
+}
+
+int SchedulerAddJob(const char * name, SchedulerJobFunction function, uint32_t periodMs, uint32_t slackMs)
+{
+  if(!wheelInitialised)
+  {
+    memset(wheel, noJob, sizeof(wheel));
+    processedUpTo = millis();
+    schedulerTask = xTaskGetCurrentTaskHandle();
+    wheelInitialised = true;
+  }
+
+  if(jobCount == SCHEDULER_MAX_JOBS)
+  {
+    Serial.println("Scheduler: too many jobs, increase SCHEDULER_MAX_JOBS");
+    return -1;
+  }
+
+  int id = jobCount++;
+  jobs[id].function = function;
+  jobs[id].periodMs = periodMs;
+  jobs[id].slackMs = slackMs;
+  jobStats[id].name = name;
+
+  if(periodMs)
+    insertJob(id, millis() + periodMs);
+
+  return id;
+}
+
+void SchedulerSetPeriod(int job, uint32_t periodMs)
+{
+  if(job < 0 || job >= jobCount || jobs[job].periodMs == periodMs)
+    return;
+
+  jobs[job].periodMs = periodMs;
+  if(periodMs && !jobs[job].scheduled)
+    insertJob(job, millis() + periodMs);
+}
+
+void SchedulerTrigger(int job, uint32_t delayMs)
+{
+  if(job < 0 || job >= jobCount)
+    return;
+
+  uint32_t deadline = millis() + delayMs;
+  if(jobs[job].scheduled && (int32_t)(jobs[job].deadline - deadline) <= 0)
+    return; // Already due sooner
+
+  removeJob(job);
+  insertJob(job, deadline);
+}
+
+void SchedulerRequest(int job)
+{
+  if(job < 0 || job >= SCHEDULER_MAX_JOBS)
+    return;
+
+  requestedJobs.fetch_or(1u << job);
+  if(schedulerTask)
+    xTaskNotifyGive(schedulerTask);
+}
+
+void IRAM_ATTR SchedulerRequestFromISR(int job)
+{
+  if(job < 0 || job >= SCHEDULER_MAX_JOBS)
+    return;
+
+  requestedJobs.fetch_or(1u << job);
+
+  BaseType_t higherPriorityTaskWoken = pdFALSE;
+  if(schedulerTask)
+    vTaskNotifyGiveFromISR(schedulerTask, &higherPriorityTaskWoken);
+  if(higherPriorityTaskWoken)
+    portYIELD_FROM_ISR();
+}
+
+void SchedulerRunOnce()
+{
+  uint32_t requested = requestedJobs.exchange(0);
+  for(int id = 0; requested; ++id, requested >>= 1)
+  {
+    if(requested & 1)
+      SchedulerTrigger(id);
+  }
+
+  runDueJobs(millis());
+
+  if(requestedJobs.load())
+    return; // Something was requested while the jobs ran - go round again rather than sleep
+
+  uint32_t sleepMs = millisToNextDeadline(millis());
+
+  int64_t start = esp_timer_get_time();
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(sleepMs));
+  idleMicros += esp_timer_get_time() - start;
+}
+
+const SchedulerJobStats * SchedulerGetJobStats(int & count)
+{
+  count = jobCount;
+  return jobStats;
+}
+
+uint32_t SchedulerIdleMicros()
+{
+  return idleMicros;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+/// Cooperative scheduler for the core 1 loop (sampling, rendering, touch and status checks).
+///
+/// Jobs register a period (or are run on demand) and are kept in a hashed timer wheel with one millisecond slots.
+/// SchedulerRunOnce() runs whatever is due and then blocks the calling task until the next deadline, so the CPU is
+/// idle instead of spinning through delay() - another task (or an ISR) can cut the sleep short with SchedulerRequest().
+///
+/// A job that starts more than its slack after its deadline counts as a missed deadline, as does every whole period a
+/// periodic job falls behind by (those runs are skipped rather than run back to back).
+
+#include <Arduino.h>
+
+typedef void (*SchedulerJobFunction)(uint32_t now);
+
+struct SchedulerJobStats
+{
+  const char * name = "";
+  uint32_t runs = 0;
+  uint32_t missed = 0;        // Deadlines missed by more than the job's slack (incl. skipped periods)
+  uint32_t maxLateMs = 0;     // Worst start time after the deadline
+  uint32_t maxRunMicros = 0;  // Longest time the job took to run
+};
+
+const int SCHEDULER_MAX_JOBS = 8;
+
+/// Register a job - "periodMs" of 0 means it only runs when triggered. Returns the job id (or -1 if there is no room).
+/// Jobs must be added from the task that calls SchedulerRunOnce(), before the first call
+int SchedulerAddJob(const char * name, SchedulerJobFunction function, uint32_t periodMs, uint32_t slackMs = 10);
+
+/// Change a periodic job's period - takes effect from its next deadline
+void SchedulerSetPeriod(int job, uint32_t periodMs);
+
+/// Run "job" in "delayMs" (or sooner if it is already due sooner). Only call from the scheduler's own task
+void SchedulerTrigger(int job, uint32_t delayMs = 0);
+
+/// Run "job" as soon as possible - may be called from any task, wakes the scheduler if it is sleeping
+void SchedulerRequest(int job);
+
+/// As SchedulerRequest() but for use from an interrupt handler
+void IRAM_ATTR SchedulerRequestFromISR(int job);
+
+/// Run the jobs that are due, then sleep until the next deadline (or a request). Call repeatedly from loop()
+void SchedulerRunOnce();
+
+/// Statistics for the registered jobs - "count" is set to the number of jobs
+const SchedulerJobStats * SchedulerGetJobStats(int & count);
+
+/// Total time spent sleeping in SchedulerRunOnce() (wraps after ~71 minutes - use the difference between two calls)
+uint32_t SchedulerIdleMicros();
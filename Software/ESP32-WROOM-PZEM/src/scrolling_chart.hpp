@@ -0,0 +1,284 @@
+#pragma once
+
+/// Strip chart that scrolls sideways - the data side. Everything is sized at compile time (no heap), and the drawing
+/// goes through a Backend template parameter whose calls inline; chart_st7789.hpp has the one for the panel, which
+/// uses the ST7789's hardware vertical scroll, and tools/chart_benchmark.cpp times the chart on the host.
+///
+/// The plot is used as a ring of one pixel wide columns: each new column is drawn as a single column write into the
+/// oldest slot and the scroll start is moved on by one, so the chart shifts left without redrawing anything else.
+/// The columns and the axis labels are only redrawn in full when the scale changes (or the page is first shown).
+///
+/// Samples are kept in a min/max pyramid so the chart can show anything from the last few minutes to the whole day:
+/// level 0 holds one bucket per sample and each level above holds buckets covering twice as many samples, each
+/// level a ring of one bucket per column. The pyramid is updated as samples arrive (amortised one bucket per sample)
+/// and a zoom level is drawn by reading exactly one level, so a redraw costs the same at any time span. Each column
+/// is a vertical bar from the bucket's minimum to its maximum, so short spikes are never averaged away.
+///
+/// The minimum and maximum of the buckets on screen (for the scale) are kept with monotonic deques, so adding a
+/// sample never rescans the plot.
+///
+/// Backend needs (all called from draw()):
+///   void begin(bool full, uint16_t bg)                     - start of a draw, full == the plot is about to be repainted
+///   void column(int16_t slot, const uint16_t * pixels)     - Height pixels, top to bottom, for the column in ring slot "slot"
+///   void labels(float low, float high, uint32_t samplesShown, uint16_t color, uint16_t bg)
+///   void scrollTo(int16_t slot)                            - show ring slot "slot" at the left of the plot
+
+#include <stdint.h>
+
+#include <algorithm>
+
+/// Sliding window minimum or maximum over the last Window values pushed - each push is amortised O(1)
+template<typename T, int16_t Window, bool Maximum>
+class MonotonicWindow
+{
+public:
+  void clear() { front = back = 0; }
+  bool empty() const { return front == back; }
+
+  /// Value "seq" (one more than the previous push)
+  void push(uint32_t seq, T value)
+  {
+    // Anything the new value beats can never be the answer again
+    while(!empty() && !beats(entries[previous(back)].value, value))
+      back = previous(back);
+
+    entries[back] = Entry{seq, value};
+    back = next(back);
+
+    while(entries[front].seq + Window <= seq)
+      front = next(front);
+  }
+
+  T value() const { return entries[front].value; }
+
+private:
+  struct Entry
+  {
+    uint32_t seq;
+    T value;
+  };
+
+  static const int16_t capacity = Window + 1;
+  Entry entries[capacity];
+  int16_t front = 0;
+  int16_t back = 0;   // One past the newest entry
+
+  static bool beats(T kept, T value) { return Maximum ? kept > value : kept < value; }
+  static int16_t next(int16_t i) { return i + 1 == capacity ? 0 : i + 1; }
+  static int16_t previous(int16_t i) { return i == 0 ? capacity - 1 : i - 1; }
+};
+
+template<typename T, int16_t Width, int16_t Height, class Backend, uint8_t Levels = 10>
+class ScrollingChart
+{
+public:
+  static const uint8_t levels = Levels;   // Level 9 is 512 samples per column - 31 hours over 220 columns at 1 Hz
+
+  /// Add a sample - cheap, the drawing happens in draw()
+  void add(T value)
+  {
+    Bucket bucket = {value, value};
+
+    // Every second bucket of a level completes a pair, which carries up as one bucket of the level above
+    for(uint8_t index = 0; index < Levels; ++index)
+    {
+      push(index, bucket);
+
+      Level & level = pyramid[index];
+      if(!level.halfValid)
+      {
+        level.half = bucket;
+        level.halfValid = true;
+        break;
+      }
+
+      bucket.min = std::min(level.half.min, bucket.min);
+      bucket.max = std::max(level.half.max, bucket.max);
+      level.halfValid = false;
+    }
+  }
+
+  /// Bring the screen up to date. "full" repaints the whole plot (the page has just been switched to)
+  void draw(Backend & backend, bool full, uint16_t color, uint16_t bg)
+  {
+    full = full || rezoomed;
+    backend.begin(full, bg);
+
+    if(updateScale() || full)
+    {
+      backend.labels(low, high, (uint32_t)Width << shownLevel, color, bg);
+
+      for(int16_t slot = 0; slot < Width; ++slot)
+        drawColumn(backend, slot, color, bg);
+    }
+    else
+    {
+      int16_t head = pyramid[shownLevel].head;
+      for(; pending > 0; --pending)
+        drawColumn(backend, (head - pending + Width) % Width, color, bg);
+    }
+    pending = 0;
+    rezoomed = false;
+
+    // Slot "head" holds the oldest bucket - show it at the left of the plot
+    backend.scrollTo(pyramid[shownLevel].head);
+  }
+
+  /// Step to the next zoom level (wrapping back to the most detailed) - the next draw() repaints the plot
+  void zoom()
+  {
+    // At 1 Hz and 220 columns: 4 minutes, 15 minutes, 1 hour, 4 hours, 31 hours
+    const uint8_t zoomLevels[] = {0, 2, 4, 6, 9};
+
+    uint8_t next = 0;
+    for(uint8_t i = 0; i < sizeof(zoomLevels); ++i)
+    {
+      if(zoomLevels[i] == shownLevel)
+        next = (i + 1) % sizeof(zoomLevels);
+    }
+    shownLevel = std::min<uint8_t>(zoomLevels[next], Levels - 1);
+    rezoomed = true;
+
+    // Refill the windows from the newly shown level - once per zoom, Width buckets
+    minimum.clear();
+    maximum.clear();
+    const Level & level = pyramid[shownLevel];
+    for(int16_t age = level.filled - 1; age >= 0; --age)
+    {
+      uint32_t seq = level.pushed - 1 - age;
+      const Bucket & bucket = level.ring[(level.head - 1 - age + 2 * Width) % Width];
+      minimum.push(seq, bucket.min);
+      maximum.push(seq, bucket.max);
+    }
+  }
+
+private:
+  struct Bucket
+  {
+    T min;
+    T max;
+  };
+
+  struct Level
+  {
+    Bucket ring[Width];     // One bucket per column
+    int16_t head = 0;       // Slot the next bucket goes in (== the oldest bucket once the ring is full)
+    int16_t filled = 0;     // Number of valid buckets
+    uint32_t pushed = 0;    // Buckets ever added
+    Bucket half;            // First of the pair of buckets that make the next bucket of the level above
+    bool halfValid = false;
+  };
+
+  Level pyramid[Levels];
+  uint8_t shownLevel = 0;
+  MonotonicWindow<T, Width, false> minimum;   // Over the buckets of the shown level
+  MonotonicWindow<T, Width, true> maximum;
+
+  uint16_t column[Height];  // Pixels for one column write
+  int16_t pending = 0;      // Buckets added to the shown level since the last draw()
+  float low = 0;            // Values at the bottom and top of the plot
+  float high = 0;
+  bool rezoomed = false;    // Zoom level changed since the last draw()
+
+  void push(uint8_t index, Bucket bucket)
+  {
+    Level & level = pyramid[index];
+    level.ring[level.head] = bucket;
+    level.head = (level.head + 1) % Width;
+    level.filled = std::min<int16_t>(level.filled + 1, Width);
+
+    if(index == shownLevel)
+    {
+      minimum.push(level.pushed, bucket.min);
+      maximum.push(level.pushed, bucket.max);
+      pending = std::min<int16_t>(pending + 1, Width);
+    }
+    ++level.pushed;
+  }
+
+  /// Smallest 1, 2 or 5 x 10^n that is >= value (minimum 10)
+  static float niceCeiling(float value)
+  {
+    for(float decade = 1; ; decade *= 10)
+    {
+      const float steps[] = {1, 2, 5};
+      for(float step : steps)
+      {
+        float candidate = step * decade;
+        if(candidate >= 10 && candidate >= value)
+          return candidate;
+      }
+    }
+  }
+
+  bool updateScale()
+  {
+    if(pyramid[shownLevel].filled == 0)
+    {
+      bool changed = high != 10;
+      low = 0;
+      high = 10;
+      return changed;
+    }
+
+    // Zero based unless the data goes negative. Grow as soon as a sample would go off the top - only shrink once
+    // everything fits in a quarter of the plot, so the scale (and the full redraw it needs) does not flip back and forth
+    float smallest = (float)minimum.value();
+    float wantedLow = smallest >= 0 ? 0 : -niceCeiling(-smallest);
+    float wantedHigh = niceCeiling((float)maximum.value());
+
+    if(wantedHigh > high || wantedHigh * 4 <= high || wantedLow != low)
+    {
+      low = wantedLow;
+      high = wantedHigh;
+      return true;
+    }
+    return false;
+  }
+
+  /// Age 0 is the newest bucket
+  int16_t age(int16_t slot) const
+  {
+    return (pyramid[shownLevel].head - 1 - slot + 2 * Width) % Width;
+  }
+
+  bool validSlot(int16_t slot) const
+  {
+    return age(slot) < pyramid[shownLevel].filled;
+  }
+
+  int16_t rowFor(T value) const
+  {
+    float clamped = std::min(std::max((float)value, low), high);
+    return Height - 1 - (int16_t)((clamped - low) * (Height - 1) / (high - low));
+  }
+
+  void drawColumn(Backend & backend, int16_t slot, uint16_t color, uint16_t bg)
+  {
+    for(int16_t i = 0; i < Height; ++i)
+      column[i] = bg;
+
+    if(validSlot(slot))
+    {
+      // A bar from the bucket's maximum (top) to its minimum - stretched to meet the previous column's bar if they
+      // do not overlap, so the trace stays continuous. The oldest bucket has no previous one: the slot before it in
+      // the ring holds the newest
+      const Level & level = pyramid[shownLevel];
+      const Bucket & bucket = level.ring[slot];
+      int16_t top = rowFor(bucket.max);
+      int16_t bottom = rowFor(bucket.min);
+
+      int16_t previous = (slot - 1 + Width) % Width;
+      if(age(slot) < level.filled - 1)
+      {
+        top = std::min(top, rowFor(level.ring[previous].min));
+        bottom = std::max(bottom, rowFor(level.ring[previous].max));
+      }
+
+      for(int16_t row = top; row <= bottom; ++row)
+        column[row] = color;
+    }
+
+    backend.column(slot, column);
+  }
+};
@@ -0,0 +1,158 @@
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+
+#include "power.hpp"
+#include "strip_renderer.hpp"
+#include "trace.hpp"
+
+StripCanvas::StripCanvas(int16_t width, int16_t height, int16_t rows) : Adafruit_GFX(width, height), rows(rows)
+{
+}
+
+void StripCanvas::setBuffer(uint16_t * stripBuffer, int16_t stripTop)
+{
+  buffer = stripBuffer;
+  top = stripTop;
+}
+
+void StripCanvas::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+  y -= top;
+  if(x < 0 || x >= _width || y < 0 || y >= rows)
+    return;
+
+  buffer[y * _width + x] = color;
+}
+
+void StripCanvas::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  if(w < 0) { x += w + 1; w = -w; }
+  if(h < 0) { y += h + 1; h = -h; }
+
+  // Clip to this strip
+  int16_t x1 = min<int16_t>(x + w, _width);
+  int16_t y1 = min<int16_t>(y + h - top, rows);
+  x = max<int16_t>(x, 0);
+  y = max<int16_t>(y - top, 0);
+
+  for(int16_t row = y; row < y1; ++row)
+  {
+    uint16_t * pixel = buffer + row * _width + x;
+    for(int16_t i = x; i < x1; ++i)
+      *pixel++ = color;
+  }
+}
+
+void StripCanvas::fillScreen(uint16_t color)
+{
+  uint16_t * pixel = buffer;
+  for(int32_t i = (int32_t)_width * rows; i > 0; --i)
+    *pixel++ = color;
+}
+
+namespace
+{
+  struct Strip
+  {
+    uint16_t * buffer;
+    int16_t top;
+    int16_t rows;
+  };
+
+  CountingST7789 * display = NULL;
+  int16_t stripRows = 0;
+  uint16_t * buffers[2] = {};
+  StripCanvas * canvas = NULL;
+
+  QueueHandle_t flushQueue = NULL;          // Strips waiting to be sent
+  SemaphoreHandle_t freeBuffers = NULL;     // Counts the strip buffers that are not queued / being sent
+
+  void flushTask(void * parameter)
+  {
+    Strip strip;
+    while(true)
+    {
+      xQueueReceive(flushQueue, &strip, portMAX_DELAY);
+
+      {
+        TRACE_SCOPE(TRACE_STRIP_FLUSH, strip.top);
+        PowerLockGuard powerLock(POWER_LOCK_SPI);
+
+        uint32_t pixels = (uint32_t)display->width() * strip.rows;
+        display->startWrite();
+        display->setAddrWindow(0, strip.top, display->width(), strip.rows);
+        display->writePixels(strip.buffer, pixels);
+        display->endWrite();
+        display->countPixels(pixels);
+      }
+
+      xSemaphoreGive(freeBuffers);
+    }
+  }
+}
+
+bool StripRendererBegin(CountingST7789 * tft, int16_t rows)
+{
+  display = tft;
+  stripRows = rows;
+
+  size_t bytes = (size_t)tft->width() * rows * sizeof(uint16_t);
+  for(int i = 0; i < 2; ++i)
+  {
+    buffers[i] = (uint16_t*)heap_caps_malloc(bytes, MALLOC_CAP_DMA);
+    if(buffers[i] == NULL)
+    {
+      Serial.printf("Strip renderer: could not allocate %u bytes - drawing directly\n", (unsigned)bytes);
+      return false;
+    }
+  }
+
+  canvas = new StripCanvas(tft->width(), tft->height(), rows);
+  flushQueue = xQueueCreate(2, sizeof(Strip));
+  freeBuffers = xSemaphoreCreateCounting(2, 2);
+
+  // On core 0 so the SPI transfer runs in parallel with painting on core 1 - above the network thread's priority
+  xTaskCreatePinnedToCore(flushTask, "StripFlush", 3072, NULL, 2, NULL, 0);
+  return true;
+}
+
+FrameStats StripRenderFrame(StripPainter painter)
+{
+  FrameStats stats;
+  int64_t frameStart = esp_timer_get_time();
+
+  if(canvas == NULL)
+  {
+    painter(*display);
+    stats.frameMicros = stats.paintMicros = esp_timer_get_time() - frameStart;
+    return stats;
+  }
+
+  int next = 0;
+  for(int16_t top = 0; top < display->height(); top += stripRows)
+  {
+    xSemaphoreTake(freeBuffers, portMAX_DELAY);
+
+    Strip strip;
+    strip.buffer = buffers[next];
+    strip.top = top;
+    strip.rows = min<int16_t>(stripRows, display->height() - top);
+    next ^= 1;
+
+    int64_t paintStart = esp_timer_get_time();
+    canvas->setBuffer(strip.buffer, top);
+    painter(*canvas);
+    stats.paintMicros += esp_timer_get_time() - paintStart;
+
+    xQueueSend(flushQueue, &strip, portMAX_DELAY);
+  }
+
+  // Wait for the last strips to reach the panel - the caller may draw straight to it next
+  xSemaphoreTake(freeBuffers, portMAX_DELAY);
+  xSemaphoreTake(freeBuffers, portMAX_DELAY);
+  xSemaphoreGive(freeBuffers);
+  xSemaphoreGive(freeBuffers);
+
+  stats.frameMicros = esp_timer_get_time() - frameStart;
+  return stats;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+/// Full frame redraws through RAM strips instead of one SPI transaction per drawing primitive.
+///
+/// The frame is painted one horizontal strip at a time into a StripCanvas (an Adafruit_GFX that only keeps the rows
+/// of the current strip - everything else is clipped), then the strip is sent to the panel as a single address window
+/// and pixel burst. There are two strip buffers: a flush task on the other core sends one while the caller paints the
+/// next, so painting and SPI transfer overlap.
+///
+/// Note: the Arduino SPIClass that Adafruit_SPITFT uses owns HSPI and sends from the CPU (FIFO) rather than by DMA, so
+/// the "DMA" here is the second core. The strip buffers are allocated DMA capable so a DMA SPI driver could use them.
+
+#include <Adafruit_GFX.h>
+
+#include "counting_st7789.hpp"
+
+class StripCanvas : public Adafruit_GFX
+{
+public:
+  /// A canvas the size of the whole screen that only stores "rows" rows, starting at stripTop
+  StripCanvas(int16_t width, int16_t height, int16_t rows);
+
+  void setBuffer(uint16_t * buffer, int16_t top);
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void writePixel(int16_t x, int16_t y, uint16_t color) override { drawPixel(x, y, color); }
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override { fillRect(x, y, w, h, color); }
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override { fillRect(x, y, w, 1, color); }
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override { fillRect(x, y, 1, h, color); }
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override { fillRect(x, y, w, 1, color); }
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override { fillRect(x, y, 1, h, color); }
+  void fillScreen(uint16_t color) override;
+
+private:
+  uint16_t * buffer = NULL;
+  int16_t rows;
+  int16_t top = 0;
+};
+
+/// Paints one strip - called once per strip with the same canvas, so it must draw the whole frame each time
+typedef void (*StripPainter)(Adafruit_GFX & gfx);
+
+struct FrameStats
+{
+  uint32_t frameMicros = 0;   // First strip painted to the last strip on the panel
+  uint32_t paintMicros = 0;   // CPU time spent painting strips (the rest is waiting for the flush task)
+};
+
+/// Create the strip buffers and start the flush task. Returns false if the buffers could not be allocated
+bool StripRendererBegin(CountingST7789 * tft, int16_t rows);
+
+/// Redraw the whole screen through the strip buffers - falls back to painting directly if they are not available
+FrameStats StripRenderFrame(StripPainter painter);
@@ -0,0 +1,102 @@
+#include "digit_font.hpp"
+#include "text_field.hpp"
+
+void Rect::unite(const Rect & other)
+{
+  if(other.empty())
+    return;
+
+  if(empty())
+  {
+    *this = other;
+    return;
+  }
+
+  int16_t x1 = max<int16_t>(x + w, other.x + other.w);
+  int16_t y1 = max<int16_t>(y + h, other.y + other.h);
+  x = min(x, other.x);
+  y = min(y, other.y);
+  w = x1 - x;
+  h = y1 - y;
+}
+
+TextField::TextField(int16_t x, int16_t y, uint8_t textSize, uint8_t length, bool alignRight, bool digitFont)
+  : x(x), y(y), textSize(textSize), length(min<uint8_t>(length, maxLength)), alignRight(alignRight),
+    digitFont(digitFont && textSize == 3)
+{
+  invalidate(0);
+}
+
+void TextField::invalidate(uint16_t bg)
+{
+  memset(shown, ' ', sizeof(shown));
+  shownColor = 0;
+  shownBg = bg;
+}
+
+void TextField::draw(Adafruit_GFX & gfx, const char * text, uint16_t color, uint16_t bg)
+{
+  // A colour change means repainting every glyph - and the blank cells too if it is the background that changed
+  if(colorsChanged(color, bg))
+  {
+    for(uint8_t i = 0; i < length; ++i)
+    {
+      if(shown[i] != ' ' || bg != shownBg)
+        shown[i] = 0;
+    }
+    shownColor = color;
+    shownBg = bg;
+  }
+
+  size_t textLength = min<size_t>(strlen(text), length);
+
+  for(uint8_t i = 0; i < length; ++i)
+  {
+    char c = cellChar(text, textLength, i);
+    if(c == shown[i])
+      continue;
+
+    // Both paint the whole cell (incl. the spacing) - no clearing needed
+    if(!digitFont || !DigitFontDrawChar(gfx, x + i * cellWidth(), y, c, color, bg))
+      gfx.drawChar(x + i * cellWidth(), y, c, color, bg, textSize);
+    shown[i] = c;
+  }
+}
+
+bool TextField::damage(const char * text, uint16_t color, uint16_t bg, Rect & rect) const
+{
+  rect = Rect();
+
+  size_t textLength = min<size_t>(strlen(text), length);
+  bool recolor = colorsChanged(color, bg);
+  bool bgChanged = bg != shownBg;
+
+  int first = -1;
+  int last = -1;
+  for(uint8_t i = 0; i < length; ++i)
+  {
+    char c = cellChar(text, textLength, i);
+    bool repaint = c != shown[i] || (recolor && (shown[i] != ' ' || bgChanged));
+    if(repaint)
+    {
+      if(first < 0)
+        first = i;
+      last = i;
+    }
+  }
+
+  if(first < 0)
+    return false;
+
+  rect.x = x + first * cellWidth();
+  rect.y = y;
+  rect.w = (last - first + 1) * cellWidth();
+  rect.h = 8 * textSize;
+  return true;
+}
+
+char TextField::cellChar(const char * text, size_t textLength, uint8_t i) const
+{
+  uint8_t start = alignRight ? length - textLength : 0;
+  return (i >= start && i < start + textLength) ? text[i - start] : ' ';
+}
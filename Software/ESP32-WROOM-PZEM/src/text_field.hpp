@@ -0,0 +1,64 @@
+#pragma once
+
+/// A fixed position, fixed width run of text in the built in 6x8 Adafruit_GFX font that remembers what it last drew
+/// and only redraws the character cells that changed. Used for the retained mode readings page - a reading that goes
+/// from 230.41 to 230.47 costs one glyph over SPI rather than the whole line.
+///
+/// Size 3 fields can use the digit sprite font instead (same 18x24 cell) - see digit_font.hpp.
+
+#include <Adafruit_GFX.h>
+
+/// Screen area - an empty rectangle has w or h == 0
+struct Rect
+{
+  int16_t x = 0;
+  int16_t y = 0;
+  int16_t w = 0;
+  int16_t h = 0;
+
+  bool empty() const { return w <= 0 || h <= 0; }
+  int32_t area() const { return empty() ? 0 : (int32_t)w * h; }
+
+  /// Grow to cover "other" as well
+  void unite(const Rect & other);
+};
+
+class TextField
+{
+public:
+  static const uint8_t maxLength = 16;
+
+  TextField(int16_t x, int16_t y, uint8_t textSize, uint8_t length, bool alignRight = false, bool digitFont = false);
+
+  /// Forget what was drawn - call after the area under the field has been cleared to "bg" (e.g. fillScreen)
+  void invalidate(uint16_t bg);
+
+  /// Draw "text" (truncated to the field length), touching only the cells that differ from the last draw
+  void draw(Adafruit_GFX & gfx, const char * text, uint16_t color, uint16_t bg);
+
+  /// The cells draw() would repaint for this text - returns false (and an empty rect) if nothing would change
+  bool damage(const char * text, uint16_t color, uint16_t bg, Rect & rect) const;
+
+  int16_t right() const { return x + length * cellWidth(); }
+
+  /// Move the field - it must be invalidated (and the area cleared) before it is drawn again
+  void moveTo(int16_t newX, int16_t newY) { x = newX; y = newY; }
+
+private:
+  int16_t x;
+  int16_t y;
+  uint8_t textSize;
+  uint8_t length;
+  bool alignRight;
+  bool digitFont;
+
+  char shown[maxLength];  // What is on the screen now - blank cells hold ' '
+  uint16_t shownColor;
+  uint16_t shownBg;
+
+  int16_t cellWidth() const { return 6 * textSize; }
+
+  /// Character that goes in cell i for "text", after truncation and alignment
+  char cellChar(const char * text, size_t textLength, uint8_t i) const;
+  bool colorsChanged(uint16_t color, uint16_t bg) const { return color != shownColor || bg != shownBg; }
+};
@@ -0,0 +1,196 @@
+#include <esp_timer.h>
+
+#include "instrumentation.hpp"
+#include "scheduler.hpp"
+#include "touch_input.hpp"
+
+namespace
+{
+  const uint32_t touchLongPressMs = 600;
+  const uint32_t touchHoldRepeatMs = 200;
+  const uint32_t touchHeldPollMs = 10;      // Poll rate while a pad is held (release / long press detection)
+  const uint32_t touchBaselinePollMs = 500; // Baseline tracking rate while nothing is touched
+
+  const uint32_t pressPercent = 60;         // A reading below this % of the baseline is a touch
+  const uint32_t releasePercent = 75;       // ...and it must rise above this % to count as released (hysteresis)
+  const int baselineShift = 3;              // Baseline moving average weight - 1/8 of each new reading
+
+  // Measure for 0x1000 cycles of the 8MHz clock (~0.5ms) every 0x300 cycles of the 150kHz clock (~5ms). The IDF default
+  // sleep of 0x1000 (~27ms) alone would eat most of the latency budget
+  const uint16_t touchMeasureCycles = 0x1000;
+  const uint16_t touchSleepCycles = 0x300;
+
+  const int eventQueueLength = 8;
+
+  enum PadState : uint8_t { PadIdle, PadHeld };
+
+  struct Pad
+  {
+    int pin = -1;
+    uint32_t baseline = 0;        // Untouched reading, fixed point << baselineShift
+    uint16_t threshold = 0;       // Currently programmed interrupt threshold
+    PadState state = PadIdle;
+    uint32_t heldSince = 0;
+    uint32_t nextRepeat = 0;
+    bool longPressSent = false;
+
+    volatile bool touched = false;          // Set by the interrupt, cleared once the touch has been handled
+    volatile uint32_t touchMicros = 0;
+  };
+
+  Pad pads[TOUCH_MAX_PADS];
+  int padCount = 0;
+  int wakeJob = -1;
+  QueueHandle_t eventQueue = NULL;
+
+  void IRAM_ATTR touchInterrupt(void * arg)
+  {
+    Pad & pad = pads[(int)(intptr_t)arg];
+
+    // The peripheral keeps interrupting on every measurement while the pad is held - only the first one matters
+    if(pad.touched)
+      return;
+
+    pad.touchMicros = esp_timer_get_time();
+    pad.touched = true;
+    SchedulerRequestFromISR(wakeJob);
+  }
+
+  uint16_t baselineValue(const Pad & pad)
+  {
+    return pad.baseline >> baselineShift;
+  }
+
+  void setThreshold(int index)
+  {
+    Pad & pad = pads[index];
+    uint16_t threshold = baselineValue(pad) * pressPercent / 100;
+
+    // Re-attaching reprograms the threshold - skip it for changes too small to matter
+    if(abs((int)threshold - (int)pad.threshold) < 2)
+      return;
+
+    pad.threshold = threshold;
+    touchAttachInterruptArg(pad.pin, touchInterrupt, (void*)(intptr_t)index, threshold);
+  }
+
+  void queueEvent(int index, TouchEventType type)
+  {
+    TouchEvent event;
+    event.pad = index;
+    event.type = type;
+    event.touchMicros = pads[index].touchMicros;
+
+    if(xQueueSend(eventQueue, &event, 0) != pdTRUE)
+      Serial.println("Touch: event queue full - event dropped");
+  }
+
+  /// Returns true while the pad is held
+  bool pollPad(int index, uint32_t now)
+  {
+    Pad & pad = pads[index];
+
+    if(pad.state == PadIdle)
+    {
+      if(!pad.touched)
+      {
+        // Nothing happening - track drift. Readings that look like a touch are left out of the average
+        uint16_t value = touchRead(pad.pin);
+        if(value > pad.threshold)
+        {
+          pad.baseline = pad.baseline - (pad.baseline >> baselineShift) + value;
+          setThreshold(index);
+        }
+        return false;
+      }
+
+      // Interrupt seen - a second low reading confirms it (instead of the old two polls 50ms apart)
+      if(touchRead(pad.pin) >= pad.threshold)
+      {
+        pad.touched = false; // Glitch
+        return false;
+      }
+
+      pad.state = PadHeld;
+      pad.heldSince = now;
+      pad.longPressSent = false;
+      queueEvent(index, TOUCH_PRESS);
+      RecordLatency(LATENCY_TOUCH_EVENT, (uint32_t)esp_timer_get_time() - pad.touchMicros);
+      return true;
+    }
+
+    if(touchRead(pad.pin) > baselineValue(pad) * releasePercent / 100)
+    {
+      pad.state = PadIdle;
+      queueEvent(index, TOUCH_RELEASE);
+      pad.touched = false; // Re-arm the interrupt handler
+      return false;
+    }
+
+    if(!pad.longPressSent && (now - pad.heldSince) >= touchLongPressMs)
+    {
+      pad.longPressSent = true;
+      pad.nextRepeat = now + touchHoldRepeatMs;
+      queueEvent(index, TOUCH_LONG_PRESS);
+    }
+    else if(pad.longPressSent && (int32_t)(now - pad.nextRepeat) >= 0)
+    {
+      pad.nextRepeat += touchHoldRepeatMs;
+      queueEvent(index, TOUCH_HOLD_REPEAT);
+    }
+    return true;
+  }
+}
+
+bool TouchInputBegin(const int * pins, int count, int schedulerJob)
+{
+  if(count > TOUCH_MAX_PADS)
+  {
+    Serial.println("Touch: too many pads, increase TOUCH_MAX_PADS");
+    return false;
+  }
+
+  eventQueue = xQueueCreate(eventQueueLength, sizeof(TouchEvent));
+  if(eventQueue == NULL)
+  {
+    return false;
+  }
+
+  wakeJob = schedulerJob;
+  padCount = count;
+  touchSetCycles(touchMeasureCycles, touchSleepCycles);
+
+  for(int i = 0; i < count; ++i)
+  {
+    Pad & pad = pads[i];
+    pad.pin = pins[i];
+
+    // Seed the baseline - the pads are assumed to be untouched at power on
+    uint32_t sum = 0;
+    for(int sample = 0; sample < 4; ++sample)
+      sum += touchRead(pad.pin);
+    pad.baseline = (sum / 4) << baselineShift;
+
+    pad.threshold = 0;
+    setThreshold(i);
+
+    Serial.printf("Touch: pad %d (GPIO %d) baseline %u threshold %u\n", i, pad.pin, (unsigned)baselineValue(pad), (unsigned)pad.threshold);
+  }
+  return true;
+}
+
+uint32_t TouchInputPoll(uint32_t now)
+{
+  bool held = false;
+  for(int i = 0; i < padCount; ++i)
+  {
+    if(pollPad(i, now))
+      held = true;
+  }
+  return held ? touchHeldPollMs : touchBaselinePollMs;
+}
+
+bool TouchInputGetEvent(TouchEvent & event)
+{
+  return eventQueue && xQueueReceive(eventQueue, &event, 0) == pdTRUE;
+}
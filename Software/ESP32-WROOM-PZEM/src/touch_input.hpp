@@ -0,0 +1,40 @@
+#pragma once
+
+/// Interrupt driven capacitive touch buttons.
+///
+/// The touch peripheral measures the pads in the background and raises an interrupt when a reading drops below the
+/// pad's threshold - the interrupt only records the time and wakes the scheduler job that calls TouchInputPoll(). That
+/// confirms the press with a second reading and then polls the pad (only while it is held) to detect long presses,
+/// hold repeats and the release. Debounced events are delivered through a queue.
+///
+/// Each pad's threshold follows a slow moving average of its untouched readings, so it tracks drift from temperature,
+/// humidity and the enclosure rather than relying on a fixed calibration value.
+
+#include <Arduino.h>
+
+enum TouchEventType : uint8_t
+{
+  TOUCH_PRESS,
+  TOUCH_LONG_PRESS,   // Once, after the pad has been held for touchLongPressMs
+  TOUCH_HOLD_REPEAT,  // Every touchHoldRepeatMs after the long press while the pad is still held
+  TOUCH_RELEASE,
+};
+
+struct TouchEvent
+{
+  uint8_t pad;            // Index into the pins passed to TouchInputBegin()
+  TouchEventType type;
+  uint32_t touchMicros;   // esp_timer time at which the touch was first seen (the interrupt) - for latency measurement
+};
+
+const int TOUCH_MAX_PADS = 4;
+
+/// Start the touch peripheral on "pins" and attach the interrupts. "schedulerJob" is requested (see scheduler.hpp)
+/// whenever a pad is touched - that job must call TouchInputPoll()
+bool TouchInputBegin(const int * pins, int count, int schedulerJob);
+
+/// Debounce / track the pads and queue events. Returns the number of ms until it needs to be called again
+uint32_t TouchInputPoll(uint32_t now);
+
+/// Take the next event from the queue - returns false if there is none
+bool TouchInputGetEvent(TouchEvent & event);
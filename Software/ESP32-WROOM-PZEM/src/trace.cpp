@@ -0,0 +1,142 @@
+#include <esp_timer.h>
+
+#include "trace.hpp"
+
+TraceRing traceRings[portNUM_PROCESSORS];
+
+namespace
+{
+  const char * const traceEventNames[TRACE_EVENT_COUNT] =
+  {
+    "sync",
+    "pzem_read",
+    "display_page0",
+    "display_page1",
+    "display_page2",
+    "touch_scan",
+    "network_loop",
+    "mqtt_loop",
+    "mqtt_publish",
+    "mqtt_reconnect",
+    "strip_flush",
+  };
+
+  struct TraceSample
+  {
+    uint32_t ccount;
+    uint32_t arg;
+    uint16_t id;
+    uint8_t phase;
+  };
+
+  /// Copy the ring oldest first, skipping slots that were (re)written while we copied them. Returns the number copied
+  uint32_t snapshotRing(TraceRing & ring, TraceSample * samples)
+  {
+    uint32_t head = ring.head.load(std::memory_order_acquire);
+    uint32_t start = head > TraceRing::size ? head - TraceRing::size : 0;
+    uint32_t count = 0;
+
+    for(uint32_t index = start; index != head; ++index)
+    {
+      TraceRecord & record = ring.records[index & (TraceRing::size - 1)];
+
+      if(record.seq.load(std::memory_order_acquire) != index)
+        continue;
+
+      TraceSample & sample = samples[count];
+      sample.ccount = record.ccount;
+      sample.arg = record.arg;
+      sample.id = record.id;
+      sample.phase = record.phase;
+
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if(record.seq.load(std::memory_order_relaxed) == index && sample.id < TRACE_EVENT_COUNT)
+        ++count;
+    }
+    return count;
+  }
+
+  /// Index of the first sync sample at or after "from" (count if there is none)
+  uint32_t nextSync(const TraceSample * samples, uint32_t from, uint32_t count)
+  {
+    while(from < count && samples[from].id != TRACE_SYNC)
+      ++from;
+    return from;
+  }
+
+  /// Write one core's samples. Cycle counts are converted to microseconds since boot by interpolating between the
+  /// sync samples either side - the CCOUNT rate changes with the CPU clock so a fixed rate is only used at the ends
+  void writeCore(Print & out, int core, const TraceSample * samples, uint32_t count, int64_t now, bool & first)
+  {
+    uint32_t prev = nextSync(samples, 0, count);
+    if(prev == count)
+      return; // No sync point - nothing to anchor the cycle counts to
+
+    double nominalCyclesPerMicro = getCpuFrequencyMhz();
+    uint32_t next = nextSync(samples, prev + 1, count);
+
+    for(uint32_t i = 0; i < count; ++i)
+    {
+      if(i == next)
+      {
+        prev = next;
+        next = nextSync(samples, next + 1, count);
+      }
+
+      const TraceSample & sample = samples[i];
+      if(sample.id == TRACE_SYNC)
+        continue;
+
+      const TraceSample & anchor = samples[prev];
+      double cyclesPerMicro = nominalCyclesPerMicro;
+      if(i > prev && next < count)
+      {
+        uint32_t micros = samples[next].arg - anchor.arg;
+        if(micros)
+          cyclesPerMicro = (double)(samples[next].ccount - anchor.ccount) / micros;
+      }
+
+      // Sync samples hold the bottom 32 bits of esp_timer - rebuild the full time relative to now
+      int64_t anchorMicros = now - (uint32_t)((uint32_t)now - anchor.arg);
+      double offset = (i > prev) ? (double)(uint32_t)(sample.ccount - anchor.ccount)
+                                 : -(double)(uint32_t)(anchor.ccount - sample.ccount);
+      double ts = anchorMicros + offset / cyclesPerMicro;
+
+      out.printf("%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":0,\"tid\":%d",
+        first ? "" : ",\n", traceEventNames[sample.id], sample.phase, ts, core);
+      if(sample.phase == TRACE_INSTANT)
+        out.print(",\"s\":\"t\"");
+      if(sample.phase != TRACE_END)
+        out.printf(",\"args\":{\"arg\":%u}", (unsigned)sample.arg);
+      out.print("}");
+      first = false;
+    }
+  }
+}
+
+void TraceSync()
+{
+  TraceEmit(TRACE_SYNC, TRACE_INSTANT, (uint32_t)esp_timer_get_time());
+}
+
+void TraceDumpChromeJson(Print & out)
+{
+  TraceSample * samples = new TraceSample[TraceRing::size];
+  bool first = true;
+
+  out.print("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+  for(int core = 0; core < portNUM_PROCESSORS; ++core)
+  {
+    out.printf("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"core %d\"}}",
+      first ? "" : ",\n", core, core);
+    first = false;
+
+    uint32_t count = snapshotRing(traceRings[core], samples);
+    int64_t now = esp_timer_get_time(); // After the snapshot so that no sync sample is newer than "now"
+    writeCore(out, core, samples, count, now, first);
+  }
+
+  out.print("\n]}");
+  delete[] samples;
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+/// Lightweight tracepoints for the hot paths (Modbus reads, TFT page drawing, touch scanning, the network loop).
+///
+/// Each tracepoint stores the CPU cycle counter (CCOUNT), an event id and an argument into a ring buffer owned by the
+/// core it runs on. Writers never block: a slot is claimed with an atomic increment and published with a sequence
+/// number so the reader can drop slots that were being overwritten while it copied them. A tracepoint costs a few
+/// dozen cycles - well under a microsecond at 240MHz.
+///
+/// CCOUNT is per core and its rate follows the CPU clock, so each loop calls TraceSync() to record a (CCOUNT,
+/// esp_timer) pair - the dump converts cycles to microseconds by interpolating between these sync points.
+/// The ring can be downloaded from the web server as Chrome trace_event JSON (load it in chrome://tracing or Perfetto).
+
+#include <Arduino.h>
+#include <xtensa/hal.h>
+
+#include <atomic>
+
+#ifndef PZEM_TRACE_ENABLED
+#define PZEM_TRACE_ENABLED 1
+#endif
+
+/// Keep traceEventNames[] in trace.cpp in step with this list
+enum TraceEventId : uint16_t
+{
+  TRACE_SYNC,             // Internal - (CCOUNT, esp_timer) pair used to convert cycles to time
+  TRACE_PZEM_READ,        // extractPZEM_Info() - Modbus read + MQTT publish
+  TRACE_DISPLAY_PAGE0,
+  TRACE_DISPLAY_PAGE1,
+  TRACE_DISPLAY_PAGE2,
+  TRACE_TOUCH_SCAN,
+  TRACE_NETWORK_LOOP,
+  TRACE_MQTT_LOOP,
+  TRACE_MQTT_PUBLISH,     // arg = payload bytes
+  TRACE_MQTT_RECONNECT,
+  TRACE_STRIP_FLUSH,      // arg = first row of the strip
+  TRACE_EVENT_COUNT
+};
+
+enum TracePhase : uint8_t
+{
+  TRACE_BEGIN   = 'B',
+  TRACE_END     = 'E',
+  TRACE_INSTANT = 'i',
+};
+
+struct TraceRecord
+{
+  std::atomic<uint32_t> seq;  // Index the slot was last written for - the reader uses it to spot torn / stale slots
+  uint32_t ccount;
+  uint32_t arg;
+  uint16_t id;
+  uint8_t phase;
+};
+
+struct TraceRing
+{
+  static const uint32_t size = 256; // Must be a power of two
+
+  std::atomic<uint32_t> head;
+  TraceRecord records[size];
+};
+
+extern TraceRing traceRings[portNUM_PROCESSORS];
+
+inline void TraceEmit(TraceEventId id, TracePhase phase, uint32_t arg = 0)
+{
+#if PZEM_TRACE_ENABLED
+  TraceRing & ring = traceRings[xPortGetCoreID()];
+
+  // Atomic as a task on the same core can pre-empt us between claiming and filling a slot
+  uint32_t index = ring.head.fetch_add(1, std::memory_order_relaxed);
+  TraceRecord & record = ring.records[index & (TraceRing::size - 1)];
+
+  record.seq.store(~index, std::memory_order_relaxed); // Mark as being written
+  std::atomic_thread_fence(std::memory_order_release);
+  record.ccount = xthal_get_ccount();
+  record.arg = arg;
+  record.id = id;
+  record.phase = phase;
+  record.seq.store(index, std::memory_order_release);
+#endif
+}
+
+/// Record the current (CCOUNT, esp_timer) pair for this core - call once per pass of each traced loop
+void TraceSync();
+
+/// Emits a begin event on construction and the matching end event when it goes out of scope
+class TraceScope
+{
+public:
+  TraceScope(TraceEventId id, uint32_t arg = 0) : id(id) { TraceEmit(id, TRACE_BEGIN, arg); }
+  ~TraceScope() { TraceEmit(id, TRACE_END); }
+
+private:
+  TraceEventId id;
+};
+
+#define TRACE_CONCAT2(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT2(a, b)
+#define TRACE_SCOPE(...) TraceScope TRACE_CONCAT(traceScope, __LINE__)(__VA_ARGS__)
+
+/// Write the contents of the rings as Chrome trace_event JSON (streamed - the output is far too big for a String)
+void TraceDumpChromeJson(Print & out);
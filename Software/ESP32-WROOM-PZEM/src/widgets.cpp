@@ -0,0 +1,220 @@
+#include <Adafruit_ST77xx.h>
+
+#include "digit_font.hpp"
+#include "widgets.hpp"
+
+PageView::PageView(const PageSpec & spec) : spec(spec), states(spec.count)
+{
+  for(size_t i = 0; i < spec.count; ++i)
+  {
+    const WidgetSpec & widget = spec.widgets[i];
+    WidgetState & state = states[i];
+
+    switch(widget.type)
+    {
+      case WIDGET_TEXT:
+      case WIDGET_VALUE:
+        state.cells.push_back(Cell{TextField(widget.x, widget.y, widget.textSize, widget.length,
+                                             widget.type == WIDGET_VALUE, widget.textSize == 3), ""});
+        break;
+
+      case WIDGET_LIST:
+        for(uint8_t row = 0; row < widget.rows; ++row)
+          state.cells.push_back(Cell{TextField(widget.x, widget.y + row * widget.h, widget.textSize, widget.length), ""});
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  invalidate();
+}
+
+void PageView::invalidate()
+{
+  for(WidgetState & state : states)
+  {
+    for(Cell & cell : state.cells)
+      cell.field.invalidate(spec.bg);
+    state.shownColor = -1;
+    state.dirty = true;
+  }
+}
+
+int16_t PageView::chartLeft() const
+{
+  int16_t left = INT16_MAX;
+  for(size_t i = 0; i < spec.count; ++i)
+  {
+    if(spec.widgets[i].type == WIDGET_CHART)
+      left = min(left, spec.widgets[i].x);
+  }
+  return left;
+}
+
+void PageView::update(size_t i)
+{
+  const WidgetSpec & widget = spec.widgets[i];
+  WidgetState & state = states[i];
+
+  state.damage = Rect();
+  Rect cellDamage;
+
+  switch(widget.type)
+  {
+    case WIDGET_LABEL:
+      break; // Only changes with a full redraw
+
+    case WIDGET_TEXT:
+    case WIDGET_VALUE:
+    case WIDGET_LIST:
+      for(size_t row = 0; row < state.cells.size(); ++row)
+      {
+        Cell & cell = state.cells[row];
+        if(widget.type == WIDGET_VALUE)
+          snprintf(cell.text, sizeof(cell.text), widget.text, widget.value());
+        else if(widget.type == WIDGET_TEXT || (int)row < widget.count())
+          widget.textFn(row, cell.text, sizeof(cell.text));
+        else
+          cell.text[0] = 0;
+
+        if(cell.field.damage(cell.text, spec.color, spec.bg, cellDamage))
+          state.damage.unite(cellDamage);
+      }
+      break;
+
+    case WIDGET_STATUS:
+      state.color = widget.flag() ? ST77XX_GREEN : ST77XX_RED;
+      if(state.color != state.shownColor)
+      {
+        state.damage.x = widget.x;
+        state.damage.y = widget.y;
+        state.damage.w = widget.w;
+        state.damage.h = widget.h;
+      }
+      break;
+
+    case WIDGET_CHART:
+      // The chart keeps track of its own new columns - let it decide what to send
+      state.damage.x = widget.x;
+      state.damage.y = widget.y;
+      state.damage.w = widget.w;
+      state.damage.h = widget.h;
+      break;
+  }
+
+  state.dirty = !state.damage.empty();
+}
+
+void PageView::draw(Adafruit_GFX & gfx, size_t i, bool full)
+{
+  const WidgetSpec & widget = spec.widgets[i];
+  WidgetState & state = states[i];
+
+  switch(widget.type)
+  {
+    case WIDGET_LABEL:
+      if(full)
+      {
+        gfx.setTextColor(spec.color, spec.bg);
+        gfx.setTextSize(widget.textSize);
+        gfx.setCursor(widget.x, widget.y);
+        gfx.print(widget.text);
+      }
+      break;
+
+    case WIDGET_TEXT:
+    case WIDGET_VALUE:
+    case WIDGET_LIST:
+      for(Cell & cell : state.cells)
+        cell.field.draw(gfx, cell.text, spec.color, spec.bg);
+
+      // The unit sits just to the right of the (right aligned) value
+      if(widget.type == WIDGET_VALUE && full && widget.unit[0])
+      {
+        int16_t x = state.cells[0].field.right();
+        if(widget.textSize == 3)
+        {
+          DigitFontDrawText(gfx, x, widget.y, widget.unit, spec.color, spec.bg);
+        }
+        else
+        {
+          gfx.setTextColor(spec.color, spec.bg);
+          gfx.setTextSize(widget.textSize);
+          gfx.setCursor(x, widget.y);
+          gfx.print(widget.unit);
+        }
+      }
+      break;
+
+    case WIDGET_STATUS:
+      gfx.fillRect(widget.x, widget.y, widget.w, widget.h, state.color);
+      state.shownColor = state.color;
+      break;
+
+    case WIDGET_CHART:
+      break; // Drawn by drawCharts()
+  }
+
+  state.dirty = false;
+}
+
+void PageView::sample()
+{
+  for(size_t i = 0; i < spec.count; ++i)
+    update(i);
+}
+
+void PageView::paint(Adafruit_GFX & gfx, bool full)
+{
+  for(size_t i = 0; i < spec.count; ++i)
+  {
+    if(full || states[i].dirty)
+    {
+      frameDamage.unite(states[i].damage);
+      draw(gfx, i, full);
+      ++drawn;
+    }
+  }
+}
+
+void PageView::drawCharts(Adafruit_GFX & gfx, bool full)
+{
+  for(size_t i = 0; i < spec.count; ++i)
+  {
+    if(spec.widgets[i].type == WIDGET_CHART)
+      spec.widgets[i].chart(gfx, full);
+  }
+}
+
+void PageView::startFrame(bool full)
+{
+  frameDamage = Rect();
+  drawn = 0;
+
+  // The widgets' data is read once per frame - the tasks that change it can run while the frame is drawn
+  if(full)
+    invalidate();
+  sample();
+}
+
+void PageView::render(Adafruit_GFX & gfx, bool full)
+{
+  startFrame(full);
+
+  if(full)
+  {
+    // A chart reaches the right hand edge and paints its own area - only the rest of the page is cleared
+    int16_t left = min(chartLeft(), gfx.width());
+    gfx.fillRect(0, 0, left, gfx.height(), spec.bg);
+    if(left == gfx.width())
+    {
+      frameDamage.w = gfx.width();
+      frameDamage.h = gfx.height();
+    }
+  }
+
+  paint(gfx, full);
+  drawCharts(gfx, full);
+}
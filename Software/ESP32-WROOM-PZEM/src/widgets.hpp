@@ -0,0 +1,146 @@
+#pragma once
+
+/// Small widget toolkit for the TFT pages. A page is a constexpr table of widgets (see the Label() / Value() / ...
+/// helpers below) plus its colours; a PageView keeps the retained state for one page and draws it.
+///
+/// Widgets pull their data through plain functions, so the tables need no objects. Each frame every widget samples
+/// its data once and works out whether it changed and which area that damages; only damaged widgets are drawn, and
+/// text only repaints the character cells that differ (see TextField). A full redraw on the panel goes through the
+/// strip renderer - except on pages with a chart, which paints its own area and has only the rest of the page cleared.
+///
+/// A page can be drawn to any Adafruit_GFX, so tools/host_render.cpp renders the firmware's pages on the host.
+
+#include <vector>
+
+#include "text_field.hpp"
+
+class CountingST7789;
+
+enum WidgetType : uint8_t
+{
+  WIDGET_LABEL,   // Fixed text - drawn on full redraws only
+  WIDGET_TEXT,    // Text from a function
+  WIDGET_VALUE,   // Number from a function, right aligned, followed by a fixed unit
+  WIDGET_STATUS,  // Box that is green or red
+  WIDGET_LIST,    // Column of text rows from a function
+  WIDGET_CHART,   // Something that draws itself to the panel (a ScrollingChart)
+};
+
+typedef float (*WidgetValueFn)();
+typedef bool (*WidgetFlagFn)();
+typedef int (*WidgetCountFn)();
+typedef void (*WidgetTextFn)(int index, char * text, size_t size);   // index is the list row (0 for WIDGET_TEXT)
+typedef void (*WidgetChartFn)(Adafruit_GFX & gfx, bool full);
+
+/// One entry of a page layout - use the helpers rather than filling this in by hand
+struct WidgetSpec
+{
+  WidgetType type;
+  int16_t x;
+  int16_t y;
+  int16_t w;            // Status box / chart size
+  int16_t h;
+  uint8_t textSize;
+  uint8_t length;       // Characters in a text / value / list row
+  uint8_t rows;         // List rows, "h" pixels apart
+  const char * text;    // Label text or value format
+  const char * unit;    // Value unit
+  WidgetValueFn value;
+  WidgetFlagFn flag;
+  WidgetTextFn textFn;
+  WidgetCountFn count;
+  WidgetChartFn chart;
+};
+
+constexpr WidgetSpec Label(int16_t x, int16_t y, uint8_t textSize, const char * text)
+{
+  return WidgetSpec{WIDGET_LABEL, x, y, 0, 0, textSize, 0, 0, text, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
+}
+
+constexpr WidgetSpec Text(int16_t x, int16_t y, uint8_t textSize, uint8_t length, WidgetTextFn text)
+{
+  return WidgetSpec{WIDGET_TEXT, x, y, 0, 0, textSize, length, 0, nullptr, nullptr, nullptr, nullptr, text, nullptr, nullptr};
+}
+
+/// Size 3 values (and their units) use the digit sprite font
+constexpr WidgetSpec Value(int16_t x, int16_t y, uint8_t textSize, uint8_t length, WidgetValueFn value,
+                           const char * format, const char * unit)
+{
+  return WidgetSpec{WIDGET_VALUE, x, y, 0, 0, textSize, length, 0, format, unit, value, nullptr, nullptr, nullptr, nullptr};
+}
+
+constexpr WidgetSpec Status(int16_t x, int16_t y, int16_t w, int16_t h, WidgetFlagFn flag)
+{
+  return WidgetSpec{WIDGET_STATUS, x, y, w, h, 0, 0, 0, nullptr, nullptr, nullptr, flag, nullptr, nullptr, nullptr};
+}
+
+constexpr WidgetSpec List(int16_t x, int16_t y, uint8_t textSize, uint8_t length, uint8_t rows, int16_t pitch,
+                          WidgetCountFn count, WidgetTextFn text)
+{
+  return WidgetSpec{WIDGET_LIST, x, y, 0, pitch, textSize, length, rows, nullptr, nullptr, nullptr, nullptr, text, count, nullptr};
+}
+
+/// Charts must reach the right hand edge of the screen - only the area to their left is cleared on a full redraw
+constexpr WidgetSpec Chart(int16_t x, int16_t y, int16_t w, int16_t h, WidgetChartFn chart)
+{
+  return WidgetSpec{WIDGET_CHART, x, y, w, h, 0, 0, 0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, chart};
+}
+
+struct PageSpec
+{
+  const WidgetSpec * widgets;
+  uint8_t count;
+  uint16_t color;   // Text colour
+  uint16_t bg;
+};
+
+class PageView
+{
+public:
+  explicit PageView(const PageSpec & spec);
+
+  /// Bring the screen up to date - "full" repaints the whole page (it has just been switched to). Draws straight to
+  /// "gfx", one primitive at a time
+  void render(Adafruit_GFX & gfx, bool full);
+
+  /// The same on the panel, where a full redraw of a page without a chart goes through the strip renderer
+  /// (widgets_panel.cpp)
+  void render(CountingST7789 & tft, bool full);
+
+  /// Union of the areas the last render() drew and the number of widgets that needed drawing
+  const Rect & damage() const { return frameDamage; }
+  int widgetsDrawn() const { return drawn; }
+
+private:
+  struct Cell
+  {
+    TextField field;
+    char text[TextField::maxLength + 1];
+  };
+
+  struct WidgetState
+  {
+    std::vector<Cell> cells;  // One per text / value, one per list row
+    int32_t shownColor;       // Status box colour on the screen (-1 == not drawn)
+    int32_t color;            // ...and the colour it should be
+    bool dirty;
+    Rect damage;
+  };
+
+  const PageSpec & spec;
+  std::vector<WidgetState> states;
+  Rect frameDamage;
+  int drawn = 0;
+
+  void invalidate();
+  void startFrame(bool full);
+  void update(size_t i);
+  void sample();          // update() every widget - the snapshot of their data that paint() draws
+  void draw(Adafruit_GFX & gfx, size_t i, bool full);
+  void paint(Adafruit_GFX & gfx, bool full);
+  void drawCharts(Adafruit_GFX & gfx, bool full);
+  int16_t chartLeft() const;
+
+  static PageView * stripPage;
+  static void paintStrip(Adafruit_GFX & gfx);
+};
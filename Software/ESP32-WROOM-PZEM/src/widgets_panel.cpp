@@ -0,0 +1,34 @@
+#include "counting_st7789.hpp"
+#include "instrumentation.hpp"
+#include "strip_renderer.hpp"
+#include "widgets.hpp"
+
+PageView * PageView::stripPage = NULL;
+
+void PageView::paintStrip(Adafruit_GFX & gfx)
+{
+  // Every strip is painted from scratch, so the widgets forget what they drew in the previous one - all from the
+  // values sampled before the frame, so every strip shows the same ones
+  stripPage->invalidate();
+  gfx.fillScreen(stripPage->spec.bg);
+  stripPage->drawn = 0;
+  stripPage->paint(gfx, true);
+}
+
+void PageView::render(CountingST7789 & tft, bool full)
+{
+  if(!full || chartLeft() != INT16_MAX)
+  {
+    render(static_cast<Adafruit_GFX &>(tft), full);
+    return;
+  }
+
+  startFrame(full);
+
+  stripPage = this;
+  FrameStats stats = StripRenderFrame(paintStrip);
+  RecordFrame(stats.frameMicros, stats.paintMicros);
+
+  frameDamage.w = tft.width();
+  frameDamage.h = tft.height();
+}
@@ -0,0 +1,122 @@
+/// Host benchmark for ScrollingChart (src/scrolling_chart.hpp) - draw cost and memory, without the panel.
+///
+///   g++ -O2 -std=gnu++11 -I src tools/chart_benchmark.cpp -o /tmp/chart_benchmark && /tmp/chart_benchmark
+///
+/// The backends only checksum the column pixels, so the times are the chart's own work. The std::function backend
+/// is there for comparison with drawing through a type erased callable (what the old SparkLine did per segment).
+
+#include <stdio.h>
+
+#include <chrono>
+#include <functional>
+
+#include "scrolling_chart.hpp"
+
+namespace
+{
+  const int16_t width = 220;
+  const int16_t height = 240;
+
+  struct InlineBackend
+  {
+    uint32_t checksum = 0;
+    uint32_t columns = 0;
+
+    void begin(bool, uint16_t) {}
+    void labels(float, float, uint32_t, uint16_t, uint16_t) {}
+    void scrollTo(int16_t slot) { checksum += slot; }
+
+    void column(int16_t slot, const uint16_t * pixels)
+    {
+      for(int16_t i = 0; i < height; ++i)
+        checksum += pixels[i] ^ slot;
+      ++columns;
+    }
+  };
+
+  struct FunctionBackend
+  {
+    std::function<void(int16_t, const uint16_t *)> columnFn;
+    uint32_t columns = 0;
+
+    void begin(bool, uint16_t) {}
+    void labels(float, float, uint32_t, uint16_t, uint16_t) {}
+    void scrollTo(int16_t) {}
+    void column(int16_t slot, const uint16_t * pixels) { columnFn(slot, pixels); ++columns; }
+  };
+
+  double secondsSince(std::chrono::steady_clock::time_point start)
+  {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  /// Something like a household: a base load with a kettle now and then
+  template<typename T>
+  T sample(uint32_t i)
+  {
+    uint32_t noise = (i * 2654435761u) >> 24;
+    return (T)(300 + noise + ((i % 900) < 120 ? 2500 : 0));
+  }
+
+  template<typename T, class Backend>
+  void run(const char * name, Backend & backend)
+  {
+    typedef ScrollingChart<T, width, height, Backend> Chart;
+    static Chart chart;   // Too big for the stack in some configurations - as on the device, it lives in .bss
+
+    const uint32_t day = 86400;
+    auto start = std::chrono::steady_clock::now();
+    for(uint32_t i = 0; i < day; ++i)
+      chart.add(sample<T>(i));
+    double addSeconds = secondsSince(start);
+
+    // Full redraws at the most and least detailed zoom levels - the cost should not depend on the span
+    const int fullDraws = 200;
+    double fullSeconds[2];
+    for(int zoom = 0; zoom < 2; ++zoom)
+    {
+      start = std::chrono::steady_clock::now();
+      for(int i = 0; i < fullDraws; ++i)
+        chart.draw(backend, true, 0xffff, 0);
+      fullSeconds[zoom] = secondsSince(start) / fullDraws;
+
+      for(int step = 0; step < 4; ++step)
+        chart.zoom();  // 0 -> 9
+    }
+    chart.zoom();      // Back to level 0
+
+    // One new sample per draw - the steady state on the device
+    const int incrementalDraws = 20000;
+    start = std::chrono::steady_clock::now();
+    for(int i = 0; i < incrementalDraws; ++i)
+    {
+      chart.add(sample<T>(day + i));
+      chart.draw(backend, false, 0xffff, 0);
+    }
+    double incrementalSeconds = secondsSince(start) / incrementalDraws;
+
+    printf("%-24s %6u bytes  add %6.1f ns  full draw %7.1f us (level 0) %7.1f us (level 9)  add+draw %6.2f us\n",
+           name, (unsigned)sizeof(Chart), addSeconds * 1e9 / day, fullSeconds[0] * 1e6, fullSeconds[1] * 1e6,
+           incrementalSeconds * 1e6);
+  }
+}
+
+int main()
+{
+  InlineBackend inlineBackend;
+  run<float>("float, inline", inlineBackend);
+  run<uint16_t>("uint16_t, inline", inlineBackend);
+  run<int32_t>("int32_t, inline", inlineBackend);
+
+  uint32_t checksum = 0;
+  FunctionBackend functionBackend;
+  functionBackend.columnFn = [&checksum](int16_t slot, const uint16_t * pixels)
+  {
+    for(int16_t i = 0; i < height; ++i)
+      checksum += pixels[i] ^ slot;
+  };
+  run<float>("float, std::function", functionBackend);
+
+  printf("(checksums %u %u)\n", (unsigned)inlineBackend.checksum, (unsigned)checksum);
+  return 0;
+}
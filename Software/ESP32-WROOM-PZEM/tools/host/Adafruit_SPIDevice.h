@@ -0,0 +1,3 @@
+#pragma once
+
+// Adafruit_GFX.h includes the BusIO headers for the OLED and SPITFT classes - not needed on the host
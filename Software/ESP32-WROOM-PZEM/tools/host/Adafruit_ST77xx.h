@@ -0,0 +1,14 @@
+#pragma once
+
+/// The colour names from the Adafruit ST77xx library, for the page tables (src/pages.cpp) on the host - the driver
+/// itself is not needed there, pages are drawn into a FramebufferGFX.
+
+#define ST77XX_BLACK 0x0000
+#define ST77XX_WHITE 0xFFFF
+#define ST77XX_RED 0xF800
+#define ST77XX_GREEN 0x07E0
+#define ST77XX_BLUE 0x001F
+#define ST77XX_CYAN 0x07FF
+#define ST77XX_MAGENTA 0xF81F
+#define ST77XX_YELLOW 0xFFE0
+#define ST77XX_ORANGE 0xFC00
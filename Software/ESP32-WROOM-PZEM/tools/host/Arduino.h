@@ -0,0 +1,48 @@
+#pragma once
+
+/// Just enough of the Arduino core to build Adafruit_GFX and the display code on the host - see tools/host_render.cpp.
+/// Build with -DARDUINO=100 and this directory first on the include path.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <new>
+#include <string>
+
+#include "Print.h"
+
+using std::min;
+using std::max;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(s))
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_pointer(addr) ((void *)*(void * const *)(addr))
+#define strlen_P strlen
+
+class __FlashStringHelper;
+
+class String
+{
+public:
+  String(const char * text = "") : text(text) {}
+
+  unsigned int length() const { return text.length(); }
+  const char * c_str() const { return text.c_str(); }
+
+private:
+  std::string text;
+};
+
+/// Time stands still on the host, so anything that prints it renders the same every run
+inline uint32_t millis() { return 0; }
+inline void delay(uint32_t) {}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+
+class Print
+{
+public:
+  virtual ~Print() {}
+
+  virtual size_t write(uint8_t c) = 0;
+
+  virtual size_t write(const uint8_t * buffer, size_t size)
+  {
+    size_t n = 0;
+    while(size--)
+      n += write(*buffer++);
+    return n;
+  }
+
+  size_t print(const char * text) { return write((const uint8_t *)text, strlen(text)); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int value, int base = DEC) { return print((long)value, base); }
+  size_t print(unsigned value, int base = DEC) { return print((unsigned long)value, base); }
+  size_t print(long value, int base = DEC) { return base == DEC ? printf("%ld", value) : print((unsigned long)value, base); }
+  size_t print(unsigned long value, int base = DEC)
+  {
+    return printf(base == HEX ? "%lX" : base == OCT ? "%lo" : "%lu", value);
+  }
+  size_t print(double value, int digits = 2) { return printf("%.*f", digits, value); }
+  size_t println() { return print("\r\n"); }
+  size_t println(const char * text) { return print(text) + println(); }
+
+  size_t printf(const char * format, ...) __attribute__((format(printf, 2, 3)))
+  {
+    char text[256];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    if(length < 0)
+      return 0;
+    return write((const uint8_t *)text, (size_t)length < sizeof(text) ? (size_t)length : sizeof(text) - 1);
+  }
+};
+
+/// Print to a stdio stream
+class FilePrint : public Print
+{
+public:
+  explicit FilePrint(FILE * file) : file(file) {}
+
+  size_t write(uint8_t c) override { return fputc(c, file) == EOF ? 0 : 1; }
+  size_t write(const uint8_t * buffer, size_t size) override { return fwrite(buffer, 1, size, file); }
+
+private:
+  FILE * file;
+};
@@ -0,0 +1,273 @@
+/// Renders the firmware's TFT pages (src/pages.cpp) on the host into FramebufferGFX (src/framebuffer_gfx.hpp) at the
+/// panel's rotation - a PPM per page, the transfer cost each redraw would have on the ST7789, and a pixel exact
+/// comparison against the same pages rendered earlier.
+///
+///   GFX=~/.platformio/.../libdeps/nodemcu-32s/Adafruit\ GFX\ Library   (or any checkout of Adafruit GFX)
+///   g++ -O2 -std=gnu++11 -DARDUINO=100 -I tools/host -I src -I "$GFX" tools/host_render.cpp src/pages.cpp
+///       src/widgets.cpp src/text_field.cpp src/digit_font.cpp src/chart_labels.cpp src/framebuffer_gfx.cpp
+///       "$GFX/Adafruit_GFX.cpp" -o /tmp/host_render
+///   /tmp/host_render /tmp/before                              write /tmp/before/page0.ppm ...
+///   /tmp/host_render /tmp/after --golden /tmp/before          ...and fail (exit 1) if a page differs or is missing
+///
+/// No reference images are kept in the repository - the text is drawn with the Adafruit GFX font, so they would only
+/// hold for one version of the library. Render the pages before a change and compare after it, with the same GFX.
+///
+/// The page data functions are implemented here with fixed readings, so every run draws the same frames. The pages go
+/// through PageView::render(Adafruit_GFX &) - the same widgets a strip of a full panel redraw is painted with. The
+/// power chart is drawn with a backend that writes its columns the way the panel backend does and shows the plot in
+/// frame memory order - as the panel looks with hardware scrolling off.
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include <Adafruit_ST77xx.h>
+
+#include "chart_labels.hpp"
+#include "framebuffer_gfx.hpp"
+#include "pages.hpp"
+#include "scrolling_chart.hpp"
+
+namespace
+{
+  // As the panel: 240x280 portrait, at setRotation(3) - see setup() in main.cpp
+  const int16_t panelWidth = 240;
+  const int16_t panelHeight = 280;
+  const uint8_t panelRotation = 3;
+
+  // The chart on page 1 - as the St7789ChartBackend in main.cpp
+  const int16_t plotX = 60;
+  const int16_t plotWidth = 220;
+  const int16_t plotHeight = 240;
+
+  /// Same transfers and labels as St7789ChartBackend, minus the hardware scroll
+  class FramebufferChartBackend
+  {
+  public:
+    FramebufferChartBackend() : axisLabels(plotX, 0, plotHeight) {}
+
+    void setDisplay(FramebufferGFX * display) { gfx = display; }
+
+    /// As St7789ChartBackend - the page has cleared the label band
+    void invalidateLabels(uint16_t bg) { axisLabels.invalidate(bg); }
+
+    void begin(bool, uint16_t) {}
+
+    void column(int16_t slot, const uint16_t * pixels)
+    {
+      gfx->setAddrWindow(plotX + slot, 0, 1, plotHeight);
+      gfx->writePixels(pixels, plotHeight);
+    }
+
+    void labels(float low, float high, uint32_t samplesShown, uint16_t color, uint16_t bg)
+    {
+      axisLabels.draw(*gfx, low, high, samplesShown, color, bg);
+    }
+
+    void scrollTo(int16_t) {}
+
+  private:
+    FramebufferGFX * gfx = NULL;
+    ChartLabels axisLabels;
+  };
+
+  ScrollingChart<float, plotWidth, plotHeight, FramebufferChartBackend> powerUsage;
+  FramebufferChartBackend powerChart;
+
+  /// Readings for the pages - the second set is used for the redraw after new readings
+  struct Readings
+  {
+    float voltage;
+    float current;
+    float power;
+    float energy;
+    float frequency;
+    float pf;
+  };
+
+  const Readings readings[2] =
+  {
+    {230.41f, 2.17f, 468.0f, 1523.4f, 50.01f, 0.94f},
+    {230.47f, 2.19f, 472.0f, 1523.5f, 50.00f, 0.94f},
+  };
+  const Readings * shown = &readings[0];
+
+  const char * const networks[][2] =
+  {
+    {"HomeNetwork", "-48"},
+    {"HomeNetwork-5G", "-55"},
+    {"Workshop", "-71"},
+    {"NEIGHBOUR_2G", "-83"},
+    {"PrinterSetup", "-90"},
+  };
+
+  /// Something like a household: a base load with a kettle now and then
+  float sample(uint32_t i)
+  {
+    uint32_t noise = (i * 2654435761u) >> 24;
+    return (float)(300 + noise + ((i % 900) < 120 ? 2500 : 0));
+  }
+
+  void report(const char * step, FramebufferGFX & gfx)
+  {
+    printf("%-28s %8u bytes %6u windows %8u pixels\n", step, (unsigned)gfx.spiBytes(), (unsigned)gfx.addressWindows(),
+           (unsigned)gfx.pixelsWritten());
+    gfx.resetCounters();
+  }
+
+  bool writePPM(const std::string & path, const FramebufferGFX & gfx)
+  {
+    FILE * file = fopen(path.c_str(), "wb");
+    if(file == NULL)
+    {
+      perror(path.c_str());
+      return false;
+    }
+    FilePrint out(file);
+    gfx.writePPM(out);
+    return fclose(file) == 0;
+  }
+
+  bool readPPM(const std::string & path, int & width, int & height, std::vector<uint8_t> & rgb)
+  {
+    FILE * file = fopen(path.c_str(), "rb");
+    if(file == NULL)
+      return false;
+
+    int maximum = 0;
+    bool ok = fscanf(file, "P6 %d %d %d", &width, &height, &maximum) == 3 && maximum == 255 && fgetc(file) != EOF;
+    if(ok)
+    {
+      rgb.resize((size_t)width * height * 3);
+      ok = fread(rgb.data(), 1, rgb.size(), file) == rgb.size();
+    }
+    fclose(file);
+    return ok;
+  }
+
+  /// Number of pixels that differ from the reference image (-1 if either cannot be read or they are different sizes)
+  long compare(const std::string & frame, const std::string & golden)
+  {
+    int width[2], height[2];
+    std::vector<uint8_t> rgb[2];
+    if(!readPPM(frame, width[0], height[0], rgb[0]) || !readPPM(golden, width[1], height[1], rgb[1]) ||
+       width[0] != width[1] || height[0] != height[1])
+      return -1;
+
+    long differences = 0;
+    for(size_t i = 0; i < rgb[0].size(); i += 3)
+    {
+      if(memcmp(&rgb[0][i], &rgb[1][i], 3) != 0)
+        ++differences;
+    }
+    return differences;
+  }
+}
+
+/// Page data (see pages.hpp)
+float pzemVoltage() { return shown->voltage; }
+float pzemCurrent() { return shown->current; }
+float pzemPower() { return shown->power; }
+float pzemEnergy() { return shown->energy; }
+float pzemFrequency() { return shown->frequency; }
+float pzemPowerFactor() { return shown->pf; }
+
+bool networkUp() { return true; }
+bool mqttUp() { return false; }
+bool pzemUp() { return true; }
+
+void pzemAddressText(int, char * text, size_t size)
+{
+  snprintf(text, size, "%u", 248u);
+}
+
+void ipAddressText(int, char * text, size_t size)
+{
+  snprintf(text, size, "%s", "192.168.1.20");
+}
+
+int networkCount() { return sizeof(networks) / sizeof(networks[0]); }
+
+void networkName(int index, char * text, size_t size)
+{
+  snprintf(text, size, "%s", networks[index][0]);
+}
+
+void networkStrength(int index, char * text, size_t size)
+{
+  snprintf(text, size, "%s", networks[index][1]);
+}
+
+void drawPowerChart(Adafruit_GFX &, bool full)
+{
+  if(full)
+    powerChart.invalidateLabels(ST77XX_ORANGE);
+  powerUsage.draw(powerChart, full, ST77XX_BLACK, ST77XX_ORANGE);
+}
+
+int main(int argc, char ** argv)
+{
+  if(argc != 2 && !(argc == 4 && strcmp(argv[2], "--golden") == 0))
+  {
+    fprintf(stderr, "usage: %s directory [--golden reference-directory]\n", argv[0]);
+    return 2;
+  }
+  std::string directory = argv[1];
+
+  static FramebufferGFX gfx(panelWidth, panelHeight);
+  gfx.setRotation(panelRotation);
+  powerChart.setDisplay(&gfx);
+
+  // A day of samples for the chart
+  for(uint32_t i = 0; i < 86400; ++i)
+    powerUsage.add(sample(i));
+
+  int failures = 0;
+  for(int page = 0; page < DISPLAY_PAGE_COUNT; ++page)
+  {
+    char name[32];
+    PageView view(pageSpecs[page]);
+    shown = &readings[0];
+
+    gfx.fillScreen(ST77XX_RED);   // As the panel before the first page - anything the page fails to draw shows
+    gfx.resetCounters();
+    view.render(gfx, true);
+    snprintf(name, sizeof(name), "page %d, full redraw", page);
+    report(name, gfx);
+
+    // What a refresh with new readings (and a new chart sample) sends
+    shown = &readings[1];
+    powerUsage.add(sample(86400 + page));
+    view.render(gfx, false);
+    snprintf(name, sizeof(name), "page %d, new readings", page);
+    report(name, gfx);
+
+    snprintf(name, sizeof(name), "/page%d.ppm", page);
+    std::string frame = directory + name;
+    if(!writePPM(frame, gfx))
+      return 2;
+
+    if(argc == 4)
+    {
+      std::string golden = std::string(argv[3]) + name;
+      long differences = compare(frame, golden);
+      if(differences < 0)
+      {
+        fprintf(stderr, "%s: cannot compare with %s\n", frame.c_str(), golden.c_str());
+        ++failures;
+      }
+      else if(differences > 0)
+      {
+        fprintf(stderr, "%s: %ld pixels differ from %s\n", frame.c_str(), differences, golden.c_str());
+        ++failures;
+      }
+      else
+      {
+        printf("%s matches %s\n", frame.c_str(), golden.c_str());
+      }
+    }
+  }
+  return failures ? 1 : 0;
+}
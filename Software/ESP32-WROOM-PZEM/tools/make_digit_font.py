@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+"""Generate src/digit_font_data.hpp - the large anti-aliased digit sprites used for the readings on the TFT.
+
+The glyphs are drawn from simple strokes (lines and elliptical arcs) in a 12 x 20 design box, rasterised into an
+18 x 24 pixel cell (the same cell as the Adafruit 5x7 font at setTextSize(3), so layouts do not change) with 4x4
+supersampling, quantised to 2 bits per pixel and run length encoded.
+
+Encoding: each byte is one run - the top 2 bits are the coverage level (0 = background .. 3 = foreground) and the
+low 6 bits are the run length - 1. Runs go left to right, top to bottom, and may wrap onto the next row.
+
+Run by hand after changing the strokes:   python3 tools/make_digit_font.py
+It is also hooked into the PlatformIO build (extra_scripts) and only rewrites the header when its content changes.
+"""
+
+import math
+import os
+
+CELL_WIDTH = 18
+CELL_HEIGHT = 24
+ORIGIN_X = 3.0          # Where the design box's (0, 0) lands in the cell
+ORIGIN_Y = 2.0
+HALF_STROKE = 1.25      # Pixels either side of the centre line
+SUPERSAMPLE = 4
+
+
+def arc(cx, cy, rx, ry, start, end, steps=24):
+    """Points along an elliptical arc - angles in degrees, y down (so 270 is the top)"""
+    points = []
+    for i in range(steps + 1):
+        a = math.radians(start + (end - start) * i / steps)
+        points.append((cx + rx * math.cos(a), cy + ry * math.sin(a)))
+    return points
+
+
+def ellipse(cx, cy, rx, ry):
+    return arc(cx, cy, rx, ry, 0, 360, 40)
+
+
+# Each glyph is a list of polylines in design coordinates (x 0..12, y 0..20)
+GLYPHS = {
+    ' ': [],
+    '0': [ellipse(6, 10, 5, 9.5)],
+    '1': [[(3, 4), (7, 0), (7, 20)]],
+    '2': [arc(6, 5, 5, 5, 180, 405) + [(1, 20), (11, 20)]],
+    '3': [arc(6, 5, 5, 5, 200, 450), arc(6, 15, 5, 5, 270, 520)],
+    '4': [[(9, 20), (9, 0), (0, 14), (12, 14)]],
+    '5': [[(11, 0), (2, 0), (1, 9)] + arc(6, 14, 5, 6, 235, 530)],
+    '6': [ellipse(6, 14, 5, 6), [(10, 0.5), (6, 2), (3, 5), (1.5, 9), (1, 14)]],
+    '7': [[(0, 0), (12, 0), (4, 20)]],
+    '8': [ellipse(6, 4.75, 4.5, 4.75), ellipse(6, 15, 5.5, 5)],
+    '9': [ellipse(6, 6, 5, 6), [(11, 6), (10.5, 11), (9, 15), (6, 18), (2, 19.5)]],
+    '.': [[(6, 18.5), (6, 18.6)]],
+    '-': [[(2, 11), (10, 11)]],
+    'A': [[(0, 20), (6, 0), (12, 20)], [(2.5, 13), (9.5, 13)]],
+    'F': [[(1, 20), (1, 0), (11, 0)], [(1, 9), (8, 9)]],
+    'H': [[(1, 0), (1, 20)], [(11, 0), (11, 20)], [(1, 10), (11, 10)]],
+    'P': [[(1, 20), (1, 0), (7, 0)] + arc(7, 5, 4, 5, 270, 450) + [(1, 10)]],
+    'V': [[(0, 0), (6, 20), (12, 0)]],
+    'W': [[(0, 0), (3, 20), (6, 6), (9, 20), (12, 0)]],
+    'z': [[(2, 8), (10, 8), (2, 20), (10, 20)]],
+}
+
+
+def distance_to_segment(px, py, ax, ay, bx, by):
+    dx, dy = bx - ax, by - ay
+    length2 = dx * dx + dy * dy
+    t = 0.0 if length2 == 0 else max(0.0, min(1.0, ((px - ax) * dx + (py - ay) * dy) / length2))
+    x, y = ax + t * dx, ay + t * dy
+    return math.hypot(px - x, py - y)
+
+
+def rasterise(strokes):
+    segments = []
+    for line in strokes:
+        points = [(ORIGIN_X + x, ORIGIN_Y + y) for x, y in line]
+        segments += zip(points, points[1:])
+
+    levels = []
+    for row in range(CELL_HEIGHT):
+        for col in range(CELL_WIDTH):
+            covered = 0
+            for sy in range(SUPERSAMPLE):
+                for sx in range(SUPERSAMPLE):
+                    px = col + (sx + 0.5) / SUPERSAMPLE
+                    py = row + (sy + 0.5) / SUPERSAMPLE
+                    if any(distance_to_segment(px, py, a[0], a[1], b[0], b[1]) <= HALF_STROKE for a, b in segments):
+                        covered += 1
+            levels.append(round(3 * covered / (SUPERSAMPLE * SUPERSAMPLE)))
+    return levels
+
+
+def run_length_encode(levels):
+    encoded = []
+    i = 0
+    while i < len(levels):
+        run = 1
+        while i + run < len(levels) and levels[i + run] == levels[i] and run < 64:
+            run += 1
+        encoded.append((levels[i] << 6) | (run - 1))
+        i += run
+    return encoded
+
+
+def generate():
+    data = []
+    entries = []
+    for char in sorted(GLYPHS):
+        encoded = run_length_encode(rasterise(GLYPHS[char]))
+        entries.append((char, len(data), len(encoded)))
+        data += encoded
+
+    lines = [
+        '#pragma once',
+        '',
+        '/// Generated by tools/make_digit_font.py - do not edit by hand.',
+        '/// %d glyphs, %d bytes of 2bpp run length encoded sprites (see the script for the encoding)' % (len(entries), len(data)),
+        '',
+        '#include <Arduino.h>',
+        '',
+        'namespace DigitFontData',
+        '{',
+        '  const uint8_t width = %d;' % CELL_WIDTH,
+        '  const uint8_t height = %d;' % CELL_HEIGHT,
+        '',
+        '  struct Glyph',
+        '  {',
+        '    char character;',
+        '    uint16_t offset;',
+        '    uint16_t length;',
+        '  };',
+        '',
+        '  const Glyph glyphs[] =',
+        '  {',
+    ]
+    for char, offset, length in entries:
+        lines.append("    { '%s', %d, %d }," % (char, offset, length))
+    lines += ['  };', '', '  const uint8_t runs[] PROGMEM =', '  {']
+    for i in range(0, len(data), 16):
+        lines.append('    ' + ', '.join('0x%02x' % b for b in data[i:i + 16]) + ',')
+    lines += ['  };', '}', '']
+    return '\n'.join(lines)
+
+
+def main(project_dir):
+    path = os.path.join(project_dir, 'src', 'digit_font_data.hpp')
+    content = generate()
+
+    existing = None
+    if os.path.exists(path):
+        with open(path) as f:
+            existing = f.read()
+
+    if content != existing:
+        with open(path, 'w') as f:
+            f.write(content)
+        print('Generated ' + path)
+
+
+try:
+    Import('env')  # noqa: F821 - defined when run by PlatformIO as an extra script
+    main(env['PROJECT_DIR'])  # noqa: F821
+except NameError:
+    if __name__ == '__main__':
+        main(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
@@ -0,0 +1,43 @@
+#pragma once
+
+/// Times the tftdraw.cpp routines on a display that counts its SPI traffic (CountingST7789 on the board,
+/// FramebufferGFX from the PZEM project on the host - see tools/host_benchmark.cpp) and prints one CSV line per
+/// routine:
+///
+///   bench,target,spi_mhz,rotation,test,micros,pixels,spi_bytes,windows,pixels_per_s,bytes_per_s
+///
+/// spi_bytes is what the driver would send for the pixels and address windows (not the command overhead of
+/// startWrite() etc.), so bytes_per_s against spi_mhz / 8 shows how much of the bus the routine actually uses.
+
+#include "tftdraw.hpp"
+
+inline void BenchmarkHeader(Print & out)
+{
+  out.println("bench,target,spi_mhz,rotation,test,micros,pixels,spi_bytes,windows,pixels_per_s,bytes_per_s");
+}
+
+/// Run every routine once at the display's current SPI clock - "clockHz" is only printed (0 on the host).
+/// "nowMicros" is the clock to time with
+template<class Display>
+void BenchmarkRun(Display & display, Print & out, const char * target, uint32_t clockHz, uint8_t rotation,
+                  uint64_t (*nowMicros)())
+{
+  display.setRotation(rotation);
+  display.fillScreen(ST77XX_BLACK);
+
+  for(size_t i = 0; i < tftDrawTestCount; ++i)
+  {
+    const TftDrawTest & test = tftDrawTests[i];
+
+    display.resetCounters();
+    uint64_t start = nowMicros();
+    test.run(display);
+    uint64_t micros = nowMicros() - start;
+
+    // Rates over at least a microsecond so a cheap step on a fast clock does not divide by zero
+    double seconds = (micros ? micros : 1) / 1e6;
+    out.printf("bench,%s,%u,%u,%s,%llu,%u,%u,%u,%.0f,%.0f\n", target, (unsigned)(clockHz / 1000000), rotation,
+               test.name, (unsigned long long)micros, (unsigned)display.pixelsWritten(), (unsigned)display.spiBytes(),
+               (unsigned)display.addressWindows(), display.pixelsWritten() / seconds, display.spiBytes() / seconds);
+  }
+}
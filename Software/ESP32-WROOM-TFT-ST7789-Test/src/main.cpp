@@ -4,6 +4,10 @@
 #include <Wire.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_ST7789.h> // Hardware-specific library for ST7789
+#include <esp_timer.h>
+
+#include "benchmark.hpp"
+#include "counting_st7789.hpp"
 
 // On the ESP32 there are two HARDWARE SPI ports - one called VSPI (default) and the other HSPI
 // On my board, HSPI will be used for the TFT LCD and VSPI is used for RFM68HW 
@@ -23,23 +27,12 @@
 //uninitalised pointers to SPI objects
 SPIClass * hspi = NULL;
 
-Adafruit_ST7789 * tft = NULL; 
-
+CountingST7789 * tft = NULL; 
 
+// SPI clocks the benchmark runs at - the HSPI pins are the ESP32's native (IO_MUX) ones, so 80MHz is possible
+const uint32_t benchmarkClocks[] = { 10000000, 20000000, 40000000, 80000000 };
 
-
-/// See tftdraw.cpp for the implementation - copied from the Arduino library examples
-void testlines(uint16_t color);
-void testdrawtext(char *text, uint16_t color);
-void testfastlines(uint16_t color1, uint16_t color2);
-void testdrawrects(uint16_t color);
-void testfillrects(uint16_t color1, uint16_t color2);
-void testfillcircles(uint8_t radius, uint16_t color);
-void testdrawcircles(uint8_t radius, uint16_t color);
-void testtriangles();
-void testroundrects();
-void tftPrintTest();
-void mediabuttons();
+uint64_t nowMicros() { return esp_timer_get_time(); }
 
 void setup() {
   Serial.begin(115200);
@@ -52,7 +45,7 @@ void setup() {
   //SCLK = 14, MISO = 12, MOSI = 13, SS = 15
   hspi->begin();
 
-  tft = new Adafruit_ST7789(hspi,HSPI_SS, TFT_DC, -1);
+  tft = new CountingST7789(hspi,HSPI_SS, TFT_DC, -1);
   tft->init(240, 280);           // Init ST7789 280x240
   // default rotation is if the screen was rotated 90 deg clockwise
   // rotation 1 is upside down
@@ -64,54 +57,21 @@ void setup() {
 
   delay(500);
 
-  // large block of text
-  //tft->fillScreen(ST77XX_BLACK);
-  testdrawtext("Lorem ipsum dolor sit amet, consectetur adipiscing elit. Curabitur adipiscing ante sed nibh tincidunt feugiat. Maecenas enim massa, fringilla sed malesuada et, malesuada sit amet turpis. Sed porttitor neque ut ante pretium vitae malesuada nunc bibendum. Nullam aliquet ultrices massa eu hendrerit. Ut sed nisi lorem. In vestibulum purus a tortor imperdiet posuere. ", ST77XX_WHITE);
-  delay(1000);
-
-  // tft print function!
-  tftPrintTest();
-  delay(4000);
-
-  // a single pixel
-  tft->drawPixel(tft->width()/2, tft->height()/2, ST77XX_GREEN);
-  delay(500);
-
-  // line draw test
-  testlines(ST77XX_YELLOW);
-  delay(500);
-
-  // optimized lines
-  testfastlines(ST77XX_RED, ST77XX_BLUE);
-  delay(500);
-
-  testdrawrects(ST77XX_GREEN);
-  delay(500);
-
-  testfillrects(ST77XX_YELLOW, ST77XX_MAGENTA);
-  delay(500);
-
-  tft->fillScreen(ST77XX_BLACK);
-  testfillcircles(10, ST77XX_BLUE);
-  testdrawcircles(10, ST77XX_WHITE);
-  delay(500);
-
-  testroundrects();
-  delay(500);
-
-  testtriangles();
-  delay(500);
-
-  mediabuttons();
-  delay(500);
+  // The graphics tests (tftdraw.cpp) at every SPI clock and rotation - one CSV line per test, see benchmark.hpp
+  BenchmarkHeader(Serial);
+  for (uint32_t clock : benchmarkClocks) {
+    tft->setSPISpeed(clock);
+    for (uint8_t rotation = 0; rotation < 4; rotation++) {
+      BenchmarkRun(*tft, Serial, "st7789", clock, rotation, nowMicros);
+    }
+  }
+  tft->setSPISpeed(benchmarkClocks[2]);
+  tft->setRotation(3);
 
   Serial.println("done");
-  delay(1000);
-
 }
 
 
 void loop() {
 
 }
-
@@ -1,116 +1,108 @@
 /// These routines were copied from the ST7789 library examples and moved to a separate .cpp file 
 /// so that they did not confuse the important issue - which is to show that the PCB and libraries are working together
 /// and that one can control the TFT screen.
+///
+/// They draw to any Adafruit_GFX, so the same routines run on the panel and on the host (see benchmark.hpp).
 
 #include <Arduino.h>
-#include <Adafruit_GFX.h>
-#include <Adafruit_ST7789.h> // Hardware-specific library for ST7789
 
-extern Adafruit_ST7789 * tft;
+#include "tftdraw.hpp"
 
 float p = 3.1415926;
 
-void testlines(uint16_t color) {
-  tft->fillScreen(ST77XX_BLACK);
-  for (int16_t x=0; x < tft->width(); x+=6) {
-    tft->drawLine(0, 0, x, tft->height()-1, color);
-    delay(0);
+void testlines(Adafruit_GFX & gfx, uint16_t color) {
+  gfx.fillScreen(ST77XX_BLACK);
+  for (int16_t x=0; x < gfx.width(); x+=6) {
+    gfx.drawLine(0, 0, x, gfx.height()-1, color);
   }
-  for (int16_t y=0; y < tft->height(); y+=6) {
-    tft->drawLine(0, 0, tft->width()-1, y, color);
-    delay(0);
+  for (int16_t y=0; y < gfx.height(); y+=6) {
+    gfx.drawLine(0, 0, gfx.width()-1, y, color);
   }
 
-  tft->fillScreen(ST77XX_BLACK);
-  for (int16_t x=0; x < tft->width(); x+=6) {
-    tft->drawLine(tft->width()-1, 0, x, tft->height()-1, color);
-    delay(0);
+  gfx.fillScreen(ST77XX_BLACK);
+  for (int16_t x=0; x < gfx.width(); x+=6) {
+    gfx.drawLine(gfx.width()-1, 0, x, gfx.height()-1, color);
   }
-  for (int16_t y=0; y < tft->height(); y+=6) {
-    tft->drawLine(tft->width()-1, 0, 0, y, color);
-    delay(0);
+  for (int16_t y=0; y < gfx.height(); y+=6) {
+    gfx.drawLine(gfx.width()-1, 0, 0, y, color);
   }
 
-  tft->fillScreen(ST77XX_BLACK);
-  for (int16_t x=0; x < tft->width(); x+=6) {
-    tft->drawLine(0, tft->height()-1, x, 0, color);
-    delay(0);
+  gfx.fillScreen(ST77XX_BLACK);
+  for (int16_t x=0; x < gfx.width(); x+=6) {
+    gfx.drawLine(0, gfx.height()-1, x, 0, color);
   }
-  for (int16_t y=0; y < tft->height(); y+=6) {
-    tft->drawLine(0, tft->height()-1, tft->width()-1, y, color);
-    delay(0);
+  for (int16_t y=0; y < gfx.height(); y+=6) {
+    gfx.drawLine(0, gfx.height()-1, gfx.width()-1, y, color);
   }
 
-  tft->fillScreen(ST77XX_BLACK);
-  for (int16_t x=0; x < tft->width(); x+=6) {
-    tft->drawLine(tft->width()-1, tft->height()-1, x, 0, color);
-    delay(0);
+  gfx.fillScreen(ST77XX_BLACK);
+  for (int16_t x=0; x < gfx.width(); x+=6) {
+    gfx.drawLine(gfx.width()-1, gfx.height()-1, x, 0, color);
   }
-  for (int16_t y=0; y < tft->height(); y+=6) {
-    tft->drawLine(tft->width()-1, tft->height()-1, 0, y, color);
-    delay(0);
+  for (int16_t y=0; y < gfx.height(); y+=6) {
+    gfx.drawLine(gfx.width()-1, gfx.height()-1, 0, y, color);
   }
 }
 
-void testdrawtext(char *text, uint16_t color) {
-  tft->setCursor(0, 0);
-  tft->setTextColor(color);
-  tft->setTextWrap(true);
-  tft->print(text);
+void testdrawtext(Adafruit_GFX & gfx, const char *text, uint16_t color) {
+  gfx.setCursor(0, 0);
+  gfx.setTextColor(color);
+  gfx.setTextWrap(true);
+  gfx.print(text);
 }
 
 
-void testfastlines(uint16_t color1, uint16_t color2) {
-  tft->fillScreen(ST77XX_BLACK);
-  for (int16_t y=0; y < tft->height(); y+=5) {
-    tft->drawFastHLine(0, y, tft->width(), color1);
+void testfastlines(Adafruit_GFX & gfx, uint16_t color1, uint16_t color2) {
+  gfx.fillScreen(ST77XX_BLACK);
+  for (int16_t y=0; y < gfx.height(); y+=5) {
+    gfx.drawFastHLine(0, y, gfx.width(), color1);
   }
-  for (int16_t x=0; x < tft->width(); x+=5) {
-    tft->drawFastVLine(x, 0, tft->height(), color2);
+  for (int16_t x=0; x < gfx.width(); x+=5) {
+    gfx.drawFastVLine(x, 0, gfx.height(), color2);
   }
 }
 
-void testdrawrects(uint16_t color) {
-  tft->fillScreen(ST77XX_BLACK);
-  for (int16_t x=0; x < tft->width(); x+=6) {
-    tft->drawRect(tft->width()/2 -x/2, tft->height()/2 -x/2 , x, x, color);
+void testdrawrects(Adafruit_GFX & gfx, uint16_t color) {
+  gfx.fillScreen(ST77XX_BLACK);
+  for (int16_t x=0; x < gfx.width(); x+=6) {
+    gfx.drawRect(gfx.width()/2 -x/2, gfx.height()/2 -x/2 , x, x, color);
   }
 }
 
-void testfillrects(uint16_t color1, uint16_t color2) {
-  tft->fillScreen(ST77XX_BLACK);
-  for (int16_t x=tft->width()-1; x > 6; x-=6) {
-    tft->fillRect(tft->width()/2 -x/2, tft->height()/2 -x/2 , x, x, color1);
-    tft->drawRect(tft->width()/2 -x/2, tft->height()/2 -x/2 , x, x, color2);
+void testfillrects(Adafruit_GFX & gfx, uint16_t color1, uint16_t color2) {
+  gfx.fillScreen(ST77XX_BLACK);
+  for (int16_t x=gfx.width()-1; x > 6; x-=6) {
+    gfx.fillRect(gfx.width()/2 -x/2, gfx.height()/2 -x/2 , x, x, color1);
+    gfx.drawRect(gfx.width()/2 -x/2, gfx.height()/2 -x/2 , x, x, color2);
   }
 }
 
-void testfillcircles(uint8_t radius, uint16_t color) {
-  for (int16_t x=radius; x < tft->width(); x+=radius*2) {
-    for (int16_t y=radius; y < tft->height(); y+=radius*2) {
-      tft->fillCircle(x, y, radius, color);
+void testfillcircles(Adafruit_GFX & gfx, uint8_t radius, uint16_t color) {
+  for (int16_t x=radius; x < gfx.width(); x+=radius*2) {
+    for (int16_t y=radius; y < gfx.height(); y+=radius*2) {
+      gfx.fillCircle(x, y, radius, color);
     }
   }
 }
 
-void testdrawcircles(uint8_t radius, uint16_t color) {
-  for (int16_t x=0; x < tft->width()+radius; x+=radius*2) {
-    for (int16_t y=0; y < tft->height()+radius; y+=radius*2) {
-      tft->drawCircle(x, y, radius, color);
+void testdrawcircles(Adafruit_GFX & gfx, uint8_t radius, uint16_t color) {
+  for (int16_t x=0; x < gfx.width()+radius; x+=radius*2) {
+    for (int16_t y=0; y < gfx.height()+radius; y+=radius*2) {
+      gfx.drawCircle(x, y, radius, color);
     }
   }
 }
 
-void testtriangles() {
-  tft->fillScreen(ST77XX_BLACK);
+void testtriangles(Adafruit_GFX & gfx) {
+  gfx.fillScreen(ST77XX_BLACK);
   uint16_t color = 0xF800;
   int t;
-  int w = tft->width()/2;
-  int x = tft->height()-1;
+  int w = gfx.width()/2;
+  int x = gfx.height()-1;
   int y = 0;
-  int z = tft->width();
+  int z = gfx.width();
   for(t = 0 ; t <= 15; t++) {
-    tft->drawTriangle(w, y, y, x, z, x, color);
+    gfx.drawTriangle(w, y, y, x, z, x, color);
     x-=4;
     y+=4;
     z-=4;
@@ -118,18 +110,18 @@ void testtriangles() {
   }
 }
 
-void testroundrects() {
-  tft->fillScreen(ST77XX_BLACK);
+void testroundrects(Adafruit_GFX & gfx) {
+  gfx.fillScreen(ST77XX_BLACK);
   uint16_t color = 100;
   int i;
   int t;
   for(t = 0 ; t <= 4; t+=1) {
     int x = 0;
     int y = 0;
-    int w = tft->width()-2;
-    int h = tft->height()-2;
+    int w = gfx.width()-2;
+    int h = gfx.height()-2;
     for(i = 0 ; i <= 16; i+=1) {
-      tft->drawRoundRect(x, y, w, h, 5, color);
+      gfx.drawRoundRect(x, y, w, h, 5, color);
       x+=2;
       y+=3;
       w-=4;
@@ -140,62 +132,91 @@ void testroundrects() {
   }
 }
 
-void tftPrintTest() {
-  tft->setTextWrap(false);
-  tft->fillScreen(ST77XX_BLACK);
-  tft->setCursor(0, 30);
-  tft->setTextColor(ST77XX_RED);
-  tft->setTextSize(1);
-  tft->println("Hello World!");
-  tft->setTextColor(ST77XX_YELLOW);
-  tft->setTextSize(2);
-  tft->println("Hello World!");
-  tft->setTextColor(ST77XX_GREEN);
-  tft->setTextSize(3);
-  tft->println("Hello World!");
-  tft->setTextColor(ST77XX_BLUE);
-  tft->setTextSize(4);
-  tft->print(1234.567);
-  delay(1500);
-  tft->setCursor(0, 0);
-  tft->fillScreen(ST77XX_BLACK);
-  tft->setTextColor(ST77XX_WHITE);
-  tft->setTextSize(0);
-  tft->println("Hello World!");
-  tft->setTextSize(1);
-  tft->setTextColor(ST77XX_GREEN);
-  tft->print(p, 6);
-  tft->println(" Want pi?");
-  tft->println(" ");
-  tft->print(8675309, HEX); // print 8,675,309 out in HEX!
-  tft->println(" Print HEX!");
-  tft->println(" ");
-  tft->setTextColor(ST77XX_WHITE);
-  tft->println("Sketch has been");
-  tft->println("running for: ");
-  tft->setTextColor(ST77XX_MAGENTA);
-  tft->print(millis() / 1000);
-  tft->setTextColor(ST77XX_WHITE);
-  tft->print(" seconds.");
+void tftPrintTest(Adafruit_GFX & gfx) {
+  gfx.setTextWrap(false);
+  gfx.fillScreen(ST77XX_BLACK);
+  gfx.setCursor(0, 30);
+  gfx.setTextColor(ST77XX_RED);
+  gfx.setTextSize(1);
+  gfx.println("Hello World!");
+  gfx.setTextColor(ST77XX_YELLOW);
+  gfx.setTextSize(2);
+  gfx.println("Hello World!");
+  gfx.setTextColor(ST77XX_GREEN);
+  gfx.setTextSize(3);
+  gfx.println("Hello World!");
+  gfx.setTextColor(ST77XX_BLUE);
+  gfx.setTextSize(4);
+  gfx.print(1234.567);
+  gfx.setCursor(0, 0);
+  gfx.fillScreen(ST77XX_BLACK);
+  gfx.setTextColor(ST77XX_WHITE);
+  gfx.setTextSize(0);
+  gfx.println("Hello World!");
+  gfx.setTextSize(1);
+  gfx.setTextColor(ST77XX_GREEN);
+  gfx.print(p, 6);
+  gfx.println(" Want pi?");
+  gfx.println(" ");
+  gfx.print(8675309, HEX); // print 8,675,309 out in HEX!
+  gfx.println(" Print HEX!");
+  gfx.println(" ");
+  gfx.setTextColor(ST77XX_WHITE);
+  gfx.println("Sketch has been");
+  gfx.println("running for: ");
+  gfx.setTextColor(ST77XX_MAGENTA);
+  gfx.print(millis() / 1000);
+  gfx.setTextColor(ST77XX_WHITE);
+  gfx.print(" seconds.");
 }
 
-void mediabuttons() {
+void mediabuttons(Adafruit_GFX & gfx) {
   // play
-  tft->fillScreen(ST77XX_BLACK);
-  tft->fillRoundRect(25, 10, 78, 60, 8, ST77XX_WHITE);
-  tft->fillTriangle(42, 20, 42, 60, 90, 40, ST77XX_RED);
-  delay(500);
+  gfx.fillScreen(ST77XX_BLACK);
+  gfx.fillRoundRect(25, 10, 78, 60, 8, ST77XX_WHITE);
+  gfx.fillTriangle(42, 20, 42, 60, 90, 40, ST77XX_RED);
   // pause
-  tft->fillRoundRect(25, 90, 78, 60, 8, ST77XX_WHITE);
-  tft->fillRoundRect(39, 98, 20, 45, 5, ST77XX_GREEN);
-  tft->fillRoundRect(69, 98, 20, 45, 5, ST77XX_GREEN);
-  delay(500);
+  gfx.fillRoundRect(25, 90, 78, 60, 8, ST77XX_WHITE);
+  gfx.fillRoundRect(39, 98, 20, 45, 5, ST77XX_GREEN);
+  gfx.fillRoundRect(69, 98, 20, 45, 5, ST77XX_GREEN);
   // play color
-  tft->fillTriangle(42, 20, 42, 60, 90, 40, ST77XX_BLUE);
-  delay(50);
+  gfx.fillTriangle(42, 20, 42, 60, 90, 40, ST77XX_BLUE);
   // pause color
-  tft->fillRoundRect(39, 98, 20, 45, 5, ST77XX_RED);
-  tft->fillRoundRect(69, 98, 20, 45, 5, ST77XX_RED);
+  gfx.fillRoundRect(39, 98, 20, 45, 5, ST77XX_RED);
+  gfx.fillRoundRect(69, 98, 20, 45, 5, ST77XX_RED);
   // play color
-  tft->fillTriangle(42, 20, 42, 60, 90, 40, ST77XX_GREEN);
+  gfx.fillTriangle(42, 20, 42, 60, 90, 40, ST77XX_GREEN);
 }
+
+namespace
+{
+  const char lorem[] = "Lorem ipsum dolor sit amet, consectetur adipiscing elit. Curabitur adipiscing ante sed nibh tincidunt feugiat. Maecenas enim massa, fringilla sed malesuada et, malesuada sit amet turpis. Sed porttitor neque ut ante pretium vitae malesuada nunc bibendum. Nullam aliquet ultrices massa eu hendrerit. Ut sed nisi lorem. In vestibulum purus a tortor imperdiet posuere. ";
+
+  void text(Adafruit_GFX & gfx) { gfx.fillScreen(ST77XX_BLACK); testdrawtext(gfx, lorem, ST77XX_WHITE); }
+  void print(Adafruit_GFX & gfx) { tftPrintTest(gfx); }
+  void pixel(Adafruit_GFX & gfx) { gfx.drawPixel(gfx.width()/2, gfx.height()/2, ST77XX_GREEN); }
+  void lines(Adafruit_GFX & gfx) { testlines(gfx, ST77XX_YELLOW); }
+  void fastLines(Adafruit_GFX & gfx) { testfastlines(gfx, ST77XX_RED, ST77XX_BLUE); }
+  void drawRects(Adafruit_GFX & gfx) { testdrawrects(gfx, ST77XX_GREEN); }
+  void fillRects(Adafruit_GFX & gfx) { testfillrects(gfx, ST77XX_YELLOW, ST77XX_MAGENTA); }
+  void circles(Adafruit_GFX & gfx) { gfx.fillScreen(ST77XX_BLACK); testfillcircles(gfx, 10, ST77XX_BLUE); testdrawcircles(gfx, 10, ST77XX_WHITE); }
+  void roundRects(Adafruit_GFX & gfx) { testroundrects(gfx); }
+  void triangles(Adafruit_GFX & gfx) { testtriangles(gfx); }
+  void buttons(Adafruit_GFX & gfx) { mediabuttons(gfx); }
+}
+
+const TftDrawTest tftDrawTests[] = {
+  {"text", text},
+  {"print", print},
+  {"pixel", pixel},
+  {"lines", lines},
+  {"fastlines", fastLines},
+  {"drawrects", drawRects},
+  {"fillrects", fillRects},
+  {"circles", circles},
+  {"roundrects", roundRects},
+  {"triangles", triangles},
+  {"mediabuttons", buttons},
+};
+
+const size_t tftDrawTestCount = sizeof(tftDrawTests) / sizeof(tftDrawTests[0]);
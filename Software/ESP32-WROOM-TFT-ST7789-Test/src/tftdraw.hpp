@@ -0,0 +1,40 @@
+#pragma once
+
+/// The drawing routines from the Adafruit examples (tftdraw.cpp) - they take the Adafruit_GFX to draw to
+
+#include <Adafruit_GFX.h>
+
+// The ST77XX_ colours, so the routines do not need the panel driver (and build on the host)
+#ifndef ST77XX_BLACK
+#define ST77XX_BLACK 0x0000
+#define ST77XX_WHITE 0xFFFF
+#define ST77XX_RED 0xF800
+#define ST77XX_GREEN 0x07E0
+#define ST77XX_BLUE 0x001F
+#define ST77XX_CYAN 0x07FF
+#define ST77XX_MAGENTA 0xF81F
+#define ST77XX_YELLOW 0xFFE0
+#define ST77XX_ORANGE 0xFC00
+#endif
+
+void testlines(Adafruit_GFX & gfx, uint16_t color);
+void testdrawtext(Adafruit_GFX & gfx, const char *text, uint16_t color);
+void testfastlines(Adafruit_GFX & gfx, uint16_t color1, uint16_t color2);
+void testdrawrects(Adafruit_GFX & gfx, uint16_t color);
+void testfillrects(Adafruit_GFX & gfx, uint16_t color1, uint16_t color2);
+void testfillcircles(Adafruit_GFX & gfx, uint8_t radius, uint16_t color);
+void testdrawcircles(Adafruit_GFX & gfx, uint8_t radius, uint16_t color);
+void testtriangles(Adafruit_GFX & gfx);
+void testroundrects(Adafruit_GFX & gfx);
+void tftPrintTest(Adafruit_GFX & gfx);
+void mediabuttons(Adafruit_GFX & gfx);
+
+/// One step of the benchmark suite (benchmark.hpp) - each starts from whatever the previous one left on the screen
+struct TftDrawTest
+{
+  const char * name;
+  void (*run)(Adafruit_GFX & gfx);
+};
+
+extern const TftDrawTest tftDrawTests[];
+extern const size_t tftDrawTestCount;
@@ -0,0 +1,34 @@
+/// The tftdraw.cpp benchmark suite (src/benchmark.hpp) on the host, drawing into the PZEM project's FramebufferGFX -
+/// the pixel, byte and address window counts match the board's, the times are the CPU side of the drawing only.
+///
+///   GFX=~/.platformio/.../libdeps/nodemcu-32s/Adafruit\ GFX\ Library   (or any checkout of Adafruit GFX)
+///   PZEM=../ESP32-WROOM-PZEM
+///   g++ -O2 -std=gnu++11 -DARDUINO=100 -I $PZEM/tools/host -I $PZEM/src -I src -I "$GFX" tools/host_benchmark.cpp
+///       src/tftdraw.cpp $PZEM/src/framebuffer_gfx.cpp "$GFX/Adafruit_GFX.cpp" -o /tmp/host_benchmark
+///   /tmp/host_benchmark > host.csv
+
+#include <chrono>
+
+#include "benchmark.hpp"
+#include "framebuffer_gfx.hpp"
+
+namespace
+{
+  uint64_t nowMicros()
+  {
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+  }
+}
+
+int main()
+{
+  // The panel's visible 240x280 in portrait - rotations 1 and 3 are the 280x240 landscape the board uses
+  static FramebufferGFX gfx(240, 280);
+  FilePrint out(stdout);
+
+  BenchmarkHeader(out);
+  for(uint8_t rotation = 0; rotation < 4; ++rotation)
+    BenchmarkRun(gfx, out, "host", 0, rotation, nowMicros);
+  return 0;
+}
@@ -27,6 +27,8 @@
 #include <SPI.h>
 #include "epd2in9_V2.h"
 #include "epdpaint.h"
+#include "fonts_rotated.h"
+#include "pfonts.h"
 #include "imagedata.h"
 
 #define COLORED     0
@@ -57,6 +59,114 @@ unsigned long time_now_s;
 
 #define BOB
 
+/**
+ *  A data byte the way the driver sent it before the bulk transfers - DC,
+ *  then CS low around SpiTransfer, which toggles CS again itself. Kept here
+ *  only to time against.
+ */
+void OldSendData(unsigned char data) {
+  EpdIf::DigitalWrite(DC_PIN, HIGH);
+  EpdIf::DigitalWrite(CS_PIN, LOW);
+  EpdIf::SpiTransfer(data);
+  EpdIf::DigitalWrite(CS_PIN, HIGH);
+}
+
+void SetSpiClock(uint32_t hz) {
+  EpdIf::mySpi->endTransaction();
+  EpdIf::mySpi->beginTransaction(SPISettings(hz, MSBFIRST, SPI_MODE0));
+}
+
+/**
+ *  Frame upload time - a whole frame sent the old way (OldSendData at the
+ *  old 2 MHz clock) against the current driver at EPD_SPI_HZ: a byte at a
+ *  time through SendData, a row of a 128 pixel wide image at a time, and
+ *  the whole frame. Leaves the frame memory white.
+ */
+void TimeFrameUpload() {
+  const unsigned int frame_bytes = EPD_WIDTH / 8 * EPD_HEIGHT;
+  static const unsigned char white[16] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                                          0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+  epd->ClearFrameMemory(0xFF);    // sets the window and pointer - the writes below wrap around in it
+
+  SetSpiClock(2000000);
+  unsigned long start = micros();
+  epd->SendCommand(0x24);
+  for (unsigned int i = 0; i < frame_bytes; i++) {
+    OldSendData(0xFF);
+  }
+  unsigned long old_us = micros() - start;
+  SetSpiClock(EPD_SPI_HZ);
+
+  start = micros();
+  epd->SendCommand(0x24);
+  for (unsigned int i = 0; i < frame_bytes; i++) {
+    epd->SendData(0xFF);
+  }
+  unsigned long single_us = micros() - start;
+
+  start = micros();
+  epd->SendCommand(0x24);
+  for (unsigned int i = 0; i < frame_bytes; i += sizeof(white)) {
+    epd->SendData(white, sizeof(white));
+  }
+  unsigned long rows_us = micros() - start;
+
+  start = micros();
+  epd->SendCommand(0x24);
+  epd->SendRepeatedData(0xFF, frame_bytes);
+  unsigned long bulk_us = micros() - start;
+
+  Serial.printf("Frame upload (%u bytes): %lu us the old way (a byte at a time, extra CS toggle, SPI 2000000 Hz)\n",
+                frame_bytes, old_us);
+  Serial.printf("Frame upload (%u bytes, SPI %lu Hz): %lu us a byte at a time, %lu us 16 bytes at a time, %lu us in one go\n",
+                frame_bytes, (unsigned long)EPD_SPI_HZ, single_us, rows_us, bulk_us);
+}
+
+/**
+ *  Refresh cost - how long the CPU spends starting a refresh, how long the
+ *  panel takes, and how often a task waiting for it woke up (the old 5 ms
+ *  BUSY poll woke once per 5 ms)
+ */
+volatile unsigned long refresh_end_us;
+
+void IRAM_ATTR RefreshDone(void* arg) {
+  refresh_end_us = micros();
+}
+
+unsigned long refresh_start_us;
+unsigned long refresh_start_cost_us;
+unsigned long refresh_wakeups;
+
+/* a refresh started without waiting - report it once it has finished in the background */
+void ReportRefresh() {
+  if (refresh_start_us != 0 && !epd->IsBusy()) {
+    Serial.printf("Partial refresh: %lu us of CPU to start, %lu ms on the panel, %lu wakeups\n",
+                  refresh_start_cost_us, (refresh_end_us - refresh_start_us) / 1000,
+                  EpdIf::BusyWakeups() - refresh_wakeups);
+    refresh_start_us = 0;
+  }
+}
+
+void TimeRefresh(bool partial, bool wait) {
+  refresh_wakeups = EpdIf::BusyWakeups();
+  refresh_start_us = micros();
+  if (partial) {
+    epd->StartDisplayFrame_Partial();
+  } else {
+    epd->StartDisplayFrame();
+  }
+  refresh_start_cost_us = micros() - refresh_start_us;
+
+  if (wait) {
+    epd->WaitUntilIdle();
+    unsigned long refresh_ms = (micros() - refresh_start_us) / 1000;
+    Serial.printf("%s refresh: %lu us of CPU to start, %lu ms waiting, %lu wakeups (%lu for a 5 ms poll)\n",
+                  partial ? "Partial" : "Full", refresh_start_cost_us, refresh_ms,
+                  EpdIf::BusyWakeups() - refresh_wakeups, refresh_ms / 5);
+    refresh_start_us = 0;
+  }
+}
+
 void setup() {
   // put your setup code here, to run once:
   Serial.begin(115200);
@@ -71,6 +181,7 @@ void setup() {
 
   epd = new Epd();
   EpdIf::mySpi = hspi;
+  epd->OnRefreshDone(RefreshDone, NULL);
 
   if (epd->Init() != 0) {
       Serial.println("e-Paper init failed");
@@ -79,6 +190,7 @@ void setup() {
   else{
     Serial.println("epd Init ok");
   }
+  TimeFrameUpload();
   
   epd->ClearFrameMemory(0xFF);   // bit set = white, bit reset = black
 
@@ -99,7 +211,7 @@ void setup() {
   Serial.println("3");
   
   paint.Clear(UNCOLORED);
-  paint.DrawStringAt(0, 4, "e-Paper Demo", &Font12, COLORED);
+  paint.DrawStringAt(0, 4, "e-Paper Demo", &PFont16, COLORED);
   Serial.println("4");
   epd->SetFrameMemory(paint.GetImage(), 0, 30, paint.GetWidth(), paint.GetHeight());
   Serial.println("5");
@@ -146,7 +258,7 @@ Serial.println("8");
   Serial.println("8a");
   epd->SetFrameMemory_Base(IMAGE_DATA);
   Serial.println("8b");
-  epd->DisplayFrame();
+  TimeRefresh(false, true);
 
   Serial.println("10");
   time_start_ms = millis();
@@ -159,6 +271,7 @@ void loop() {
 
 Serial.println("loop");
 delay(1000);
+ReportRefresh();
 
 #ifdef BOB
   // put your main code here, to run repeatedly:
@@ -174,11 +287,10 @@ delay(1000);
   paint.SetRotate(ROTATE_90);
 
   paint.Clear(UNCOLORED);
-  paint.DrawStringAt(0, 4, time_string, &Font24, COLORED);
+  paint.DrawStringAt(0, 4, time_string, &Font24_Rotate90, COLORED);
   epd->SetFrameMemory_Partial(paint.GetImage(), 80, 72, paint.GetWidth(), paint.GetHeight());
-  epd->DisplayFrame_Partial();
-
-  // delay(300);
+  /* the panel refreshes while loop() sleeps in delay() */
+  TimeRefresh(true, false);
 
 #endif  
 }
@@ -43,7 +43,11 @@ public:
     int  Init();
     void SendCommand(unsigned char command);
     void SendData(unsigned char data);
+    void SendData(const unsigned char* data, unsigned int length);
+    void SendRepeatedData(unsigned char data, unsigned int count);
     void WaitUntilIdle(void);
+    bool IsBusy(void);
+    void OnRefreshDone(void (*callback)(void* arg), void* arg);
     void Reset(void);
     void SetFrameMemory(
         const unsigned char* image_buffer,
@@ -64,6 +68,8 @@ public:
     void ClearFrameMemory(unsigned char color);
     void DisplayFrame(void);
 	void DisplayFrame_Partial(void);
+    void StartDisplayFrame(void);
+    void StartDisplayFrame_Partial(void);
     void Sleep(void);
 
 private:
@@ -76,6 +82,8 @@ private:
     void SetLut_by_host(unsigned char *lut);
     void SetMemoryArea(int x_start, int y_start, int x_end, int y_end);
     void SetMemoryPointer(int x, int y);
+    void MasterActivation(void);
+    void SendImageData(const unsigned char* image_buffer, int image_width, int row_bytes, int rows);
 };
 
 #endif /* EPD2IN9_V2_H */
@@ -113,7 +113,6 @@ int Epd::Init() {
 	SendData(0x80);	
 
 	SetMemoryPointer(0, 0);
-	WaitUntilIdle();
 
     SetLut_by_host(WS_20_30);
     /* EPD hardware init end */
@@ -124,10 +123,12 @@ int Epd::Init() {
  *  @brief: basic function for sending commands
  */
 void Epd::SendCommand(unsigned char command) {
+    /* a refresh started with StartDisplayFrame has to finish first */
+    if (BusyPending()) {
+        WaitUntilIdle();
+    }
     DigitalWrite(dc_pin, LOW);
-    DigitalWrite(cs_pin, LOW);
     SpiTransfer(command);
-    DigitalWrite(cs_pin, HIGH);
 }
 
 /**
@@ -135,21 +136,56 @@ void Epd::SendCommand(unsigned char command) {
  */
 void Epd::SendData(unsigned char data) {
     DigitalWrite(dc_pin, HIGH);
-    DigitalWrite(cs_pin, LOW);
     SpiTransfer(data);
-    DigitalWrite(cs_pin, HIGH);
+}
+
+/**
+ *  @brief: send a run of data bytes - DC is set once and CS held low for
+ *          the whole run, so a frame goes out as a single transfer
+ */
+void Epd::SendData(const unsigned char* data, unsigned int length) {
+    DigitalWrite(dc_pin, HIGH);
+    SpiTransfer(data, length);
+}
+
+/**
+ *  @brief: send the same data byte "count" times, as one transfer
+ */
+void Epd::SendRepeatedData(unsigned char data, unsigned int count) {
+    DigitalWrite(dc_pin, HIGH);
+    SpiRepeat(data, count);
 }
 
 /**
  *  @brief: Wait until the busy_pin goes LOW
+ *          the task sleeps until the BUSY falling edge interrupt, so the
+ *          CPU is free (or idle) for the whole of a refresh
  */
 void Epd::WaitUntilIdle(void) {
-	while(1) {	 //=1 BUSY
-		if(DigitalRead(busy_pin)==LOW) 
-			break;
-		DelayMs(5);
+	while (BusyPending() || DigitalRead(busy_pin) == HIGH) {	 //=1 BUSY
+		if (!BusyWait(100) && DigitalRead(busy_pin) == LOW) {
+			/* BUSY never went high, so there is no edge to wait for */
+			BusyCancel();
+		}
 	}
-	DelayMs(5);
+}
+
+/**
+ *  @brief: true while the panel is working on a command (a refresh)
+ */
+bool Epd::IsBusy(void) {
+    return BusyPending() || DigitalRead(busy_pin) == HIGH;
+}
+
+/**
+ *  @brief: "callback" is called from the BUSY interrupt each time an
+ *          update started by Master Activation ends - a refresh started
+ *          with StartDisplayFrame / StartDisplayFrame_Partial, or the
+ *          clock start in SetFrameMemory_Partial. keep it short (give a
+ *          semaphore, set a flag) and in IRAM
+ */
+void Epd::OnRefreshDone(void (*callback)(void* arg), void* arg) {
+    SetBusyCallback(callback, arg);
 }
 
 /**
@@ -158,6 +194,9 @@ void Epd::WaitUntilIdle(void) {
  *          see Epd::Sleep();
  */
 void Epd::Reset(void) {
+    if (BusyPending()) {
+        WaitUntilIdle();
+    }
     DigitalWrite(reset_pin, HIGH);
     DelayMs(20);  
     DigitalWrite(reset_pin, LOW);                //module reset    
@@ -204,11 +243,7 @@ void Epd::SetFrameMemory(
     SetMemoryPointer(x, y);
     SendCommand(0x24);
     /* send the image data */
-    for (int j = 0; j < y_end - y + 1; j++) {
-        for (int i = 0; i < (x_end - x + 1) / 8; i++) {
-            SendData(image_buffer[i + j * (image_width / 8)]);
-        }
-    }
+    SendImageData(image_buffer, image_width, (x_end - x + 1) / 8, y_end - y + 1);
 }
 void Epd::SetFrameMemory_Partial(
     const unsigned char* image_buffer,
@@ -241,41 +276,32 @@ void Epd::SetFrameMemory_Partial(
         y_end = y + image_height - 1;
     }
 
+    if (BusyPending()) {
+        WaitUntilIdle();
+    }
     DigitalWrite(reset_pin, LOW);
     DelayMs(2);
     DigitalWrite(reset_pin, HIGH);
     DelayMs(2);
 	
 	SetLut(_WF_PARTIAL_2IN9);
+	static const unsigned char option[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00};
 	SendCommand(0x37); 
-	SendData(0x00);  
-	SendData(0x00);  
-	SendData(0x00);  
-	SendData(0x00); 
-	SendData(0x00);  	
-	SendData(0x40);  
-	SendData(0x00);  
-	SendData(0x00);   
-	SendData(0x00);  
-	SendData(0x00);
+	SendData(option, sizeof(option));
 
 	SendCommand(0x3C); //BorderWavefrom
 	SendData(0x80);	
 
 	SendCommand(0x22); 
 	SendData(0xC0);   
-	SendCommand(0x20); 
+	MasterActivation();
 	WaitUntilIdle();  
 	
     SetMemoryArea(x, y, x_end, y_end);
     SetMemoryPointer(x, y);
     SendCommand(0x24);
     /* send the image data */
-    for (int j = 0; j < y_end - y + 1; j++) {
-        for (int i = 0; i < (x_end - x + 1) / 8; i++) {
-            SendData(image_buffer[i + j * (image_width / 8)]);
-        }
-    }
+    SendImageData(image_buffer, image_width, (x_end - x + 1) / 8, y_end - y + 1);
 }
 
 /**
@@ -299,24 +325,18 @@ void Epd::SetFrameMemory(const unsigned char* image_buffer) {
     SetMemoryArea(0, 0, this->width - 1, this->height - 1);
     SetMemoryPointer(0, 0);
     SendCommand(0x24);
-    /* send the image data */
-    for (int i = 0; i < this->width / 8 * this->height; i++) {
-        SendData(pgm_read_byte(&image_buffer[i]));
-    }
+    /* send the image data - PROGMEM is addressable memory on the ESP32 */
+    SendData(image_buffer, this->width / 8 * this->height);
 }
 void Epd::SetFrameMemory_Base(const unsigned char* image_buffer) {
     SetMemoryArea(0, 0, this->width - 1, this->height - 1);
     SetMemoryPointer(0, 0);
     SendCommand(0x24);
-    /* send the image data */
-    for (int i = 0; i < this->width / 8 * this->height; i++) {
-        SendData(pgm_read_byte(&image_buffer[i]));
-    }
+    /* send the image data - PROGMEM is addressable memory on the ESP32 */
+    SendData(image_buffer, this->width / 8 * this->height);
     SendCommand(0x26);
     /* send the image data */
-    for (int i = 0; i < this->width / 8 * this->height; i++) {
-        SendData(pgm_read_byte(&image_buffer[i]));
-    }
+    SendData(image_buffer, this->width / 8 * this->height);
 }
 
 /**
@@ -328,9 +348,7 @@ void Epd::ClearFrameMemory(unsigned char color) {
     SetMemoryPointer(0, 0);
     SendCommand(0x24);
     /* send the color data */
-    for (int i = 0; i < this->width / 8 * this->height; i++) {
-        SendData(color);
-    }
+    SendRepeatedData(color, this->width / 8 * this->height);
 }
 
 /**
@@ -341,25 +359,49 @@ void Epd::ClearFrameMemory(unsigned char color) {
  *          set the other memory area.
  */
 void Epd::DisplayFrame(void) {
-    SendCommand(0x22);
-    SendData(0xc7);
-    SendCommand(0x20);
+    StartDisplayFrame();
     WaitUntilIdle();
 }
 
 void Epd::DisplayFrame_Partial(void) {
+    StartDisplayFrame_Partial();
+    WaitUntilIdle();
+}
+
+/**
+ *  @brief: start updating the display and return straight away - the
+ *          refresh takes about 2 s (full) or 0.3 s (partial). see
+ *          IsBusy / WaitUntilIdle / OnRefreshDone for when it is over;
+ *          anything else sent to the panel waits for it.
+ */
+void Epd::StartDisplayFrame(void) {
+    SendCommand(0x22);
+    SendData(0xc7);
+    MasterActivation();
+}
+
+void Epd::StartDisplayFrame_Partial(void) {
     SendCommand(0x22);
     SendData(0x0F);
-    SendCommand(0x20);
-    WaitUntilIdle();
+    MasterActivation();
+}
+
+/**
+ *  @brief: private function to send Master Activation, which starts what
+ *          0x22 has set up - BUSY is high until it is done
+ */
+void Epd::MasterActivation(void) {
+    if (BusyPending()) {
+        WaitUntilIdle();
+    }
+    DigitalWrite(dc_pin, LOW);
+    BusyStart();
+    SpiTransfer(0x20);
 }
 
 void Epd::SetLut(unsigned char *lut) {       
-	unsigned char count;
 	SendCommand(0x32);
-	for(count=0; count<153; count++) 
-		SendData(lut[count]); 
-	WaitUntilIdle();
+	SendData(lut, 153);
 }
 
 void Epd::SetLut_by_host(unsigned char *lut) {
@@ -369,9 +411,7 @@ void Epd::SetLut_by_host(unsigned char *lut) {
 	SendCommand(0x03);	// gate voltage
 	SendData(*(lut+154));
 	SendCommand(0x04);	// source voltage
-	SendData(*(lut+155));	// VSH
-	SendData(*(lut+156));	// VSH2
-	SendData(*(lut+157));	// VSL
+	SendData(lut+155, 3);	// VSH, VSH2, VSL
 	SendCommand(0x2c);		// VCOM
 	SendData(*(lut+158));
 }
@@ -380,15 +420,37 @@ void Epd::SetLut_by_host(unsigned char *lut) {
  *  @brief: private function to specify the memory area for data R/W
  */
 void Epd::SetMemoryArea(int x_start, int y_start, int x_end, int y_end) {
-    SendCommand(0x44);
     /* x point must be the multiple of 8 or the last 3 bits will be ignored */
-    SendData((x_start >> 3) & 0xFF);
-    SendData((x_end >> 3) & 0xFF);
+    unsigned char x_range[] = {
+        (unsigned char)((x_start >> 3) & 0xFF),
+        (unsigned char)((x_end >> 3) & 0xFF),
+    };
+    unsigned char y_range[] = {
+        (unsigned char)(y_start & 0xFF),
+        (unsigned char)((y_start >> 8) & 0xFF),
+        (unsigned char)(y_end & 0xFF),
+        (unsigned char)((y_end >> 8) & 0xFF),
+    };
+    SendCommand(0x44);
+    SendData(x_range, sizeof(x_range));
     SendCommand(0x45);
-    SendData(y_start & 0xFF);
-    SendData((y_start >> 8) & 0xFF);
-    SendData(y_end & 0xFF);
-    SendData((y_end >> 8) & 0xFF);
+    SendData(y_range, sizeof(y_range));
+}
+
+/**
+ *  @brief: private function to send "rows" rows of "row_bytes" bytes from
+ *          an image "image_width" pixels wide - in one transfer when the
+ *          rows are the whole width of the image, otherwise one per row
+ */
+void Epd::SendImageData(const unsigned char* image_buffer, int image_width, int row_bytes, int rows) {
+    int stride = image_width / 8;
+    if (row_bytes == stride) {
+        SendData(image_buffer, row_bytes * rows);
+        return;
+    }
+    for (int j = 0; j < rows; j++) {
+        SendData(image_buffer + j * stride, row_bytes);
+    }
 }
 
 /**
@@ -401,7 +463,6 @@ void Epd::SetMemoryPointer(int x, int y) {
     SendCommand(0x4F);
     SendData(y & 0xFF);
     SendData((y >> 8) & 0xFF);
-    WaitUntilIdle();
 }
 
 /**
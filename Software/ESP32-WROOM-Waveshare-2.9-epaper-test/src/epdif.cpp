@@ -27,11 +27,35 @@
 
 #include "epdif.h"
 #include <SPI.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 
 EpdIf::EpdIf() {};
 
 SPIClass * EpdIf::mySpi;
 
+/* given on every BUSY falling edge */
+static SemaphoreHandle_t busy_semaphore = NULL;
+/* set by BusyStart until the next falling edge */
+static volatile bool busy_pending = false;
+static void (* volatile busy_callback)(void* arg) = NULL;
+static void * volatile busy_callback_arg = NULL;
+static unsigned long busy_wakeups = 0;
+
+static void IRAM_ATTR BusyFalling(void) {
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(busy_semaphore, &woken);
+    if (busy_pending) {
+        busy_pending = false;
+        if (busy_callback != NULL) {
+            busy_callback(busy_callback_arg);
+        }
+    }
+    if (woken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
 EpdIf::~EpdIf() {
 };
 
@@ -53,13 +77,89 @@ void EpdIf::SpiTransfer(unsigned char data) {
     digitalWrite(CS_PIN, HIGH);
 }
 
+/**
+ *  @brief: send a run of bytes with CS held low throughout - the SPI
+ *          driver keeps its FIFO full, so there is no gap between bytes
+ */
+void EpdIf::SpiTransfer(const unsigned char* data, unsigned int length) {
+    digitalWrite(CS_PIN, LOW);
+    mySpi->writeBytes(data, length);
+    digitalWrite(CS_PIN, HIGH);
+}
+
+/**
+ *  @brief: send the same byte "count" times with CS held low throughout
+ */
+void EpdIf::SpiRepeat(unsigned char data, unsigned int count) {
+    digitalWrite(CS_PIN, LOW);
+    mySpi->writePattern(&data, 1, count);
+    digitalWrite(CS_PIN, HIGH);
+}
+
+/**
+ *  @brief: call just before a command that raises BUSY - the next falling
+ *          edge then marks it done (and calls the busy callback), even if
+ *          BUSY has not gone high yet when someone looks
+ */
+void EpdIf::BusyStart(void) {
+    xSemaphoreTake(busy_semaphore, 0);
+    busy_pending = true;
+}
+
+/**
+ *  @brief: true from BusyStart until the falling edge that follows it
+ */
+bool EpdIf::BusyPending(void) {
+    return busy_pending;
+}
+
+/**
+ *  @brief: forget a BusyStart whose falling edge will not come
+ */
+void EpdIf::BusyCancel(void) {
+    busy_pending = false;
+}
+
+/**
+ *  @brief: sleep until the next BUSY falling edge - false on a timeout
+ */
+bool EpdIf::BusyWait(unsigned int timeout_ms) {
+    busy_wakeups++;
+    return xSemaphoreTake(busy_semaphore, pdMS_TO_TICKS(timeout_ms)) == pdTRUE;
+}
+
+/**
+ *  @brief: "callback" is called from the BUSY interrupt when the command
+ *          after a BusyStart has finished - keep it short (give a
+ *          semaphore, set a flag) and in IRAM
+ */
+void EpdIf::SetBusyCallback(void (*callback)(void* arg), void* arg) {
+    busy_callback = NULL;
+    busy_callback_arg = arg;
+    busy_callback = callback;
+}
+
+/**
+ *  @brief: the number of times a task has slept in BusyWait
+ */
+unsigned long EpdIf::BusyWakeups(void) {
+    return busy_wakeups;
+}
+
 int EpdIf::IfInit(void) {
     pinMode(CS_PIN, OUTPUT);
     pinMode(RST_PIN, OUTPUT);
     pinMode(DC_PIN, OUTPUT);
     pinMode(BUSY_PIN, INPUT); 
+    if (busy_semaphore == NULL) {
+        busy_semaphore = xSemaphoreCreateBinary();
+        if (busy_semaphore == NULL) {
+            return -1;
+        }
+        attachInterrupt(digitalPinToInterrupt(BUSY_PIN), BusyFalling, FALLING);
+    }
     mySpi->begin();
-    mySpi->beginTransaction(SPISettings(2000000, MSBFIRST, SPI_MODE0));
+    mySpi->beginTransaction(SPISettings(EPD_SPI_HZ, MSBFIRST, SPI_MODE0));
     return 0;
 }
 
@@ -38,6 +38,11 @@
 #define CS_PIN          15
 #define BUSY_PIN        5
 
+// SPI clock - the panel's controller takes writes at up to 20 MHz
+#ifndef EPD_SPI_HZ
+#define EPD_SPI_HZ      20000000
+#endif
+
 
 ///// DIN = MOSO
 
@@ -51,6 +56,17 @@ public:
     static int  DigitalRead(int pin);
     static void DelayMs(unsigned int delaytime);
     static void SpiTransfer(unsigned char data);
+    static void SpiTransfer(const unsigned char* data, unsigned int length);
+    static void SpiRepeat(unsigned char data, unsigned int count);
+
+    /* BUSY falling edge interrupt - a task waiting for the panel sleeps until
+       it goes low instead of polling */
+    static void BusyStart(void);
+    static bool BusyPending(void);
+    static void BusyCancel(void);
+    static bool BusyWait(unsigned int timeout_ms);
+    static void SetBusyCallback(void (*callback)(void* arg), void* arg);
+    static unsigned long BusyWakeups(void);
 
     static SPIClass * mySpi;
 };
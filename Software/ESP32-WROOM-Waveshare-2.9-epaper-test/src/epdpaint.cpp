@@ -25,14 +25,25 @@
  */
 
 #include <pgmspace.h>
+#include <string.h>
 #include "epdpaint.h"
 
+/* runs "call" on the PaintRotated for the current rotation - one switch per primitive rather than per pixel */
+#define PAINT_ROTATED(call) \
+    switch (this->rotate) { \
+        case ROTATE_0: PaintRotated<ROTATE_0>(this->image, this->width, this->height).call; break; \
+        case ROTATE_90: PaintRotated<ROTATE_90>(this->image, this->width, this->height).call; break; \
+        case ROTATE_180: PaintRotated<ROTATE_180>(this->image, this->width, this->height).call; break; \
+        case ROTATE_270: PaintRotated<ROTATE_270>(this->image, this->width, this->height).call; break; \
+    }
+
 Paint::Paint(unsigned char* image, int width, int height) {
     this->rotate = ROTATE_0;
     this->image = image;
     /* 1 byte = 8 pixels, so the width should be the multiple of 8 */
     this->width = width % 8 ? width + 8 - (width % 8) : width;
     this->height = height;
+    UpdatePixelMap();
 }
 
 Paint::~Paint() {
@@ -42,33 +53,218 @@ Paint::~Paint() {
  *  @brief: clear the image
  */
 void Paint::Clear(int colored) {
-    for (int x = 0; x < this->width; x++) {
-        for (int y = 0; y < this->height; y++) {
-            DrawAbsolutePixel(x, y, colored);
+    memset(this->image, FillByte(colored), this->width / 8 * this->height);
+}
+
+/**
+ *  @brief: the byte value of 8 pixels of one colour
+ */
+unsigned char Paint::FillByte(int colored) {
+    return (colored ? 1 : 0) ^ (IF_INVERT_COLOR ? 0 : 1) ? 0xFF : 0x00;
+}
+
+/**
+ *  @brief: this fills x0 <= x < x1, y0 <= y < y1 by absolute coordinates.
+ *          whole bytes of a row are set with memset (which stores
+ *          32-bit words where it can), the partial bytes at either end
+ *          are merged with a mask.
+ */
+void Paint::FillAbsoluteRect(int x0, int y0, int x1, int y1, int colored) {
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > this->width) x1 = this->width;
+    if (y1 > this->height) y1 = this->height;
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    unsigned char fill = FillByte(colored);
+    int first = x0 / 8;
+    int last = (x1 - 1) / 8;
+    unsigned char first_mask = 0xFF >> (x0 % 8);
+    unsigned char last_mask = 0xFF << (7 - (x1 - 1) % 8);
+    int stride = this->width / 8;
+
+    if (first == last) {
+        first_mask &= last_mask;
+    }
+
+    unsigned char* row = this->image + y0 * stride;
+    for (int y = y0; y < y1; y++, row += stride) {
+        row[first] = (row[first] & ~first_mask) | (fill & first_mask);
+        if (first != last) {
+            memset(row + first + 1, fill, last - first - 1);
+            row[last] = (row[last] & ~last_mask) | (fill & last_mask);
         }
     }
 }
 
 /**
- *  @brief: this draws a pixel by absolute coordinates.
- *          this function won't be affected by the rotate parameter.
+ *  @brief: this clips x0 <= x < x1, y0 <= y < y1 (rotated coordinates) to
+ *          the area DrawPixel draws in - false if nothing is left.
  */
-void Paint::DrawAbsolutePixel(int x, int y, int colored) {
-    if (x < 0 || x >= this->width || y < 0 || y >= this->height) {
-        return;
+bool Paint::ClipRect(int& x0, int& y0, int& x1, int& y1) {
+    int rotated_width = (this->rotate == ROTATE_90 || this->rotate == ROTATE_270) ? this->height : this->width;
+    int rotated_height = (this->rotate == ROTATE_90 || this->rotate == ROTATE_270) ? this->width : this->height;
+
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > rotated_width) x1 = rotated_width;
+    if (y1 > rotated_height) y1 = rotated_height;
+    return x0 < x1 && y0 < y1;
+}
+
+/**
+ *  @brief: this turns x0 <= x < x1, y0 <= y < y1 (rotated coordinates) into
+ *          the rectangle of the image its pixels go to - the same mapping
+ *          as DrawPixel, applied to the corners.
+ */
+void Paint::MapRect(int& x0, int& y0, int& x1, int& y1) {
+    int rx0 = x0, ry0 = y0, rx1 = x1, ry1 = y1;
+
+    if (this->rotate == ROTATE_90) {
+        x0 = this->width - (ry1 - 1);
+        x1 = this->width - ry0 + 1;
+        y0 = rx0;
+        y1 = rx1;
+    } else if (this->rotate == ROTATE_180) {
+        x0 = this->width - (rx1 - 1);
+        x1 = this->width - rx0 + 1;
+        y0 = this->height - (ry1 - 1);
+        y1 = this->height - ry0 + 1;
+    } else if (this->rotate == ROTATE_270) {
+        x0 = ry0;
+        x1 = ry1;
+        y0 = this->height - (rx1 - 1);
+        y1 = this->height - rx0 + 1;
     }
-    if (IF_INVERT_COLOR) {
-        if (colored) {
-            image[(x + y * this->width) / 8] |= 0x80 >> (x % 8);
-        } else {
-            image[(x + y * this->width) / 8] &= ~(0x80 >> (x % 8));
+}
+
+/**
+ *  @brief: this fills a rectangle given by the (rotated) coordinates.
+ *          the rectangle is clipped like DrawPixel would clip its pixels,
+ *          then turned into the one rectangle it covers in the image.
+ */
+void Paint::FillRect(int x, int y, int fill_width, int fill_height, int colored) {
+    int x1 = x + fill_width;
+    int y1 = y + fill_height;
+
+    if (ClipRect(x, y, x1, y1)) {
+        MapRect(x, y, x1, y1);
+        FillAbsoluteRect(x, y, x1, y1, colored);
+    }
+}
+
+namespace {
+
+/* 8 source bits starting at bit "bit" of the row (bits outside the row read as 0) */
+inline unsigned char SourceByte(const unsigned char* row, int row_bytes, int bit) {
+    int index = bit >> 3;
+    int shift = bit & 7;
+    unsigned int high = index >= 0 && index < row_bytes ? pgm_read_byte(row + index) : 0;
+    unsigned int low = index + 1 >= 0 && index + 1 < row_bytes ? pgm_read_byte(row + index + 1) : 0;
+    return (unsigned char)((((high << 8) | low) << shift) >> 8);
+}
+
+template<int Rop>
+inline unsigned char Combine(unsigned char image, unsigned char source) {
+    switch (Rop) {
+        case BLT_OR: return image | source;
+        case BLT_AND: return image & source;
+        case BLT_XOR: return image ^ source;
+        case BLT_NOT: return ~source;
+        case BLT_ERASE: return image & ~source;
+        default: return source;
+    }
+}
+
+/* one instance per raster operation, so the inner loop has no switch. only
+   the edge bytes of a row can straddle the ends of the source row, so only
+   they check their reads - the bytes in between are a plain shift and merge
+   (or a copy, when the source and the image line up) */
+template<int Rop>
+void BlitRows(unsigned char* image, int stride, int x, int y, const unsigned char* source, int source_stride,
+              int source_x, int source_y, int blt_width, int blt_height) {
+    int first = x / 8;
+    int last = (x + blt_width - 1) / 8;
+    unsigned char first_mask = 0xFF >> (x % 8);
+    unsigned char last_mask = 0xFF << (7 - (x + blt_width - 1) % 8);
+    /* the source bit that lands on the first bit of image byte "first" */
+    int source_bit = source_x - x % 8;
+    int shift = source_bit & 7;
+
+    if (first == last) {
+        first_mask &= last_mask;
+    }
+
+    for (int j = 0; j < blt_height; j++) {
+        unsigned char* row = image + (y + j) * stride;
+        const unsigned char* source_row = source + (source_y + j) * source_stride;
+
+        unsigned char value = Combine<Rop>(row[first], SourceByte(source_row, source_stride, source_bit));
+        row[first] = (row[first] & ~first_mask) | (value & first_mask);
+        if (first == last) {
+            continue;
         }
-    } else {
-        if (colored) {
-            image[(x + y * this->width) / 8] &= ~(0x80 >> (x % 8));
+
+        const unsigned char* in = source_row + ((source_bit + 8) >> 3);
+        if (shift == 0) {
+            for (int i = first + 1; i < last; i++, in++) {
+                row[i] = Combine<Rop>(row[i], pgm_read_byte(in));
+            }
         } else {
-            image[(x + y * this->width) / 8] |= 0x80 >> (x % 8);
+            for (int i = first + 1; i < last; i++, in++) {
+                unsigned char bits = (pgm_read_byte(in) << shift) | (pgm_read_byte(in + 1) >> (8 - shift));
+                row[i] = Combine<Rop>(row[i], bits);
+            }
         }
+
+        value = Combine<Rop>(row[last], SourceByte(source_row, source_stride, source_bit + 8 * (last - first)));
+        row[last] = (row[last] & ~last_mask) | (value & last_mask);
+    }
+}
+
+}
+
+/**
+ *  @brief: this copies a blt_width x blt_height rectangle from a 1 bit per
+ *          pixel bitmap into the image at absolute coordinates (x, y),
+ *          combining each bit with the raster operation "rop" (BLT_COPY...).
+ *          the source rows are source_width pixels, padded to whole bytes
+ *          like the image and IMAGE_DATA (it may be in flash), and
+ *          (source_x, source_y) is the corner to copy from. neither side
+ *          needs to be byte aligned: each image byte is made from the two
+ *          source bytes it straddles with one shift. the bits are copied as
+ *          they are - this is not affected by the rotation or IF_INVERT_COLOR.
+ *          the part that falls off the image is clipped.
+ */
+void Paint::BitBlt(int x, int y, const unsigned char* source, int source_width,
+                   int source_x, int source_y, int blt_width, int blt_height, int rop) {
+    if (x < 0) {
+        source_x -= x;
+        blt_width += x;
+        x = 0;
+    }
+    if (y < 0) {
+        source_y -= y;
+        blt_height += y;
+        y = 0;
+    }
+    if (x + blt_width > this->width) blt_width = this->width - x;
+    if (y + blt_height > this->height) blt_height = this->height - y;
+    if (source == NULL || blt_width <= 0 || blt_height <= 0) {
+        return;
+    }
+
+    int stride = this->width / 8;
+    int source_stride = (source_width + 7) / 8;
+    switch (rop) {
+        case BLT_COPY: BlitRows<BLT_COPY>(this->image, stride, x, y, source, source_stride, source_x, source_y, blt_width, blt_height); break;
+        case BLT_OR: BlitRows<BLT_OR>(this->image, stride, x, y, source, source_stride, source_x, source_y, blt_width, blt_height); break;
+        case BLT_AND: BlitRows<BLT_AND>(this->image, stride, x, y, source, source_stride, source_x, source_y, blt_width, blt_height); break;
+        case BLT_XOR: BlitRows<BLT_XOR>(this->image, stride, x, y, source, source_stride, source_x, source_y, blt_width, blt_height); break;
+        case BLT_NOT: BlitRows<BLT_NOT>(this->image, stride, x, y, source, source_stride, source_x, source_y, blt_width, blt_height); break;
+        case BLT_ERASE: BlitRows<BLT_ERASE>(this->image, stride, x, y, source, source_stride, source_x, source_y, blt_width, blt_height); break;
     }
 }
 
@@ -85,6 +281,7 @@ int Paint::GetWidth(void) {
 
 void Paint::SetWidth(int width) {
     this->width = width % 8 ? width + 8 - (width % 8) : width;
+    UpdatePixelMap();
 }
 
 int Paint::GetHeight(void) {
@@ -93,6 +290,7 @@ int Paint::GetHeight(void) {
 
 void Paint::SetHeight(int height) {
     this->height = height;
+    UpdatePixelMap();
 }
 
 int Paint::GetRotate(void) {
@@ -101,41 +299,54 @@ int Paint::GetRotate(void) {
 
 void Paint::SetRotate(int rotate){
     this->rotate = rotate;
+    UpdatePixelMap();
 }
 
 /**
- *  @brief: this draws a pixel by the coordinates
+ *  @brief: this works out DrawPixel's mapping for the rotation and size, so
+ *          drawing a pixel is one bounds check and one read-modify-write
+ *          with no dispatch on the rotation. it is the same mapping as
+ *          PaintRotated::DrawPixel - ROTATE_90 and ROTATE_180 put x = 0 at
+ *          image column "width" and ROTATE_180 and ROTATE_270 put y = 0 at
+ *          image row "height", both just off the image, so those pixels
+ *          are never drawn.
  */
-void Paint::DrawPixel(int x, int y, int colored) {
-    int point_temp;
-    if (this->rotate == ROTATE_0) {
-        if(x < 0 || x >= this->width || y < 0 || y >= this->height) {
-            return;
-        }
-        DrawAbsolutePixel(x, y, colored);
-    } else if (this->rotate == ROTATE_90) {
-        if(x < 0 || x >= this->height || y < 0 || y >= this->width) {
-          return;
-        }
-        point_temp = x;
-        x = this->width - y;
-        y = point_temp;
-        DrawAbsolutePixel(x, y, colored);
+void Paint::UpdatePixelMap(void) {
+    int w = this->width;
+    int h = this->height;
+    this->pixel_x_min = 0;
+    this->pixel_y_min = 0;
+    if (this->rotate == ROTATE_90) {
+        /* image (width - y, x) */
+        this->pixel_base = w;
+        this->pixel_dx = w;
+        this->pixel_dy = -1;
+        this->pixel_x_end = h;
+        this->pixel_y_min = 1;
+        this->pixel_y_end = w;
     } else if (this->rotate == ROTATE_180) {
-        if(x < 0 || x >= this->width || y < 0 || y >= this->height) {
-          return;
-        }
-        x = this->width - x;
-        y = this->height - y;
-        DrawAbsolutePixel(x, y, colored);
+        /* image (width - x, height - y) */
+        this->pixel_base = h * w + w;
+        this->pixel_dx = -1;
+        this->pixel_dy = -w;
+        this->pixel_x_min = 1;
+        this->pixel_x_end = w;
+        this->pixel_y_min = 1;
+        this->pixel_y_end = h;
     } else if (this->rotate == ROTATE_270) {
-        if(x < 0 || x >= this->height || y < 0 || y >= this->width) {
-          return;
-        }
-        point_temp = x;
-        x = y;
-        y = this->height - point_temp;
-        DrawAbsolutePixel(x, y, colored);
+        /* image (y, height - x) */
+        this->pixel_base = h * w;
+        this->pixel_dx = -w;
+        this->pixel_dy = 1;
+        this->pixel_x_min = 1;
+        this->pixel_x_end = h;
+        this->pixel_y_end = w;
+    } else {
+        this->pixel_base = 0;
+        this->pixel_dx = 1;
+        this->pixel_dy = w;
+        this->pixel_x_end = w;
+        this->pixel_y_end = h;
     }
 }
 
@@ -143,87 +354,172 @@ void Paint::DrawPixel(int x, int y, int colored) {
  *  @brief: this draws a charactor on the frame buffer but not refresh
  */
 void Paint::DrawCharAt(int x, int y, char ascii_char, sFONT* font, int colored) {
-    int i, j;
-    unsigned int char_offset = (ascii_char - ' ') * font->Height * (font->Width / 8 + (font->Width % 8 ? 1 : 0));
-    const unsigned char* ptr = &font->table[char_offset];
-
-    for (j = 0; j < font->Height; j++) {
-        for (i = 0; i < font->Width; i++) {
-            if (pgm_read_byte(ptr) & (0x80 >> (i % 8))) {
-                DrawPixel(x + i, y + j, colored);
+    if (font->Rotate == this->rotate) {
+        BlitCharAt(x, y, ascii_char, font, colored);
+        return;
+    }
+    /* a pre-rotated font at another rotation - draw from the plain table */
+    if (font->Unrotated != NULL) {
+        font = (sFONT*)font->Unrotated;
+    }
+    PAINT_ROTATED(DrawCharAt(x, y, ascii_char, font, colored));
+}
+
+/**
+ *  @brief: this draws a charactor from a font laid out for the current
+ *          rotation (any font at ROTATE_0, a pre-rotated one from
+ *          fonts_rotated.h otherwise) - each glyph is one BitBlt of the rows
+ *          it has in the image instead of a DrawPixel per set bit.
+ */
+void Paint::BlitCharAt(int x, int y, char ascii_char, const sFONT* font, int colored) {
+    /* where the whole glyph would go, and the part of it that is drawn */
+    int glyph_x0 = x, glyph_y0 = y, glyph_x1 = x + font->Width, glyph_y1 = y + font->Height;
+    int x0 = glyph_x0, y0 = glyph_y0, x1 = glyph_x1, y1 = glyph_y1;
+    if (!ClipRect(x0, y0, x1, y1)) {
+        return;
+    }
+    MapRect(glyph_x0, glyph_y0, glyph_x1, glyph_y1);
+    MapRect(x0, y0, x1, y1);
+
+    /* the glyphs are stored as they are in the image, rows padded to bytes */
+    int glyph_width = glyph_x1 - glyph_x0;
+    int glyph_bytes = (glyph_width + 7) / 8 * (glyph_y1 - glyph_y0);
+    const unsigned char* glyph = &font->table[(ascii_char - ' ') * glyph_bytes];
+    int rop = (colored != 0) == (IF_INVERT_COLOR != 0) ? BLT_OR : BLT_ERASE;
+
+    BitBlt(x0, y0, glyph, glyph_width, x0 - glyph_x0, y0 - glyph_y0, x1 - x0, y1 - y0, rop);
+}
+
+/**
+*  @brief: this displays a string on the frame buffer but not refresh
+*/
+void Paint::DrawStringAt(int x, int y, const char* text, sFONT* font, int colored) {
+    for (; *text != 0; text++, x += font->Width) {
+        DrawCharAt(x, y, *text, font, colored);
+    }
+}
+
+/**
+ *  @brief: this draws a charactor of a proportional font with its top left
+ *          at (x, y) - returns how far to move on to the next one (0 if the
+ *          font does not have it). the set bits are drawn as horizontal
+ *          spans (FillRect), straight from the packed or run length
+ *          encoded bitmap - or at ROTATE_0, a packed bitmap is padded out
+ *          to whole bytes a row and blitted.
+ */
+int Paint::DrawCharAt(int x, int y, char ascii_char, const sPFONT* font, int colored) {
+    unsigned char c = ascii_char;
+    if (c < font->First || c > font->Last) {
+        return 0;
+    }
+
+    const sPGLYPH* glyph = &font->glyphs[c - font->First];
+    const unsigned char* bitmap = font->bitmaps + pgm_read_word(&glyph->Offset);
+    unsigned char width = pgm_read_byte(&glyph->Width);
+    bool rle = width & PGLYPH_RLE;
+    width &= ~PGLYPH_RLE;
+
+    int bits = width * font->Height;
+    int stride = (width + 7) / 8;
+    unsigned char rows[256];
+    if (!rle && rotate == ROTATE_0 && stride * font->Height <= (int)sizeof(rows)) {
+        /* pad the rows out to whole bytes and blit the glyph in one go */
+        int bytes = (bits + 7) / 8;
+        for (int row = 0; row < font->Height; row++) {
+            for (int i = 0; i < stride; i++) {
+                int position = row * width + i * 8;
+                int index = position >> 3;
+                unsigned int pair = pgm_read_byte(bitmap + index) << 8;
+                if (index + 1 < bytes) {
+                    pair |= pgm_read_byte(bitmap + index + 1);
+                }
+                rows[row * stride + i] = pair >> (8 - (position & 7));
             }
-            if (i % 8 == 7) {
-                ptr++;
+        }
+        int rop = (colored != 0) == (IF_INVERT_COLOR != 0) ? BLT_OR : BLT_ERASE;
+        BitBlt(x, y, rows, width, 0, 0, width, font->Height, rop);
+        return pgm_read_byte(&glyph->Advance);
+    }
+
+    int position = 0;
+    while (position < bits) {
+        /* the next run of equal bits */
+        int value;
+        int length;
+        if (rle) {
+            unsigned char run = pgm_read_byte(bitmap++);
+            value = run >> 7;
+            length = (run & 0x7F) + 1;
+        } else {
+            value = (pgm_read_byte(bitmap + (position >> 3)) >> (7 - (position & 7))) & 1;
+            length = 1;
+            while (position + length < bits &&
+                   ((pgm_read_byte(bitmap + ((position + length) >> 3)) >> (7 - ((position + length) & 7))) & 1) == value) {
+                length++;
             }
         }
-        if (font->Width % 8 != 0) {
-            ptr++;
+        if (length > bits - position) {
+            length = bits - position;
         }
+
+        /* set bits become one span per glyph row they cover */
+        while (value && length > 0) {
+            int row = position / width;
+            int column = position % width;
+            int span = width - column < length ? width - column : length;
+            FillRect(x + column, y + row, span, 1, colored);
+            position += span;
+            length -= span;
+        }
+        position += length;
     }
+    return pgm_read_byte(&glyph->Advance);
 }
 
 /**
-*  @brief: this displays a string on the frame buffer but not refresh
-*/
-void Paint::DrawStringAt(int x, int y, const char* text, sFONT* font, int colored) {
-    const char* p_text = text;
-    unsigned int counter = 0;
-    int refcolumn = x;
-    
-    /* Send the string character by character on EPD */
-    while (*p_text != 0) {
-        /* Display one character on EPD */
-        DrawCharAt(refcolumn, y, *p_text, font, colored);
-        /* Decrement the column position by 16 */
-        refcolumn += font->Width;
-        /* Point on the next character */
-        p_text++;
-        counter++;
+ *  @brief: this draws a string in a proportional font - returns its width
+ */
+int Paint::DrawStringAt(int x, int y, const char* text, const sPFONT* font, int colored) {
+    int start = x;
+    for (; *text != 0; text++) {
+        x += DrawCharAt(x, y, *text, font, colored);
+    }
+    return x - start;
+}
+
+/**
+ *  @brief: the width DrawStringAt would draw a string in a proportional font
+ */
+int Paint::StringWidth(const char* text, const sPFONT* font) {
+    int width = 0;
+    for (; *text != 0; text++) {
+        unsigned char c = *text;
+        if (c >= font->First && c <= font->Last) {
+            width += pgm_read_byte(&font->glyphs[c - font->First].Advance);
+        }
     }
+    return width;
 }
 
 /**
 *  @brief: this draws a line on the frame buffer
 */
 void Paint::DrawLine(int x0, int y0, int x1, int y1, int colored) {
-    /* Bresenham algorithm */
-    int dx = x1 - x0 >= 0 ? x1 - x0 : x0 - x1;
-    int sx = x0 < x1 ? 1 : -1;
-    int dy = y1 - y0 <= 0 ? y1 - y0 : y0 - y1;
-    int sy = y0 < y1 ? 1 : -1;
-    int err = dx + dy;
-
-    while((x0 != x1) && (y0 != y1)) {
-        DrawPixel(x0, y0 , colored);
-        if (2 * err >= dy) {     
-            err += dy;
-            x0 += sx;
-        }
-        if (2 * err <= dx) {
-            err += dx; 
-            y0 += sy;
-        }
-    }
+    PAINT_ROTATED(DrawLine(x0, y0, x1, y1, colored));
 }
 
 /**
 *  @brief: this draws a horizontal line on the frame buffer
 */
 void Paint::DrawHorizontalLine(int x, int y, int line_width, int colored) {
-    int i;
-    for (i = x; i < x + line_width; i++) {
-        DrawPixel(i, y, colored);
-    }
+    FillRect(x, y, line_width, 1, colored);
 }
 
 /**
 *  @brief: this draws a vertical line on the frame buffer
 */
 void Paint::DrawVerticalLine(int x, int y, int line_height, int colored) {
-    int i;
-    for (i = y; i < y + line_height; i++) {
-        DrawPixel(x, i, colored);
-    }
+    FillRect(x, y, 1, line_height, colored);
 }
 
 /**
@@ -247,43 +543,19 @@ void Paint::DrawRectangle(int x0, int y0, int x1, int y1, int colored) {
 */
 void Paint::DrawFilledRectangle(int x0, int y0, int x1, int y1, int colored) {
     int min_x, min_y, max_x, max_y;
-    int i;
     min_x = x1 > x0 ? x0 : x1;
     max_x = x1 > x0 ? x1 : x0;
     min_y = y1 > y0 ? y0 : y1;
     max_y = y1 > y0 ? y1 : y0;
     
-    for (i = min_x; i <= max_x; i++) {
-      DrawVerticalLine(i, min_y, max_y - min_y + 1, colored);
-    }
+    FillRect(min_x, min_y, max_x - min_x + 1, max_y - min_y + 1, colored);
 }
 
 /**
 *  @brief: this draws a circle
 */
 void Paint::DrawCircle(int x, int y, int radius, int colored) {
-    /* Bresenham algorithm */
-    int x_pos = -radius;
-    int y_pos = 0;
-    int err = 2 - 2 * radius;
-    int e2;
-
-    do {
-        DrawPixel(x - x_pos, y + y_pos, colored);
-        DrawPixel(x + x_pos, y + y_pos, colored);
-        DrawPixel(x + x_pos, y - y_pos, colored);
-        DrawPixel(x - x_pos, y - y_pos, colored);
-        e2 = err;
-        if (e2 <= y_pos) {
-            err += ++y_pos * 2 + 1;
-            if(-x_pos == y_pos && e2 <= x_pos) {
-              e2 = 0;
-            }
-        }
-        if (e2 > x_pos) {
-            err += ++x_pos * 2 + 1;
-        }
-    } while (x_pos <= 0);
+    PAINT_ROTATED(DrawCircle(x, y, radius, colored));
 }
 
 /**
@@ -297,10 +569,7 @@ void Paint::DrawFilledCircle(int x, int y, int radius, int colored) {
     int e2;
 
     do {
-        DrawPixel(x - x_pos, y + y_pos, colored);
-        DrawPixel(x + x_pos, y + y_pos, colored);
-        DrawPixel(x + x_pos, y - y_pos, colored);
-        DrawPixel(x - x_pos, y - y_pos, colored);
+        /* the lines include the pixels at either end */
         DrawHorizontalLine(x + x_pos, y + y_pos, 2 * (-x_pos) + 1, colored);
         DrawHorizontalLine(x + x_pos, y - y_pos, 2 * (-x_pos) + 1, colored);
         e2 = err;
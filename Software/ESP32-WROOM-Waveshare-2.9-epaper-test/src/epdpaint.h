@@ -36,8 +36,143 @@
 // Color inverse. 1 or 0 = set or reset a bit if set a colored pixel
 #define IF_INVERT_COLOR     1
 
+// Raster operations for Paint::BitBlt - how a source bit combines with the image bit
+#define BLT_COPY            0   // image = source
+#define BLT_OR              1   // image = image | source
+#define BLT_AND             2   // image = image & source
+#define BLT_XOR             3   // image = image ^ source
+#define BLT_NOT             4   // image = ~source
+#define BLT_ERASE           5   // image = image & ~source
+
+#include <pgmspace.h>
 #include "fonts.h"
 
+/**
+ *  @brief: the pixel path of Paint for one rotation and colour polarity,
+ *          fixed at compile time. DrawPixel is one bounds check and one
+ *          read-modify-write, with no branch on the rotation or the polarity.
+ *          Paint picks the instance once per call (not per pixel) and runs
+ *          the inner loops of its primitives on it.
+ */
+template<int Rotate, int InvertColor = IF_INVERT_COLOR>
+class PaintRotated {
+public:
+    PaintRotated(unsigned char* image, int width, int height)
+        : image(image), width(width), height(height), stride(width / 8) {
+    }
+
+    /* the size as seen through the rotation */
+    int GetWidth(void) const { return (Rotate == ROTATE_90 || Rotate == ROTATE_270) ? height : width; }
+    int GetHeight(void) const { return (Rotate == ROTATE_90 || Rotate == ROTATE_270) ? width : height; }
+
+    void DrawPixel(int x, int y, int colored) {
+        if ((unsigned)x >= (unsigned)GetWidth() || (unsigned)y >= (unsigned)GetHeight()) {
+            return;
+        }
+
+        /* the mapping Paint has always used - ROTATE_90 and ROTATE_180 put x = 0
+           at image column "width" and ROTATE_180 and ROTATE_270 put y = 0 at
+           image row "height", both just off the image */
+        int image_x = x;
+        int image_y = y;
+        if (Rotate == ROTATE_90) {
+            image_x = width - y;
+            image_y = x;
+        } else if (Rotate == ROTATE_180) {
+            image_x = width - x;
+            image_y = height - y;
+        } else if (Rotate == ROTATE_270) {
+            image_x = y;
+            image_y = height - x;
+        }
+        if ((Rotate == ROTATE_90 || Rotate == ROTATE_180) && image_x == width) {
+            return;
+        }
+        if ((Rotate == ROTATE_180 || Rotate == ROTATE_270) && image_y == height) {
+            return;
+        }
+
+        unsigned char* byte = image + image_y * stride + (image_x >> 3);
+        unsigned char bit = 0x80 >> (image_x & 7);
+        if ((colored != 0) == (InvertColor != 0)) {
+            *byte |= bit;
+        } else {
+            *byte &= ~bit;
+        }
+    }
+
+    void DrawCharAt(int x, int y, char ascii_char, const sFONT* font, int colored) {
+        int bytes_per_row = (font->Width + 7) / 8;
+        const unsigned char* ptr = &font->table[(ascii_char - ' ') * font->Height * bytes_per_row];
+
+        for (int j = 0; j < font->Height; j++, ptr += bytes_per_row) {
+            for (int i = 0; i < font->Width; i++) {
+                if (pgm_read_byte(ptr + i / 8) & (0x80 >> (i % 8))) {
+                    DrawPixel(x + i, y + j, colored);
+                }
+            }
+        }
+    }
+
+    void DrawStringAt(int x, int y, const char* text, const sFONT* font, int colored) {
+        for (; *text != 0; text++, x += font->Width) {
+            DrawCharAt(x, y, *text, font, colored);
+        }
+    }
+
+    void DrawLine(int x0, int y0, int x1, int y1, int colored) {
+        /* Bresenham algorithm */
+        int dx = x1 - x0 >= 0 ? x1 - x0 : x0 - x1;
+        int sx = x0 < x1 ? 1 : -1;
+        int dy = y1 - y0 <= 0 ? y1 - y0 : y0 - y1;
+        int sy = y0 < y1 ? 1 : -1;
+        int err = dx + dy;
+
+        while((x0 != x1) && (y0 != y1)) {
+            DrawPixel(x0, y0 , colored);
+            if (2 * err >= dy) {
+                err += dy;
+                x0 += sx;
+            }
+            if (2 * err <= dx) {
+                err += dx;
+                y0 += sy;
+            }
+        }
+    }
+
+    void DrawCircle(int x, int y, int radius, int colored) {
+        /* Bresenham algorithm */
+        int x_pos = -radius;
+        int y_pos = 0;
+        int err = 2 - 2 * radius;
+        int e2;
+
+        do {
+            DrawPixel(x - x_pos, y + y_pos, colored);
+            DrawPixel(x + x_pos, y + y_pos, colored);
+            DrawPixel(x + x_pos, y - y_pos, colored);
+            DrawPixel(x - x_pos, y - y_pos, colored);
+            e2 = err;
+            if (e2 <= y_pos) {
+                err += ++y_pos * 2 + 1;
+                if(-x_pos == y_pos && e2 <= x_pos) {
+                  e2 = 0;
+                }
+            }
+            if (e2 > x_pos) {
+                err += ++x_pos * 2 + 1;
+            }
+        } while (x_pos <= 0);
+    }
+
+private:
+    unsigned char* image;
+    int width;
+    int height;
+    int stride;
+};
+
 class Paint {
 public:
     Paint(unsigned char* image, int width, int height);
@@ -54,6 +189,9 @@ public:
     void DrawPixel(int x, int y, int colored);
     void DrawCharAt(int x, int y, char ascii_char, sFONT* font, int colored);
     void DrawStringAt(int x, int y, const char* text, sFONT* font, int colored);
+    int  DrawCharAt(int x, int y, char ascii_char, const sPFONT* font, int colored);
+    int  DrawStringAt(int x, int y, const char* text, const sPFONT* font, int colored);
+    static int StringWidth(const char* text, const sPFONT* font);
     void DrawLine(int x0, int y0, int x1, int y1, int colored);
     void DrawHorizontalLine(int x, int y, int width, int colored);
     void DrawVerticalLine(int x, int y, int height, int colored);
@@ -61,14 +199,57 @@ public:
     void DrawFilledRectangle(int x0, int y0, int x1, int y1, int colored);
     void DrawCircle(int x, int y, int radius, int colored);
     void DrawFilledCircle(int x, int y, int radius, int colored);
+    void FillRect(int x, int y, int fill_width, int fill_height, int colored);
+    void BitBlt(int x, int y, const unsigned char* source, int source_width,
+                int source_x, int source_y, int blt_width, int blt_height, int rop);
 
 private:
     unsigned char* image;
     int width;
     int height;
     int rotate;
+
+    /* DrawPixel's mapping for the current rotation, kept up to date by
+       UpdatePixelMap: the pixel (x, y) is drawn if pixel_x_min <= x <
+       pixel_x_end and pixel_y_min <= y < pixel_y_end, at image bit
+       pixel_base + x * pixel_dx + y * pixel_dy */
+    int pixel_base;
+    int pixel_dx;
+    int pixel_dy;
+    int pixel_x_min;
+    int pixel_x_end;
+    int pixel_y_min;
+    int pixel_y_end;
+
+    void UpdatePixelMap(void);
+    static unsigned char FillByte(int colored);
+    void FillAbsoluteRect(int x0, int y0, int x1, int y1, int colored);
+    bool ClipRect(int& x0, int& y0, int& x1, int& y1);
+    void MapRect(int& x0, int& y0, int& x1, int& y1);
+    void BlitCharAt(int x, int y, char ascii_char, const sFONT* font, int colored);
 };
 
+/**
+ *  @brief: this draws a pixel by the coordinates. inline, with the mapping
+ *          for the rotation worked out beforehand by SetRotate - see
+ *          UpdatePixelMap.
+ */
+inline void Paint::DrawPixel(int x, int y, int colored) {
+    if ((unsigned)(x - this->pixel_x_min) >= (unsigned)(this->pixel_x_end - this->pixel_x_min) ||
+        (unsigned)(y - this->pixel_y_min) >= (unsigned)(this->pixel_y_end - this->pixel_y_min)) {
+        return;
+    }
+
+    int bit = this->pixel_base + x * this->pixel_dx + y * this->pixel_dy;
+    unsigned char* byte = this->image + (bit >> 3);
+    unsigned char mask = 0x80 >> (bit & 7);
+    if ((colored != 0) == (IF_INVERT_COLOR != 0)) {
+        *byte |= mask;
+    } else {
+        *byte &= ~mask;
+    }
+}
+
 #endif
 
 /* END OF FILE */
@@ -51,6 +51,28 @@ struct sFONT {
   const uint8_t *table;
   uint16_t Width;
   uint16_t Height;
+  uint16_t Rotate;          /* Paint rotation the table is laid out for - see fonts_rotated.h */
+  const sFONT *Unrotated;   /* For a pre-rotated font, the same font laid out for ROTATE_0 */
+};
+
+/* Proportional font - see pfonts.h, made by tools/make_proportional_fonts.cpp.
+   Each glyph has its own width and advance, and its bitmap is Width x Height
+   bits with no padding at the end of a row, either as they are or run length
+   encoded (PGLYPH_RLE: one byte per run, bit 7 = the bit, bits 0-6 = length - 1) */
+#define PGLYPH_RLE 0x80
+
+struct sPGLYPH {
+  uint16_t Offset;          /* Of the bitmap in sPFONT::bitmaps */
+  uint8_t Width;            /* Of the bitmap - or'ed with PGLYPH_RLE if it is run length encoded */
+  uint8_t Advance;          /* Pen movement to the next glyph */
+};
+
+struct sPFONT {
+  const uint8_t *bitmaps;
+  const sPGLYPH *glyphs;    /* One per character, First to Last */
+  uint8_t First;
+  uint8_t Last;
+  uint16_t Height;
 };
 
 extern sFONT Font24;
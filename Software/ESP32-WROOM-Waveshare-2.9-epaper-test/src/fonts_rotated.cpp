@@ -0,0 +1,4825 @@
+/* Generated by tools/make_rotated_fonts.cpp - do not edit */
+
+#include <pgmspace.h>
+#include "epdpaint.h"
+#include "fonts_rotated.h"
+
+static const uint8_t Font8_Rotate90_Table[] PROGMEM = {
+  /* ' ' */
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '!' */
+  0x00, 0x00, 0x2F, 0x00, 0x00,
+  /* '"' */
+  0x00, 0x03, 0x00, 0x03, 0x00,
+  /* '#' */
+  0x54, 0x3E, 0x55, 0x3E, 0x15,
+  /* '$' */
+  0x00, 0x24, 0x6F, 0x1A, 0x00,
+  /* '%' */
+  0x00, 0x08, 0x0B, 0x34, 0x04,
+  /* '&' */
+  0x00, 0x38, 0x2E, 0x32, 0x22,
+  /* ''' */
+  0x00, 0x00, 0x07, 0x00, 0x00,
+  /* '(' */
+  0x00, 0x00, 0x3E, 0x41, 0x00,
+  /* ')' */
+  0x00, 0x41, 0x3E, 0x00, 0x00,
+  /* '*' */
+  0x00, 0x0A, 0x07, 0x0A, 0x00,
+  /* '+' */
+  0x08, 0x08, 0x3E, 0x08, 0x08,
+  /* ',' */
+  0x00, 0x00, 0x60, 0x10, 0x00,
+  /* '-' */
+  0x00, 0x08, 0x08, 0x08, 0x00,
+  /* '.' */
+  0x00, 0x00, 0x20, 0x00, 0x00,
+  /* '/' */
+  0x40, 0x30, 0x0E, 0x01, 0x00,
+  /* '0' */
+  0x00, 0x1E, 0x21, 0x1E, 0x00,
+  /* '1' */
+  0x20, 0x21, 0x3F, 0x20, 0x20,
+  /* '2' */
+  0x00, 0x32, 0x2D, 0x22, 0x00,
+  /* '3' */
+  0x00, 0x22, 0x29, 0x16, 0x00,
+  /* '4' */
+  0x00, 0x0C, 0x2A, 0x3F, 0x28,
+  /* '5' */
+  0x00, 0x17, 0x25, 0x19, 0x00,
+  /* '6' */
+  0x00, 0x3E, 0x25, 0x19, 0x00,
+  /* '7' */
+  0x00, 0x03, 0x39, 0x07, 0x00,
+  /* '8' */
+  0x00, 0x1A, 0x25, 0x1A, 0x00,
+  /* '9' */
+  0x00, 0x26, 0x29, 0x1F, 0x00,
+  /* ':' */
+  0x00, 0x00, 0x24, 0x00, 0x00,
+  /* ';' */
+  0x00, 0x00, 0x20, 0x14, 0x00,
+  /* '<' */
+  0x08, 0x08, 0x14, 0x22, 0x00,
+  /* '=' */
+  0x00, 0x0A, 0x0A, 0x0A, 0x00,
+  /* '>' */
+  0x00, 0x22, 0x14, 0x08, 0x08,
+  /* '?' */
+  0x00, 0x02, 0x29, 0x06, 0x00,
+  /* '@' */
+  0x00, 0x3E, 0x41, 0x49, 0x5E,
+  /* 'A' */
+  0x30, 0x2D, 0x0B, 0x2C, 0x30,
+  /* 'B' */
+  0x21, 0x3F, 0x25, 0x25, 0x1A,
+  /* 'C' */
+  0x00, 0x1F, 0x21, 0x23, 0x00,
+  /* 'D' */
+  0x21, 0x3F, 0x21, 0x21, 0x1E,
+  /* 'E' */
+  0x21, 0x3F, 0x25, 0x21, 0x33,
+  /* 'F' */
+  0x21, 0x3F, 0x25, 0x01, 0x03,
+  /* 'G' */
+  0x00, 0x1F, 0x21, 0x39, 0x08,
+  /* 'H' */
+  0x21, 0x3F, 0x25, 0x04, 0x3F,
+  /* 'I' */
+  0x00, 0x21, 0x3F, 0x21, 0x00,
+  /* 'J' */
+  0x00, 0x18, 0x21, 0x1F, 0x01,
+  /* 'K' */
+  0x21, 0x3F, 0x0C, 0x3B, 0x21,
+  /* 'L' */
+  0x21, 0x3F, 0x21, 0x20, 0x30,
+  /* 'M' */
+  0x3F, 0x27, 0x08, 0x27, 0x3F,
+  /* 'N' */
+  0x21, 0x3F, 0x26, 0x19, 0x3F,
+  /* 'O' */
+  0x00, 0x1E, 0x21, 0x21, 0x1E,
+  /* 'P' */
+  0x21, 0x3F, 0x29, 0x09, 0x06,
+  /* 'Q' */
+  0x00, 0x1E, 0x21, 0x61, 0x5E,
+  /* 'R' */
+  0x21, 0x3F, 0x29, 0x09, 0x36,
+  /* 'S' */
+  0x00, 0x33, 0x25, 0x3B, 0x00,
+  /* 'T' */
+  0x03, 0x21, 0x3F, 0x21, 0x03,
+  /* 'U' */
+  0x01, 0x1F, 0x20, 0x21, 0x1F,
+  /* 'V' */
+  0x03, 0x1D, 0x20, 0x39, 0x07,
+  /* 'W' */
+  0x1F, 0x21, 0x1C, 0x21, 0x1F,
+  /* 'X' */
+  0x21, 0x33, 0x0C, 0x33, 0x21,
+  /* 'Y' */
+  0x03, 0x25, 0x38, 0x25, 0x03,
+  /* 'Z' */
+  0x00, 0x33, 0x29, 0x25, 0x33,
+  /* '[' */
+  0x00, 0x00, 0x7F, 0x41, 0x00,
+  /* '\\' */
+  0x01, 0x06, 0x38, 0x40, 0x00,
+  /* ']' */
+  0x00, 0x41, 0x7F, 0x00, 0x00,
+  /* '^' */
+  0x00, 0x04, 0x03, 0x04, 0x00,
+  /* '_' */
+  0x80, 0x80, 0x80, 0x80, 0x80,
+  /* '`' */
+  0x00, 0x00, 0x01, 0x02, 0x00,
+  /* 'a' */
+  0x00, 0x30, 0x34, 0x3C, 0x20,
+  /* 'b' */
+  0x21, 0x3F, 0x24, 0x24, 0x18,
+  /* 'c' */
+  0x00, 0x3C, 0x24, 0x24, 0x00,
+  /* 'd' */
+  0x00, 0x18, 0x24, 0x25, 0x3F,
+  /* 'e' */
+  0x00, 0x1C, 0x2C, 0x2C, 0x00,
+  /* 'f' */
+  0x00, 0x24, 0x3E, 0x25, 0x00,
+  /* 'g' */
+  0x00, 0x18, 0xA4, 0xA4, 0x7C,
+  /* 'h' */
+  0x21, 0x3F, 0x24, 0x04, 0x38,
+  /* 'i' */
+  0x00, 0x24, 0x3D, 0x20, 0x00,
+  /* 'j' */
+  0x00, 0x84, 0x85, 0xFC, 0x00,
+  /* 'k' */
+  0x21, 0x3F, 0x08, 0x3C, 0x24,
+  /* 'l' */
+  0x00, 0x21, 0x3F, 0x20, 0x00,
+  /* 'm' */
+  0x3C, 0x04, 0x38, 0x04, 0x38,
+  /* 'n' */
+  0x24, 0x3C, 0x04, 0x04, 0x38,
+  /* 'o' */
+  0x00, 0x18, 0x24, 0x24, 0x18,
+  /* 'p' */
+  0x84, 0xFC, 0xA4, 0x24, 0x18,
+  /* 'q' */
+  0x00, 0x18, 0x24, 0xA4, 0xFC,
+  /* 'r' */
+  0x00, 0x24, 0x3C, 0x24, 0x04,
+  /* 's' */
+  0x00, 0x20, 0x2C, 0x14, 0x00,
+  /* 't' */
+  0x04, 0x1E, 0x24, 0x24, 0x10,
+  /* 'u' */
+  0x04, 0x1C, 0x20, 0x24, 0x3C,
+  /* 'v' */
+  0x04, 0x0C, 0x30, 0x30, 0x0C,
+  /* 'w' */
+  0x1C, 0x24, 0x18, 0x24, 0x1C,
+  /* 'x' */
+  0x00, 0x24, 0x18, 0x18, 0x24,
+  /* 'y' */
+  0x04, 0x9C, 0xE0, 0x1C, 0x04,
+  /* 'z' */
+  0x00, 0x2C, 0x34, 0x2C, 0x34,
+  /* '{' */
+  0x00, 0x08, 0x3E, 0x41, 0x00,
+  /* '|' */
+  0x00, 0x00, 0x7F, 0x00, 0x00,
+  /* '}' */
+  0x00, 0x41, 0x3E, 0x08, 0x00,
+  /* '~' */
+  0x00, 0x10, 0x08, 0x10, 0x08,
+};
+
+sFONT Font8_Rotate90 = {
+  Font8_Rotate90_Table,
+  5, /* Width */
+  8, /* Height */
+  ROTATE_90,
+  &Font8,
+};
+
+static const uint8_t Font8_Rotate180_Table[] PROGMEM = {
+  /* ' ' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '!' */
+  0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20,
+  /* '"' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x50,
+  /* '#' */
+  0x00, 0x28, 0x50, 0xF8, 0x50, 0xF8, 0x50, 0xA0,
+  /* '$' */
+  0x00, 0x20, 0x30, 0x40, 0x60, 0x30, 0x60, 0x20,
+  /* '%' */
+  0x00, 0x00, 0x40, 0x40, 0x30, 0xC0, 0x20, 0x20,
+  /* '&' */
+  0x00, 0x00, 0xF0, 0x50, 0x30, 0x20, 0xE0, 0x00,
+  /* ''' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20,
+  /* '(' */
+  0x00, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40,
+  /* ')' */
+  0x00, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10,
+  /* '*' */
+  0x00, 0x00, 0x00, 0x00, 0x50, 0x20, 0x70, 0x20,
+  /* '+' */
+  0x00, 0x00, 0x20, 0x20, 0xF8, 0x20, 0x20, 0x00,
+  /* ',' */
+  0x00, 0x20, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00,
+  /* '-' */
+  0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+  /* '.' */
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '/' */
+  0x00, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x40,
+  /* '0' */
+  0x00, 0x00, 0x20, 0x50, 0x50, 0x50, 0x50, 0x20,
+  /* '1' */
+  0x00, 0x00, 0xF8, 0x20, 0x20, 0x20, 0x20, 0x30,
+  /* '2' */
+  0x00, 0x00, 0x70, 0x10, 0x20, 0x20, 0x50, 0x20,
+  /* '3' */
+  0x00, 0x00, 0x30, 0x40, 0x20, 0x40, 0x50, 0x20,
+  /* '4' */
+  0x00, 0x00, 0xE0, 0x40, 0xF0, 0x50, 0x60, 0x40,
+  /* '5' */
+  0x00, 0x00, 0x20, 0x50, 0x40, 0x30, 0x10, 0x70,
+  /* '6' */
+  0x00, 0x00, 0x30, 0x50, 0x50, 0x30, 0x10, 0x60,
+  /* '7' */
+  0x00, 0x00, 0x20, 0x20, 0x20, 0x40, 0x50, 0x70,
+  /* '8' */
+  0x00, 0x00, 0x20, 0x50, 0x50, 0x20, 0x50, 0x20,
+  /* '9' */
+  0x00, 0x00, 0x30, 0x40, 0x60, 0x50, 0x50, 0x60,
+  /* ':' */
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00,
+  /* ';' */
+  0x00, 0x00, 0x20, 0x40, 0x00, 0x40, 0x00, 0x00,
+  /* '<' */
+  0x00, 0x00, 0x40, 0x20, 0x18, 0x20, 0x40, 0x00,
+  /* '=' */
+  0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x00,
+  /* '>' */
+  0x00, 0x00, 0x10, 0x20, 0xC0, 0x20, 0x10, 0x00,
+  /* '?' */
+  0x00, 0x00, 0x20, 0x00, 0x20, 0x40, 0x50, 0x20,
+  /* '@' */
+  0x00, 0xE0, 0x10, 0x90, 0xD0, 0x90, 0x90, 0x60,
+  /* 'A' */
+  0x00, 0x00, 0xD8, 0x88, 0x70, 0x50, 0x20, 0x30,
+  /* 'B' */
+  0x00, 0x00, 0x78, 0x90, 0x90, 0x70, 0x90, 0x78,
+  /* 'C' */
+  0x00, 0x00, 0x60, 0x10, 0x10, 0x10, 0x50, 0x70,
+  /* 'D' */
+  0x00, 0x00, 0x78, 0x90, 0x90, 0x90, 0x90, 0x78,
+  /* 'E' */
+  0x00, 0x00, 0xF8, 0x90, 0x10, 0x30, 0x90, 0xF8,
+  /* 'F' */
+  0x00, 0x00, 0x38, 0x10, 0x10, 0x30, 0x90, 0xF8,
+  /* 'G' */
+  0x00, 0x00, 0x60, 0x50, 0xD0, 0x10, 0x10, 0x70,
+  /* 'H' */
+  0x00, 0x00, 0xB8, 0x90, 0x90, 0xF0, 0x90, 0xB8,
+  /* 'I' */
+  0x00, 0x00, 0x70, 0x20, 0x20, 0x20, 0x20, 0x70,
+  /* 'J' */
+  0x00, 0x00, 0x20, 0x50, 0x50, 0x40, 0x40, 0xE0,
+  /* 'K' */
+  0x00, 0x00, 0xD8, 0x50, 0x70, 0x30, 0x50, 0xD8,
+  /* 'L' */
+  0x00, 0x00, 0xF8, 0x90, 0x10, 0x10, 0x10, 0x38,
+  /* 'M' */
+  0x00, 0x00, 0xD8, 0x88, 0xA8, 0xD8, 0xD8, 0xD8,
+  /* 'N' */
+  0x00, 0x00, 0xB8, 0xD0, 0xD0, 0xB0, 0xB0, 0xD8,
+  /* 'O' */
+  0x00, 0x00, 0x60, 0x90, 0x90, 0x90, 0x90, 0x60,
+  /* 'P' */
+  0x00, 0x00, 0x38, 0x10, 0x70, 0x90, 0x90, 0x78,
+  /* 'Q' */
+  0x00, 0xC0, 0x60, 0x90, 0x90, 0x90, 0x90, 0x60,
+  /* 'R' */
+  0x00, 0x00, 0xB8, 0x90, 0x70, 0x90, 0x90, 0x78,
+  /* 'S' */
+  0x00, 0x00, 0x70, 0x50, 0x40, 0x20, 0x50, 0x70,
+  /* 'T' */
+  0x00, 0x00, 0x70, 0x20, 0x20, 0x20, 0xA8, 0xF8,
+  /* 'U' */
+  0x00, 0x00, 0x60, 0x90, 0x90, 0x90, 0x90, 0xD8,
+  /* 'V' */
+  0x00, 0x00, 0x60, 0x50, 0x50, 0x90, 0x88, 0xD8,
+  /* 'W' */
+  0x00, 0x00, 0x50, 0xA8, 0xA8, 0xA8, 0x88, 0xD8,
+  /* 'X' */
+  0x00, 0x00, 0xD8, 0x50, 0x20, 0x20, 0x50, 0xD8,
+  /* 'Y' */
+  0x00, 0x00, 0x70, 0x20, 0x20, 0x50, 0x88, 0xD8,
+  /* 'Z' */
+  0x00, 0x00, 0xF0, 0x90, 0x20, 0x40, 0x90, 0xF0,
+  /* '[' */
+  0x00, 0x60, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60,
+  /* '\\' */
+  0x00, 0x40, 0x20, 0x20, 0x20, 0x10, 0x10, 0x08,
+  /* ']' */
+  0x00, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30,
+  /* '^' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x20, 0x20,
+  /* '_' */
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '`' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x20,
+  /* 'a' */
+  0x00, 0x00, 0xF0, 0x70, 0x40, 0x60, 0x00, 0x00,
+  /* 'b' */
+  0x00, 0x00, 0x78, 0x90, 0x90, 0x70, 0x10, 0x18,
+  /* 'c' */
+  0x00, 0x00, 0x70, 0x10, 0x10, 0x70, 0x00, 0x00,
+  /* 'd' */
+  0x00, 0x00, 0xE0, 0x90, 0x90, 0xE0, 0x80, 0xC0,
+  /* 'e' */
+  0x00, 0x00, 0x60, 0x10, 0x70, 0x70, 0x00, 0x00,
+  /* 'f' */
+  0x00, 0x00, 0x70, 0x20, 0x20, 0x70, 0x20, 0x40,
+  /* 'g' */
+  0x60, 0x80, 0xE0, 0x90, 0x90, 0xE0, 0x00, 0x00,
+  /* 'h' */
+  0x00, 0x00, 0xB8, 0x90, 0x90, 0x70, 0x10, 0x18,
+  /* 'i' */
+  0x00, 0x00, 0x70, 0x20, 0x20, 0x30, 0x00, 0x20,
+  /* 'j' */
+  0x70, 0x40, 0x40, 0x40, 0x40, 0x70, 0x00, 0x20,
+  /* 'k' */
+  0x00, 0x00, 0xD8, 0x50, 0x70, 0xD0, 0x10, 0x18,
+  /* 'l' */
+  0x00, 0x00, 0x70, 0x20, 0x20, 0x20, 0x20, 0x30,
+  /* 'm' */
+  0x00, 0x00, 0xA8, 0xA8, 0xA8, 0x58, 0x00, 0x00,
+  /* 'n' */
+  0x00, 0x00, 0x98, 0x90, 0x90, 0x78, 0x00, 0x00,
+  /* 'o' */
+  0x00, 0x00, 0x60, 0x90, 0x90, 0x60, 0x00, 0x00,
+  /* 'p' */
+  0x38, 0x10, 0x70, 0x90, 0x90, 0x78, 0x00, 0x00,
+  /* 'q' */
+  0xC0, 0x80, 0xE0, 0x90, 0x90, 0xE0, 0x00, 0x00,
+  /* 'r' */
+  0x00, 0x00, 0x70, 0x20, 0x20, 0xF0, 0x00, 0x00,
+  /* 's' */
+  0x00, 0x00, 0x30, 0x40, 0x20, 0x60, 0x00, 0x00,
+  /* 't' */
+  0x00, 0x00, 0x60, 0x90, 0x10, 0x78, 0x10, 0x00,
+  /* 'u' */
+  0x00, 0x00, 0xE0, 0x90, 0x90, 0xD8, 0x00, 0x00,
+  /* 'v' */
+  0x00, 0x00, 0x60, 0x60, 0x90, 0x98, 0x00, 0x00,
+  /* 'w' */
+  0x00, 0x00, 0x50, 0xA8, 0xA8, 0xD8, 0x00, 0x00,
+  /* 'x' */
+  0x00, 0x00, 0x90, 0x60, 0x60, 0x90, 0x00, 0x00,
+  /* 'y' */
+  0x30, 0x20, 0x20, 0x50, 0x50, 0xD8, 0x00, 0x00,
+  /* 'z' */
+  0x00, 0x00, 0xF0, 0xA0, 0x50, 0xF0, 0x00, 0x00,
+  /* '{' */
+  0x00, 0x40, 0x20, 0x20, 0x30, 0x20, 0x20, 0x40,
+  /* '|' */
+  0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  /* '}' */
+  0x00, 0x10, 0x20, 0x20, 0x60, 0x20, 0x20, 0x10,
+  /* '~' */
+  0x00, 0x00, 0x00, 0x50, 0xA0, 0x00, 0x00, 0x00,
+};
+
+sFONT Font8_Rotate180 = {
+  Font8_Rotate180_Table,
+  5, /* Width */
+  8, /* Height */
+  ROTATE_180,
+  &Font8,
+};
+
+static const uint8_t Font8_Rotate270_Table[] PROGMEM = {
+  /* ' ' */
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '!' */
+  0x00, 0x00, 0xF4, 0x00, 0x00,
+  /* '"' */
+  0x00, 0xC0, 0x00, 0xC0, 0x00,
+  /* '#' */
+  0xA8, 0x7C, 0xAA, 0x7C, 0x2A,
+  /* '$' */
+  0x00, 0x58, 0xF6, 0x24, 0x00,
+  /* '%' */
+  0x20, 0x2C, 0xD0, 0x10, 0x00,
+  /* '&' */
+  0x44, 0x4C, 0x74, 0x1C, 0x00,
+  /* ''' */
+  0x00, 0x00, 0xE0, 0x00, 0x00,
+  /* '(' */
+  0x00, 0x82, 0x7C, 0x00, 0x00,
+  /* ')' */
+  0x00, 0x00, 0x7C, 0x82, 0x00,
+  /* '*' */
+  0x00, 0x50, 0xE0, 0x50, 0x00,
+  /* '+' */
+  0x10, 0x10, 0x7C, 0x10, 0x10,
+  /* ',' */
+  0x00, 0x08, 0x06, 0x00, 0x00,
+  /* '-' */
+  0x00, 0x10, 0x10, 0x10, 0x00,
+  /* '.' */
+  0x00, 0x00, 0x04, 0x00, 0x00,
+  /* '/' */
+  0x00, 0x80, 0x70, 0x0C, 0x02,
+  /* '0' */
+  0x00, 0x78, 0x84, 0x78, 0x00,
+  /* '1' */
+  0x04, 0x04, 0xFC, 0x84, 0x04,
+  /* '2' */
+  0x00, 0x44, 0xB4, 0x4C, 0x00,
+  /* '3' */
+  0x00, 0x68, 0x94, 0x44, 0x00,
+  /* '4' */
+  0x14, 0xFC, 0x54, 0x30, 0x00,
+  /* '5' */
+  0x00, 0x98, 0xA4, 0xE8, 0x00,
+  /* '6' */
+  0x00, 0x98, 0xA4, 0x7C, 0x00,
+  /* '7' */
+  0x00, 0xE0, 0x9C, 0xC0, 0x00,
+  /* '8' */
+  0x00, 0x58, 0xA4, 0x58, 0x00,
+  /* '9' */
+  0x00, 0xF8, 0x94, 0x64, 0x00,
+  /* ':' */
+  0x00, 0x00, 0x24, 0x00, 0x00,
+  /* ';' */
+  0x00, 0x28, 0x04, 0x00, 0x00,
+  /* '<' */
+  0x00, 0x44, 0x28, 0x10, 0x10,
+  /* '=' */
+  0x00, 0x50, 0x50, 0x50, 0x00,
+  /* '>' */
+  0x10, 0x10, 0x28, 0x44, 0x00,
+  /* '?' */
+  0x00, 0x60, 0x94, 0x40, 0x00,
+  /* '@' */
+  0x7A, 0x92, 0x82, 0x7C, 0x00,
+  /* 'A' */
+  0x0C, 0x34, 0xD0, 0xB4, 0x0C,
+  /* 'B' */
+  0x58, 0xA4, 0xA4, 0xFC, 0x84,
+  /* 'C' */
+  0x00, 0xC4, 0x84, 0xF8, 0x00,
+  /* 'D' */
+  0x78, 0x84, 0x84, 0xFC, 0x84,
+  /* 'E' */
+  0xCC, 0x84, 0xA4, 0xFC, 0x84,
+  /* 'F' */
+  0xC0, 0x80, 0xA4, 0xFC, 0x84,
+  /* 'G' */
+  0x10, 0x9C, 0x84, 0xF8, 0x00,
+  /* 'H' */
+  0xFC, 0x20, 0xA4, 0xFC, 0x84,
+  /* 'I' */
+  0x00, 0x84, 0xFC, 0x84, 0x00,
+  /* 'J' */
+  0x80, 0xF8, 0x84, 0x18, 0x00,
+  /* 'K' */
+  0x84, 0xDC, 0x30, 0xFC, 0x84,
+  /* 'L' */
+  0x0C, 0x04, 0x84, 0xFC, 0x84,
+  /* 'M' */
+  0xFC, 0xE4, 0x10, 0xE4, 0xFC,
+  /* 'N' */
+  0xFC, 0x98, 0x64, 0xFC, 0x84,
+  /* 'O' */
+  0x78, 0x84, 0x84, 0x78, 0x00,
+  /* 'P' */
+  0x60, 0x90, 0x94, 0xFC, 0x84,
+  /* 'Q' */
+  0x7A, 0x86, 0x84, 0x78, 0x00,
+  /* 'R' */
+  0x6C, 0x90, 0x94, 0xFC, 0x84,
+  /* 'S' */
+  0x00, 0xDC, 0xA4, 0xCC, 0x00,
+  /* 'T' */
+  0xC0, 0x84, 0xFC, 0x84, 0xC0,
+  /* 'U' */
+  0xF8, 0x84, 0x04, 0xF8, 0x80,
+  /* 'V' */
+  0xE0, 0x9C, 0x04, 0xB8, 0xC0,
+  /* 'W' */
+  0xF8, 0x84, 0x38, 0x84, 0xF8,
+  /* 'X' */
+  0x84, 0xCC, 0x30, 0xCC, 0x84,
+  /* 'Y' */
+  0xC0, 0xA4, 0x1C, 0xA4, 0xC0,
+  /* 'Z' */
+  0xCC, 0xA4, 0x94, 0xCC, 0x00,
+  /* '[' */
+  0x00, 0x82, 0xFE, 0x00, 0x00,
+  /* '\\' */
+  0x00, 0x02, 0x1C, 0x60, 0x80,
+  /* ']' */
+  0x00, 0x00, 0xFE, 0x82, 0x00,
+  /* '^' */
+  0x00, 0x20, 0xC0, 0x20, 0x00,
+  /* '_' */
+  0x01, 0x01, 0x01, 0x01, 0x01,
+  /* '`' */
+  0x00, 0x40, 0x80, 0x00, 0x00,
+  /* 'a' */
+  0x04, 0x3C, 0x2C, 0x0C, 0x00,
+  /* 'b' */
+  0x18, 0x24, 0x24, 0xFC, 0x84,
+  /* 'c' */
+  0x00, 0x24, 0x24, 0x3C, 0x00,
+  /* 'd' */
+  0xFC, 0xA4, 0x24, 0x18, 0x00,
+  /* 'e' */
+  0x00, 0x34, 0x34, 0x38, 0x00,
+  /* 'f' */
+  0x00, 0xA4, 0x7C, 0x24, 0x00,
+  /* 'g' */
+  0x3E, 0x25, 0x25, 0x18, 0x00,
+  /* 'h' */
+  0x1C, 0x20, 0x24, 0xFC, 0x84,
+  /* 'i' */
+  0x00, 0x04, 0xBC, 0x24, 0x00,
+  /* 'j' */
+  0x00, 0x3F, 0xA1, 0x21, 0x00,
+  /* 'k' */
+  0x24, 0x3C, 0x10, 0xFC, 0x84,
+  /* 'l' */
+  0x00, 0x04, 0xFC, 0x84, 0x00,
+  /* 'm' */
+  0x1C, 0x20, 0x1C, 0x20, 0x3C,
+  /* 'n' */
+  0x1C, 0x20, 0x20, 0x3C, 0x24,
+  /* 'o' */
+  0x18, 0x24, 0x24, 0x18, 0x00,
+  /* 'p' */
+  0x18, 0x24, 0x25, 0x3F, 0x21,
+  /* 'q' */
+  0x3F, 0x25, 0x24, 0x18, 0x00,
+  /* 'r' */
+  0x20, 0x24, 0x3C, 0x24, 0x00,
+  /* 's' */
+  0x00, 0x28, 0x34, 0x04, 0x00,
+  /* 't' */
+  0x08, 0x24, 0x24, 0x78, 0x20,
+  /* 'u' */
+  0x3C, 0x24, 0x04, 0x38, 0x20,
+  /* 'v' */
+  0x30, 0x0C, 0x0C, 0x30, 0x20,
+  /* 'w' */
+  0x38, 0x24, 0x18, 0x24, 0x38,
+  /* 'x' */
+  0x24, 0x18, 0x18, 0x24, 0x00,
+  /* 'y' */
+  0x20, 0x38, 0x07, 0x39, 0x20,
+  /* 'z' */
+  0x2C, 0x34, 0x2C, 0x34, 0x00,
+  /* '{' */
+  0x00, 0x82, 0x7C, 0x10, 0x00,
+  /* '|' */
+  0x00, 0x00, 0xFE, 0x00, 0x00,
+  /* '}' */
+  0x00, 0x10, 0x7C, 0x82, 0x00,
+  /* '~' */
+  0x10, 0x08, 0x10, 0x08, 0x00,
+};
+
+sFONT Font8_Rotate270 = {
+  Font8_Rotate270_Table,
+  5, /* Width */
+  8, /* Height */
+  ROTATE_270,
+  &Font8,
+};
+
+static const uint8_t Font12_Rotate90_Table[] PROGMEM = {
+  /* ' ' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '!' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '"' */
+  0x00, 0x00, 0x00, 0xE0, 0x00, 0x20, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x20, 0x00, 0x00,
+  /* '#' */
+  0x00, 0x00, 0x35, 0x00, 0x0F, 0x80, 0x35, 0x60, 0x0F, 0x80, 0x05, 0x60, 0x00, 0x00,
+  /* '$' */
+  0x00, 0x00, 0x0D, 0x80, 0x0A, 0x40, 0x3A, 0x60, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00,
+  /* '%' */
+  0x00, 0x00, 0x02, 0x40, 0x02, 0xA0, 0x0A, 0x40, 0x15, 0x00, 0x09, 0x00, 0x00, 0x00,
+  /* '&' */
+  0x00, 0x00, 0x0C, 0x00, 0x13, 0x00, 0x14, 0x80, 0x08, 0x80, 0x14, 0x00, 0x00, 0x00,
+  /* ''' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '(' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00,
+  /* ')' */
+  0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '*' */
+  0x00, 0x00, 0x00, 0x40, 0x03, 0x40, 0x00, 0xE0, 0x03, 0x40, 0x00, 0x40, 0x00, 0x00,
+  /* '+' */
+  0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x1F, 0xC0, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
+  /* ',' */
+  0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '-' */
+  0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+  /* '.' */
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '/' */
+  0x00, 0x00, 0x20, 0x00, 0x18, 0x00, 0x06, 0x00, 0x01, 0x80, 0x00, 0x60, 0x00, 0x00,
+  /* '0' */
+  0x00, 0x00, 0x0F, 0xC0, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x0F, 0xC0, 0x00, 0x00,
+  /* '1' */
+  0x00, 0x00, 0x10, 0x00, 0x10, 0x20, 0x1F, 0xE0, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00,
+  /* '2' */
+  0x00, 0x00, 0x18, 0x40, 0x14, 0x20, 0x12, 0x20, 0x11, 0x20, 0x18, 0xC0, 0x00, 0x00,
+  /* '3' */
+  0x00, 0x00, 0x08, 0x40, 0x10, 0x20, 0x11, 0x20, 0x11, 0x20, 0x0E, 0xC0, 0x00, 0x00,
+  /* '4' */
+  0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x04, 0xC0, 0x14, 0x20, 0x1F, 0xE0, 0x14, 0x00,
+  /* '5' */
+  0x00, 0x00, 0x08, 0x00, 0x11, 0xE0, 0x11, 0x20, 0x11, 0x20, 0x0E, 0x20, 0x00, 0x00,
+  /* '6' */
+  0x00, 0x00, 0x0F, 0x80, 0x11, 0x40, 0x11, 0x20, 0x11, 0x20, 0x0E, 0x20, 0x00, 0x00,
+  /* '7' */
+  0x00, 0x00, 0x00, 0x60, 0x00, 0x20, 0x18, 0x20, 0x07, 0x20, 0x00, 0xE0, 0x00, 0x00,
+  /* '8' */
+  0x00, 0x00, 0x0E, 0xC0, 0x11, 0x20, 0x11, 0x20, 0x11, 0x20, 0x0E, 0xC0, 0x00, 0x00,
+  /* '9' */
+  0x00, 0x00, 0x11, 0xC0, 0x12, 0x20, 0x12, 0x20, 0x0A, 0x20, 0x07, 0xC0, 0x00, 0x00,
+  /* ':' */
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x80, 0x19, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ';' */
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x19, 0x80, 0x09, 0x80, 0x00, 0x00, 0x00, 0x00,
+  /* '<' */
+  0x02, 0x00, 0x05, 0x00, 0x05, 0x00, 0x08, 0x80, 0x10, 0x40, 0x10, 0x40, 0x00, 0x00,
+  /* '=' */
+  0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00,
+  /* '>' */
+  0x10, 0x40, 0x10, 0x40, 0x08, 0x80, 0x05, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00,
+  /* '?' */
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x80, 0x14, 0x40, 0x02, 0x40, 0x01, 0x80, 0x00, 0x00,
+  /* '@' */
+  0x00, 0x00, 0x1F, 0xE0, 0x20, 0x10, 0x23, 0x10, 0x24, 0x90, 0x17, 0xE0, 0x00, 0x00,
+  /* 'A' */
+  0x10, 0x00, 0x1C, 0x00, 0x17, 0xA0, 0x04, 0x60, 0x17, 0x80, 0x1C, 0x00, 0x10, 0x00,
+  /* 'B' */
+  0x10, 0x20, 0x1F, 0xE0, 0x11, 0x20, 0x11, 0x20, 0x11, 0x20, 0x0E, 0xC0, 0x00, 0x00,
+  /* 'C' */
+  0x00, 0x00, 0x0F, 0xC0, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x08, 0x60, 0x00, 0x00,
+  /* 'D' */
+  0x10, 0x20, 0x1F, 0xE0, 0x10, 0x20, 0x10, 0x20, 0x08, 0x40, 0x07, 0x80, 0x00, 0x00,
+  /* 'E' */
+  0x10, 0x20, 0x1F, 0xE0, 0x11, 0x20, 0x13, 0xA0, 0x10, 0x20, 0x18, 0x60, 0x00, 0x00,
+  /* 'F' */
+  0x00, 0x00, 0x10, 0x20, 0x1F, 0xE0, 0x11, 0x20, 0x03, 0xA0, 0x00, 0x20, 0x00, 0x60,
+  /* 'G' */
+  0x00, 0x00, 0x0F, 0xC0, 0x10, 0x20, 0x10, 0x20, 0x12, 0x20, 0x0E, 0x60, 0x02, 0x00,
+  /* 'H' */
+  0x10, 0x20, 0x1F, 0xE0, 0x11, 0x20, 0x01, 0x00, 0x11, 0x20, 0x1F, 0xE0, 0x10, 0x20,
+  /* 'I' */
+  0x00, 0x00, 0x10, 0x20, 0x10, 0x20, 0x1F, 0xE0, 0x10, 0x20, 0x10, 0x20, 0x00, 0x00,
+  /* 'J' */
+  0x00, 0x00, 0x0E, 0x00, 0x10, 0x20, 0x10, 0x20, 0x0F, 0xE0, 0x00, 0x20, 0x00, 0x00,
+  /* 'K' */
+  0x10, 0x20, 0x1F, 0xE0, 0x12, 0x20, 0x03, 0x00, 0x04, 0xA0, 0x18, 0x60, 0x10, 0x20,
+  /* 'L' */
+  0x00, 0x00, 0x10, 0x20, 0x1F, 0xE0, 0x10, 0x20, 0x10, 0x00, 0x1C, 0x00, 0x00, 0x00,
+  /* 'M' */
+  0x10, 0x20, 0x1F, 0xE0, 0x10, 0xE0, 0x03, 0x00, 0x10, 0xE0, 0x1F, 0xE0, 0x10, 0x20,
+  /* 'N' */
+  0x10, 0x20, 0x1F, 0xE0, 0x10, 0xE0, 0x07, 0x00, 0x18, 0x20, 0x1F, 0xE0, 0x00, 0x20,
+  /* 'O' */
+  0x00, 0x00, 0x0F, 0xC0, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x0F, 0xC0, 0x00, 0x00,
+  /* 'P' */
+  0x00, 0x00, 0x10, 0x20, 0x1F, 0xE0, 0x12, 0x20, 0x02, 0x20, 0x01, 0xC0, 0x00, 0x00,
+  /* 'Q' */
+  0x00, 0x00, 0x0F, 0xC0, 0x10, 0x20, 0x30, 0x20, 0x30, 0x20, 0x2F, 0xC0, 0x00, 0x00,
+  /* 'R' */
+  0x10, 0x20, 0x1F, 0xE0, 0x12, 0x20, 0x02, 0x20, 0x06, 0x20, 0x09, 0xC0, 0x10, 0x00,
+  /* 'S' */
+  0x00, 0x00, 0x18, 0xC0, 0x09, 0x20, 0x11, 0x20, 0x11, 0x40, 0x0E, 0x60, 0x00, 0x00,
+  /* 'T' */
+  0x00, 0x60, 0x00, 0x20, 0x10, 0x20, 0x1F, 0xE0, 0x10, 0x20, 0x00, 0x20, 0x00, 0x60,
+  /* 'U' */
+  0x00, 0x20, 0x0F, 0xE0, 0x10, 0x20, 0x10, 0x00, 0x10, 0x20, 0x0F, 0xE0, 0x00, 0x20,
+  /* 'V' */
+  0x00, 0x20, 0x00, 0xE0, 0x07, 0x20, 0x18, 0x00, 0x07, 0x20, 0x00, 0xE0, 0x00, 0x20,
+  /* 'W' */
+  0x00, 0x20, 0x0F, 0xE0, 0x10, 0x20, 0x0F, 0x00, 0x10, 0x20, 0x0F, 0xE0, 0x00, 0x20,
+  /* 'X' */
+  0x10, 0x20, 0x18, 0x60, 0x04, 0x80, 0x03, 0x00, 0x04, 0x80, 0x18, 0x60, 0x10, 0x20,
+  /* 'Y' */
+  0x00, 0x20, 0x00, 0x60, 0x11, 0xA0, 0x1E, 0x00, 0x11, 0xA0, 0x00, 0x60, 0x00, 0x20,
+  /* 'Z' */
+  0x00, 0x00, 0x18, 0x60, 0x14, 0x20, 0x13, 0x20, 0x10, 0xA0, 0x18, 0x60, 0x00, 0x00,
+  /* '[' */
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x40, 0x20, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00,
+  /* '\\' */
+  0x00, 0x00, 0x00, 0x20, 0x01, 0xC0, 0x06, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ']' */
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x40, 0x20, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  /* '^' */
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x60, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00,
+  /* '_' */
+  0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
+  /* '`' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+  /* 'a' */
+  0x00, 0x00, 0x0D, 0x00, 0x12, 0x80, 0x12, 0x80, 0x12, 0x80, 0x1F, 0x00, 0x10, 0x00,
+  /* 'b' */
+  0x10, 0x20, 0x1F, 0xE0, 0x11, 0x00, 0x10, 0x80, 0x10, 0x80, 0x0F, 0x00, 0x00, 0x00,
+  /* 'c' */
+  0x00, 0x00, 0x0F, 0x00, 0x10, 0x80, 0x10, 0x80, 0x10, 0x80, 0x09, 0x80, 0x00, 0x00,
+  /* 'd' */
+  0x00, 0x00, 0x0F, 0x00, 0x10, 0x80, 0x10, 0x80, 0x11, 0x20, 0x1F, 0xE0, 0x10, 0x00,
+  /* 'e' */
+  0x00, 0x00, 0x0F, 0x00, 0x12, 0x80, 0x12, 0x80, 0x12, 0x80, 0x13, 0x00, 0x00, 0x00,
+  /* 'f' */
+  0x00, 0x00, 0x10, 0x80, 0x1F, 0xC0, 0x10, 0xA0, 0x10, 0xA0, 0x10, 0xA0, 0x00, 0x00,
+  /* 'g' */
+  0x00, 0x00, 0x0F, 0x00, 0x50, 0x80, 0x50, 0x80, 0x51, 0x00, 0x3F, 0x80, 0x00, 0x80,
+  /* 'h' */
+  0x10, 0x20, 0x1F, 0xE0, 0x11, 0x00, 0x00, 0x80, 0x10, 0x80, 0x1F, 0x00, 0x10, 0x00,
+  /* 'i' */
+  0x00, 0x00, 0x10, 0x80, 0x10, 0x80, 0x1F, 0xA0, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00,
+  /* 'j' */
+  0x00, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0xA0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00,
+  /* 'k' */
+  0x10, 0x20, 0x1F, 0xE0, 0x02, 0x00, 0x16, 0x80, 0x19, 0x80, 0x10, 0x80, 0x00, 0x00,
+  /* 'l' */
+  0x00, 0x00, 0x10, 0x00, 0x10, 0x20, 0x1F, 0xE0, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00,
+  /* 'm' */
+  0x10, 0x80, 0x1F, 0x80, 0x10, 0x80, 0x1F, 0x00, 0x10, 0x80, 0x1F, 0x00, 0x10, 0x00,
+  /* 'n' */
+  0x10, 0x80, 0x1F, 0x80, 0x11, 0x00, 0x00, 0x80, 0x10, 0x80, 0x1F, 0x00, 0x10, 0x00,
+  /* 'o' */
+  0x00, 0x00, 0x0F, 0x00, 0x10, 0x80, 0x10, 0x80, 0x10, 0x80, 0x0F, 0x00, 0x00, 0x00,
+  /* 'p' */
+  0x40, 0x80, 0x7F, 0x80, 0x51, 0x00, 0x10, 0x80, 0x10, 0x80, 0x0F, 0x00, 0x00, 0x00,
+  /* 'q' */
+  0x00, 0x00, 0x0F, 0x00, 0x10, 0x80, 0x10, 0x80, 0x51, 0x00, 0x7F, 0x80, 0x40, 0x80,
+  /* 'r' */
+  0x00, 0x00, 0x10, 0x80, 0x1F, 0x80, 0x11, 0x00, 0x10, 0x80, 0x10, 0x80, 0x00, 0x00,
+  /* 's' */
+  0x00, 0x00, 0x19, 0x00, 0x12, 0x80, 0x12, 0x80, 0x12, 0x80, 0x0D, 0x80, 0x00, 0x00,
+  /* 't' */
+  0x00, 0x00, 0x00, 0x80, 0x0F, 0xC0, 0x10, 0x80, 0x10, 0x80, 0x10, 0x80, 0x08, 0x00,
+  /* 'u' */
+  0x00, 0x80, 0x0F, 0x80, 0x10, 0x00, 0x10, 0x00, 0x08, 0x80, 0x1F, 0x80, 0x10, 0x00,
+  /* 'v' */
+  0x00, 0x80, 0x03, 0x80, 0x0C, 0x80, 0x10, 0x00, 0x0C, 0x80, 0x03, 0x80, 0x00, 0x80,
+  /* 'w' */
+  0x00, 0x80, 0x0F, 0x80, 0x10, 0x80, 0x0E, 0x00, 0x10, 0x80, 0x0F, 0x80, 0x00, 0x80,
+  /* 'x' */
+  0x10, 0x80, 0x19, 0x80, 0x06, 0x00, 0x06, 0x00, 0x19, 0x80, 0x10, 0x80, 0x00, 0x00,
+  /* 'y' */
+  0x00, 0x80, 0x41, 0x80, 0x46, 0x80, 0x78, 0x00, 0x4C, 0x80, 0x03, 0x80, 0x00, 0x80,
+  /* 'z' */
+  0x00, 0x00, 0x19, 0x80, 0x14, 0x80, 0x12, 0x80, 0x11, 0x80, 0x18, 0x80, 0x00, 0x00,
+  /* '{' */
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x3B, 0xC0, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00,
+  /* '|' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '}' */
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x3B, 0xC0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '~' */
+  0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x04, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00,
+};
+
+sFONT Font12_Rotate90 = {
+  Font12_Rotate90_Table,
+  7, /* Width */
+  12, /* Height */
+  ROTATE_90,
+  &Font12,
+};
+
+static const uint8_t Font12_Rotate180_Table[] PROGMEM = {
+  /* ' ' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '!' */
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00,
+  /* '"' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x6C, 0x00,
+  /* '#' */
+  0x00, 0x00, 0x14, 0x14, 0x28, 0x7C, 0x28, 0x7C, 0x28, 0x50, 0x50, 0x00,
+  /* '$' */
+  0x00, 0x00, 0x10, 0x10, 0x1C, 0x24, 0x38, 0x04, 0x04, 0x38, 0x10, 0x00,
+  /* '%' */
+  0x00, 0x00, 0x00, 0x20, 0x50, 0x20, 0x1C, 0x60, 0x08, 0x14, 0x08, 0x00,
+  /* '&' */
+  0x00, 0x00, 0x00, 0x58, 0x24, 0x54, 0x08, 0x08, 0x30, 0x00, 0x00, 0x00,
+  /* ''' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x00,
+  /* '(' */
+  0x00, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x00,
+  /* ')' */
+  0x00, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x00,
+  /* '*' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x28, 0x10, 0x7C, 0x10, 0x00,
+  /* '+' */
+  0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0xFE, 0x10, 0x10, 0x10, 0x00, 0x00,
+  /* ',' */
+  0x00, 0x08, 0x18, 0x10, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '-' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '.' */
+  0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '/' */
+  0x00, 0x00, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x00,
+  /* '0' */
+  0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x00,
+  /* '1' */
+  0x00, 0x00, 0x00, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x00,
+  /* '2' */
+  0x00, 0x00, 0x00, 0x7C, 0x44, 0x08, 0x10, 0x20, 0x40, 0x44, 0x38, 0x00,
+  /* '3' */
+  0x00, 0x00, 0x00, 0x38, 0x44, 0x40, 0x40, 0x30, 0x40, 0x44, 0x38, 0x00,
+  /* '4' */
+  0x00, 0x00, 0x00, 0xE0, 0x40, 0xFC, 0x44, 0x48, 0x50, 0x50, 0x60, 0x00,
+  /* '5' */
+  0x00, 0x00, 0x00, 0x38, 0x44, 0x40, 0x40, 0x38, 0x08, 0x08, 0x78, 0x00,
+  /* '6' */
+  0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x3C, 0x04, 0x08, 0x70, 0x00,
+  /* '7' */
+  0x00, 0x00, 0x00, 0x10, 0x10, 0x20, 0x20, 0x20, 0x40, 0x44, 0x7C, 0x00,
+  /* '8' */
+  0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x44, 0x44, 0x38, 0x00,
+  /* '9' */
+  0x00, 0x00, 0x00, 0x1C, 0x20, 0x40, 0x78, 0x44, 0x44, 0x44, 0x38, 0x00,
+  /* ':' */
+  0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00,
+  /* ';' */
+  0x00, 0x00, 0x08, 0x18, 0x30, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00,
+  /* '<' */
+  0x00, 0x00, 0x00, 0x60, 0x10, 0x0C, 0x02, 0x0C, 0x10, 0x60, 0x00, 0x00,
+  /* '=' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+  /* '>' */
+  0x00, 0x00, 0x00, 0x06, 0x08, 0x30, 0x40, 0x30, 0x08, 0x06, 0x00, 0x00,
+  /* '?' */
+  0x00, 0x00, 0x00, 0x18, 0x00, 0x10, 0x20, 0x40, 0x48, 0x30, 0x00, 0x00,
+  /* '@' */
+  0x00, 0x00, 0x38, 0x44, 0x04, 0x64, 0x54, 0x54, 0x64, 0x44, 0x44, 0x38,
+  /* 'A' */
+  0x00, 0x00, 0x00, 0xEE, 0x44, 0x7C, 0x28, 0x28, 0x28, 0x10, 0x18, 0x00,
+  /* 'B' */
+  0x00, 0x00, 0x00, 0x3E, 0x44, 0x44, 0x44, 0x3C, 0x44, 0x44, 0x3E, 0x00,
+  /* 'C' */
+  0x00, 0x00, 0x00, 0x38, 0x44, 0x04, 0x04, 0x04, 0x04, 0x44, 0x78, 0x00,
+  /* 'D' */
+  0x00, 0x00, 0x00, 0x1E, 0x24, 0x44, 0x44, 0x44, 0x44, 0x24, 0x1E, 0x00,
+  /* 'E' */
+  0x00, 0x00, 0x00, 0x7E, 0x44, 0x04, 0x14, 0x1C, 0x14, 0x44, 0x7E, 0x00,
+  /* 'F' */
+  0x00, 0x00, 0x00, 0x1C, 0x08, 0x08, 0x28, 0x38, 0x28, 0x88, 0xFC, 0x00,
+  /* 'G' */
+  0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0xE4, 0x04, 0x04, 0x44, 0x78, 0x00,
+  /* 'H' */
+  0x00, 0x00, 0x00, 0xEE, 0x44, 0x44, 0x44, 0x7C, 0x44, 0x44, 0xEE, 0x00,
+  /* 'I' */
+  0x00, 0x00, 0x00, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00,
+  /* 'J' */
+  0x00, 0x00, 0x00, 0x18, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x78, 0x00,
+  /* 'K' */
+  0x00, 0x00, 0x00, 0xCE, 0x44, 0x24, 0x1C, 0x14, 0x24, 0x44, 0xEE, 0x00,
+  /* 'L' */
+  0x00, 0x00, 0x00, 0x7C, 0x48, 0x48, 0x08, 0x08, 0x08, 0x08, 0x1C, 0x00,
+  /* 'M' */
+  0x00, 0x00, 0x00, 0xEE, 0x44, 0x44, 0x54, 0x54, 0x6C, 0x6C, 0xEE, 0x00,
+  /* 'N' */
+  0x00, 0x00, 0x00, 0x6E, 0x64, 0x54, 0x54, 0x54, 0x4C, 0x4C, 0xEE, 0x00,
+  /* 'O' */
+  0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x00,
+  /* 'P' */
+  0x00, 0x00, 0x00, 0x1C, 0x08, 0x08, 0x38, 0x48, 0x48, 0x48, 0x3C, 0x00,
+  /* 'Q' */
+  0x00, 0x00, 0x70, 0x38, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x00,
+  /* 'R' */
+  0x00, 0x00, 0x00, 0x8E, 0x44, 0x24, 0x3C, 0x44, 0x44, 0x44, 0x3E, 0x00,
+  /* 'S' */
+  0x00, 0x00, 0x00, 0x34, 0x4C, 0x40, 0x40, 0x38, 0x04, 0x64, 0x58, 0x00,
+  /* 'T' */
+  0x00, 0x00, 0x00, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x92, 0xFE, 0x00,
+  /* 'U' */
+  0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xEE, 0x00,
+  /* 'V' */
+  0x00, 0x00, 0x00, 0x10, 0x10, 0x28, 0x28, 0x28, 0x44, 0x44, 0xEE, 0x00,
+  /* 'W' */
+  0x00, 0x00, 0x00, 0x28, 0x54, 0x54, 0x54, 0x54, 0x44, 0x44, 0xEE, 0x00,
+  /* 'X' */
+  0x00, 0x00, 0x00, 0xC6, 0x44, 0x28, 0x10, 0x10, 0x28, 0x44, 0xC6, 0x00,
+  /* 'Y' */
+  0x00, 0x00, 0x00, 0x38, 0x10, 0x10, 0x10, 0x28, 0x28, 0x44, 0xEE, 0x00,
+  /* 'Z' */
+  0x00, 0x00, 0x00, 0x7C, 0x44, 0x08, 0x10, 0x10, 0x20, 0x44, 0x7C, 0x00,
+  /* '[' */
+  0x00, 0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x38, 0x00,
+  /* '\\' */
+  0x00, 0x00, 0x20, 0x20, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x04, 0x00,
+  /* ']' */
+  0x00, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x38, 0x00,
+  /* '^' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x28, 0x10, 0x10, 0x00,
+  /* '_' */
+  0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '`' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x00,
+  /* 'a' */
+  0x00, 0x00, 0x00, 0xF8, 0x44, 0x44, 0x78, 0x44, 0x38, 0x00, 0x00, 0x00,
+  /* 'b' */
+  0x00, 0x00, 0x00, 0x3E, 0x44, 0x44, 0x44, 0x4C, 0x34, 0x04, 0x06, 0x00,
+  /* 'c' */
+  0x00, 0x00, 0x00, 0x38, 0x44, 0x04, 0x04, 0x44, 0x78, 0x00, 0x00, 0x00,
+  /* 'd' */
+  0x00, 0x00, 0x00, 0xF8, 0x44, 0x44, 0x44, 0x64, 0x58, 0x40, 0x60, 0x00,
+  /* 'e' */
+  0x00, 0x00, 0x00, 0x78, 0x04, 0x04, 0x7C, 0x44, 0x38, 0x00, 0x00, 0x00,
+  /* 'f' */
+  0x00, 0x00, 0x00, 0x7C, 0x08, 0x08, 0x08, 0x08, 0x7C, 0x08, 0x70, 0x00,
+  /* 'g' */
+  0x00, 0x38, 0x40, 0x78, 0x44, 0x44, 0x44, 0x64, 0xD8, 0x00, 0x00, 0x00,
+  /* 'h' */
+  0x00, 0x00, 0x00, 0xEE, 0x44, 0x44, 0x44, 0x4C, 0x34, 0x04, 0x06, 0x00,
+  /* 'i' */
+  0x00, 0x00, 0x00, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x1C, 0x00, 0x10, 0x00,
+  /* 'j' */
+  0x00, 0x1C, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x00, 0x10, 0x00,
+  /* 'k' */
+  0x00, 0x00, 0x00, 0x76, 0x24, 0x14, 0x1C, 0x24, 0x74, 0x04, 0x06, 0x00,
+  /* 'l' */
+  0x00, 0x00, 0x00, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x00,
+  /* 'm' */
+  0x00, 0x00, 0x00, 0xFE, 0x54, 0x54, 0x54, 0x54, 0x2E, 0x00, 0x00, 0x00,
+  /* 'n' */
+  0x00, 0x00, 0x00, 0xEE, 0x44, 0x44, 0x44, 0x4C, 0x36, 0x00, 0x00, 0x00,
+  /* 'o' */
+  0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00, 0x00,
+  /* 'p' */
+  0x00, 0x0E, 0x04, 0x3C, 0x44, 0x44, 0x44, 0x4C, 0x36, 0x00, 0x00, 0x00,
+  /* 'q' */
+  0x00, 0xE0, 0x40, 0x78, 0x44, 0x44, 0x44, 0x64, 0xD8, 0x00, 0x00, 0x00,
+  /* 'r' */
+  0x00, 0x00, 0x00, 0x7C, 0x08, 0x08, 0x08, 0x18, 0x6C, 0x00, 0x00, 0x00,
+  /* 's' */
+  0x00, 0x00, 0x00, 0x3C, 0x44, 0x40, 0x38, 0x44, 0x78, 0x00, 0x00, 0x00,
+  /* 't' */
+  0x00, 0x00, 0x00, 0x70, 0x88, 0x08, 0x08, 0x08, 0x7C, 0x08, 0x00, 0x00,
+  /* 'u' */
+  0x00, 0x00, 0x00, 0xD8, 0x64, 0x44, 0x44, 0x44, 0x66, 0x00, 0x00, 0x00,
+  /* 'v' */
+  0x00, 0x00, 0x00, 0x10, 0x28, 0x28, 0x44, 0x44, 0xEE, 0x00, 0x00, 0x00,
+  /* 'w' */
+  0x00, 0x00, 0x00, 0x28, 0x54, 0x54, 0x54, 0x44, 0xEE, 0x00, 0x00, 0x00,
+  /* 'x' */
+  0x00, 0x00, 0x00, 0x66, 0x24, 0x18, 0x18, 0x24, 0x66, 0x00, 0x00, 0x00,
+  /* 'y' */
+  0x00, 0x3C, 0x10, 0x10, 0x30, 0x28, 0x48, 0x44, 0xEE, 0x00, 0x00, 0x00,
+  /* 'z' */
+  0x00, 0x00, 0x00, 0x7C, 0x44, 0x08, 0x10, 0x24, 0x7C, 0x00, 0x00, 0x00,
+  /* '{' */
+  0x00, 0x20, 0x10, 0x10, 0x10, 0x08, 0x10, 0x10, 0x10, 0x10, 0x20, 0x00,
+  /* '|' */
+  0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00,
+  /* '}' */
+  0x00, 0x08, 0x10, 0x10, 0x10, 0x20, 0x10, 0x10, 0x10, 0x10, 0x08, 0x00,
+  /* '~' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+sFONT Font12_Rotate180 = {
+  Font12_Rotate180_Table,
+  7, /* Width */
+  12, /* Height */
+  ROTATE_180,
+  &Font12,
+};
+
+static const uint8_t Font12_Rotate270_Table[] PROGMEM = {
+  /* ' ' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '!' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '"' */
+  0x00, 0x00, 0x40, 0x00, 0x70, 0x00, 0x00, 0x00, 0x40, 0x00, 0x70, 0x00, 0x00, 0x00,
+  /* '#' */
+  0x00, 0x00, 0x6A, 0x00, 0x1F, 0x00, 0x6A, 0xC0, 0x1F, 0x00, 0x0A, 0xC0, 0x00, 0x00,
+  /* '$' */
+  0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x65, 0xC0, 0x25, 0x00, 0x1B, 0x00, 0x00, 0x00,
+  /* '%' */
+  0x00, 0x00, 0x09, 0x00, 0x0A, 0x80, 0x25, 0x00, 0x54, 0x00, 0x24, 0x00, 0x00, 0x00,
+  /* '&' */
+  0x00, 0x00, 0x02, 0x80, 0x11, 0x00, 0x12, 0x80, 0x0C, 0x80, 0x03, 0x00, 0x00, 0x00,
+  /* ''' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '(' */
+  0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ')' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00,
+  /* '*' */
+  0x00, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x70, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x00, 0x00,
+  /* '+' */
+  0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x3F, 0x80, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
+  /* ',' */
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xC0, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
+  /* '-' */
+  0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+  /* '.' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
+  /* '/' */
+  0x00, 0x00, 0x60, 0x00, 0x18, 0x00, 0x06, 0x00, 0x01, 0x80, 0x00, 0x40, 0x00, 0x00,
+  /* '0' */
+  0x00, 0x00, 0x3F, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x3F, 0x00, 0x00, 0x00,
+  /* '1' */
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x7F, 0x80, 0x40, 0x80, 0x00, 0x80, 0x00, 0x00,
+  /* '2' */
+  0x00, 0x00, 0x31, 0x80, 0x48, 0x80, 0x44, 0x80, 0x42, 0x80, 0x21, 0x80, 0x00, 0x00,
+  /* '3' */
+  0x00, 0x00, 0x37, 0x00, 0x48, 0x80, 0x48, 0x80, 0x40, 0x80, 0x21, 0x00, 0x00, 0x00,
+  /* '4' */
+  0x02, 0x80, 0x7F, 0x80, 0x42, 0x80, 0x32, 0x00, 0x0A, 0x00, 0x06, 0x00, 0x00, 0x00,
+  /* '5' */
+  0x00, 0x00, 0x47, 0x00, 0x48, 0x80, 0x48, 0x80, 0x78, 0x80, 0x01, 0x00, 0x00, 0x00,
+  /* '6' */
+  0x00, 0x00, 0x47, 0x00, 0x48, 0x80, 0x48, 0x80, 0x28, 0x80, 0x1F, 0x00, 0x00, 0x00,
+  /* '7' */
+  0x00, 0x00, 0x70, 0x00, 0x4E, 0x00, 0x41, 0x80, 0x40, 0x00, 0x60, 0x00, 0x00, 0x00,
+  /* '8' */
+  0x00, 0x00, 0x37, 0x00, 0x48, 0x80, 0x48, 0x80, 0x48, 0x80, 0x37, 0x00, 0x00, 0x00,
+  /* '9' */
+  0x00, 0x00, 0x3E, 0x00, 0x45, 0x00, 0x44, 0x80, 0x44, 0x80, 0x38, 0x80, 0x00, 0x00,
+  /* ':' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x80, 0x19, 0x80, 0x00, 0x00, 0x00, 0x00,
+  /* ';' */
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x19, 0x80, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* '<' */
+  0x00, 0x00, 0x20, 0x80, 0x20, 0x80, 0x11, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x04, 0x00,
+  /* '=' */
+  0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00,
+  /* '>' */
+  0x00, 0x00, 0x04, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x11, 0x00, 0x20, 0x80, 0x20, 0x80,
+  /* '?' */
+  0x00, 0x00, 0x18, 0x00, 0x24, 0x00, 0x22, 0x80, 0x10, 0x80, 0x00, 0x00, 0x00, 0x00,
+  /* '@' */
+  0x00, 0x00, 0x7E, 0x80, 0x92, 0x40, 0x8C, 0x40, 0x80, 0x40, 0x7F, 0x80, 0x00, 0x00,
+  /* 'A' */
+  0x00, 0x80, 0x03, 0x80, 0x1E, 0x80, 0x62, 0x00, 0x5E, 0x80, 0x03, 0x80, 0x00, 0x80,
+  /* 'B' */
+  0x00, 0x00, 0x37, 0x00, 0x48, 0x80, 0x48, 0x80, 0x48, 0x80, 0x7F, 0x80, 0x40, 0x80,
+  /* 'C' */
+  0x00, 0x00, 0x61, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x3F, 0x00, 0x00, 0x00,
+  /* 'D' */
+  0x00, 0x00, 0x1E, 0x00, 0x21, 0x00, 0x40, 0x80, 0x40, 0x80, 0x7F, 0x80, 0x40, 0x80,
+  /* 'E' */
+  0x00, 0x00, 0x61, 0x80, 0x40, 0x80, 0x5C, 0x80, 0x48, 0x80, 0x7F, 0x80, 0x40, 0x80,
+  /* 'F' */
+  0x60, 0x00, 0x40, 0x00, 0x5C, 0x00, 0x48, 0x80, 0x7F, 0x80, 0x40, 0x80, 0x00, 0x00,
+  /* 'G' */
+  0x04, 0x00, 0x67, 0x00, 0x44, 0x80, 0x40, 0x80, 0x40, 0x80, 0x3F, 0x00, 0x00, 0x00,
+  /* 'H' */
+  0x40, 0x80, 0x7F, 0x80, 0x48, 0x80, 0x08, 0x00, 0x48, 0x80, 0x7F, 0x80, 0x40, 0x80,
+  /* 'I' */
+  0x00, 0x00, 0x40, 0x80, 0x40, 0x80, 0x7F, 0x80, 0x40, 0x80, 0x40, 0x80, 0x00, 0x00,
+  /* 'J' */
+  0x00, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x40, 0x80, 0x40, 0x80, 0x07, 0x00, 0x00, 0x00,
+  /* 'K' */
+  0x40, 0x80, 0x61, 0x80, 0x52, 0x00, 0x0C, 0x00, 0x44, 0x80, 0x7F, 0x80, 0x40, 0x80,
+  /* 'L' */
+  0x00, 0x00, 0x03, 0x80, 0x00, 0x80, 0x40, 0x80, 0x7F, 0x80, 0x40, 0x80, 0x00, 0x00,
+  /* 'M' */
+  0x40, 0x80, 0x7F, 0x80, 0x70, 0x80, 0x0C, 0x00, 0x70, 0x80, 0x7F, 0x80, 0x40, 0x80,
+  /* 'N' */
+  0x40, 0x00, 0x7F, 0x80, 0x41, 0x80, 0x0E, 0x00, 0x70, 0x80, 0x7F, 0x80, 0x40, 0x80,
+  /* 'O' */
+  0x00, 0x00, 0x3F, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x3F, 0x00, 0x00, 0x00,
+  /* 'P' */
+  0x00, 0x00, 0x38, 0x00, 0x44, 0x00, 0x44, 0x80, 0x7F, 0x80, 0x40, 0x80, 0x00, 0x00,
+  /* 'Q' */
+  0x00, 0x00, 0x3F, 0x40, 0x40, 0xC0, 0x40, 0xC0, 0x40, 0x80, 0x3F, 0x00, 0x00, 0x00,
+  /* 'R' */
+  0x00, 0x80, 0x39, 0x00, 0x46, 0x00, 0x44, 0x00, 0x44, 0x80, 0x7F, 0x80, 0x40, 0x80,
+  /* 'S' */
+  0x00, 0x00, 0x67, 0x00, 0x28, 0x80, 0x48, 0x80, 0x49, 0x00, 0x31, 0x80, 0x00, 0x00,
+  /* 'T' */
+  0x60, 0x00, 0x40, 0x00, 0x40, 0x80, 0x7F, 0x80, 0x40, 0x80, 0x40, 0x00, 0x60, 0x00,
+  /* 'U' */
+  0x40, 0x00, 0x7F, 0x00, 0x40, 0x80, 0x00, 0x80, 0x40, 0x80, 0x7F, 0x00, 0x40, 0x00,
+  /* 'V' */
+  0x40, 0x00, 0x70, 0x00, 0x4E, 0x00, 0x01, 0x80, 0x4E, 0x00, 0x70, 0x00, 0x40, 0x00,
+  /* 'W' */
+  0x40, 0x00, 0x7F, 0x00, 0x40, 0x80, 0x0F, 0x00, 0x40, 0x80, 0x7F, 0x00, 0x40, 0x00,
+  /* 'X' */
+  0x40, 0x80, 0x61, 0x80, 0x12, 0x00, 0x0C, 0x00, 0x12, 0x00, 0x61, 0x80, 0x40, 0x80,
+  /* 'Y' */
+  0x40, 0x00, 0x60, 0x00, 0x58, 0x80, 0x07, 0x80, 0x58, 0x80, 0x60, 0x00, 0x40, 0x00,
+  /* 'Z' */
+  0x00, 0x00, 0x61, 0x80, 0x50, 0x80, 0x4C, 0x80, 0x42, 0x80, 0x61, 0x80, 0x00, 0x00,
+  /* '[' */
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x40, 0x20, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  /* '\\' */
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x06, 0x00, 0x38, 0x00, 0x40, 0x00, 0x00, 0x00,
+  /* ']' */
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x40, 0x20, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00,
+  /* '^' */
+  0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x60, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00,
+  /* '_' */
+  0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10,
+  /* '`' */
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'a' */
+  0x00, 0x80, 0x0F, 0x80, 0x14, 0x80, 0x14, 0x80, 0x14, 0x80, 0x0B, 0x00, 0x00, 0x00,
+  /* 'b' */
+  0x00, 0x00, 0x0F, 0x00, 0x10, 0x80, 0x10, 0x80, 0x08, 0x80, 0x7F, 0x80, 0x40, 0x80,
+  /* 'c' */
+  0x00, 0x00, 0x19, 0x00, 0x10, 0x80, 0x10, 0x80, 0x10, 0x80, 0x0F, 0x00, 0x00, 0x00,
+  /* 'd' */
+  0x00, 0x80, 0x7F, 0x80, 0x48, 0x80, 0x10, 0x80, 0x10, 0x80, 0x0F, 0x00, 0x00, 0x00,
+  /* 'e' */
+  0x00, 0x00, 0x0C, 0x80, 0x14, 0x80, 0x14, 0x80, 0x14, 0x80, 0x0F, 0x00, 0x00, 0x00,
+  /* 'f' */
+  0x00, 0x00, 0x50, 0x80, 0x50, 0x80, 0x50, 0x80, 0x3F, 0x80, 0x10, 0x80, 0x00, 0x00,
+  /* 'g' */
+  0x10, 0x00, 0x1F, 0xC0, 0x08, 0xA0, 0x10, 0xA0, 0x10, 0xA0, 0x0F, 0x00, 0x00, 0x00,
+  /* 'h' */
+  0x00, 0x80, 0x0F, 0x80, 0x10, 0x80, 0x10, 0x00, 0x08, 0x80, 0x7F, 0x80, 0x40, 0x80,
+  /* 'i' */
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x5F, 0x80, 0x10, 0x80, 0x10, 0x80, 0x00, 0x00,
+  /* 'j' */
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x50, 0x20, 0x10, 0x20, 0x10, 0x20, 0x00, 0x00,
+  /* 'k' */
+  0x00, 0x00, 0x10, 0x80, 0x19, 0x80, 0x16, 0x80, 0x04, 0x00, 0x7F, 0x80, 0x40, 0x80,
+  /* 'l' */
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x7F, 0x80, 0x40, 0x80, 0x00, 0x80, 0x00, 0x00,
+  /* 'm' */
+  0x00, 0x80, 0x0F, 0x80, 0x10, 0x80, 0x0F, 0x80, 0x10, 0x80, 0x1F, 0x80, 0x10, 0x80,
+  /* 'n' */
+  0x00, 0x80, 0x0F, 0x80, 0x10, 0x80, 0x10, 0x00, 0x08, 0x80, 0x1F, 0x80, 0x10, 0x80,
+  /* 'o' */
+  0x00, 0x00, 0x0F, 0x00, 0x10, 0x80, 0x10, 0x80, 0x10, 0x80, 0x0F, 0x00, 0x00, 0x00,
+  /* 'p' */
+  0x00, 0x00, 0x0F, 0x00, 0x10, 0x80, 0x10, 0x80, 0x08, 0xA0, 0x1F, 0xE0, 0x10, 0x20,
+  /* 'q' */
+  0x10, 0x20, 0x1F, 0xE0, 0x08, 0xA0, 0x10, 0x80, 0x10, 0x80, 0x0F, 0x00, 0x00, 0x00,
+  /* 'r' */
+  0x00, 0x00, 0x10, 0x80, 0x10, 0x80, 0x08, 0x80, 0x1F, 0x80, 0x10, 0x80, 0x00, 0x00,
+  /* 's' */
+  0x00, 0x00, 0x1B, 0x00, 0x14, 0x80, 0x14, 0x80, 0x14, 0x80, 0x09, 0x80, 0x00, 0x00,
+  /* 't' */
+  0x01, 0x00, 0x10, 0x80, 0x10, 0x80, 0x10, 0x80, 0x3F, 0x00, 0x10, 0x00, 0x00, 0x00,
+  /* 'u' */
+  0x00, 0x80, 0x1F, 0x80, 0x11, 0x00, 0x00, 0x80, 0x00, 0x80, 0x1F, 0x00, 0x10, 0x00,
+  /* 'v' */
+  0x10, 0x00, 0x1C, 0x00, 0x13, 0x00, 0x00, 0x80, 0x13, 0x00, 0x1C, 0x00, 0x10, 0x00,
+  /* 'w' */
+  0x10, 0x00, 0x1F, 0x00, 0x10, 0x80, 0x07, 0x00, 0x10, 0x80, 0x1F, 0x00, 0x10, 0x00,
+  /* 'x' */
+  0x00, 0x00, 0x10, 0x80, 0x19, 0x80, 0x06, 0x00, 0x06, 0x00, 0x19, 0x80, 0x10, 0x80,
+  /* 'y' */
+  0x10, 0x00, 0x1C, 0x00, 0x13, 0x20, 0x01, 0xE0, 0x16, 0x20, 0x18, 0x20, 0x10, 0x00,
+  /* 'z' */
+  0x00, 0x00, 0x11, 0x80, 0x18, 0x80, 0x14, 0x80, 0x12, 0x80, 0x19, 0x80, 0x00, 0x00,
+  /* '{' */
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x3D, 0xC0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '|' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '}' */
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3D, 0xC0, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00,
+  /* '~' */
+  0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00,
+};
+
+sFONT Font12_Rotate270 = {
+  Font12_Rotate270_Table,
+  7, /* Width */
+  12, /* Height */
+  ROTATE_270,
+  &Font12,
+};
+
+static const uint8_t Font16_Rotate90_Table[] PROGMEM = {
+  /* ' ' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '!' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFE, 0x05, 0xFE, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '"' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x7C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C,
+  0x00, 0x7C, 0x00, 0x0C, 0x00, 0x00,
+  /* '#' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x0F, 0xE0, 0x0F, 0xFE, 0x00, 0xBE, 0x0F, 0xE0, 0x0F, 0xFE,
+  0x00, 0xBE, 0x00, 0xA0, 0x00, 0x00,
+  /* '$' */
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x1C, 0x07, 0x3E, 0x04, 0x72, 0x1C, 0x63, 0x04, 0xE2, 0x07, 0xCE,
+  0x03, 0x8E, 0x00, 0x00, 0x00, 0x00,
+  /* '%' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0x00, 0xD2, 0x00, 0x52, 0x00, 0x6C, 0x03, 0x60, 0x04, 0xA0,
+  0x04, 0xB0, 0x03, 0x10, 0x00, 0x00,
+  /* '&' */
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0xB8, 0x04, 0xFC, 0x05, 0xC4, 0x03, 0x04, 0x07, 0x84,
+  0x04, 0x80, 0x00, 0x00, 0x00, 0x00,
+  /* ''' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x7C, 0x00, 0x0C,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '(' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xF8, 0x1E, 0x1E, 0x18, 0x06,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ')' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x1C, 0x0E, 0x0F, 0xF8, 0x03, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '*' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0xD8, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0xF8,
+  0x00, 0xD8, 0x00, 0x18, 0x00, 0x00,
+  /* '+' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x03, 0xF8, 0x00, 0x40, 0x00, 0x40,
+  0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+  /* ',' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '-' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+  /* '.' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '/' */
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0x00, 0x00,
+  /* '0' */
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x03, 0xFC, 0x06, 0x06, 0x04, 0x02, 0x06, 0x06, 0x03, 0xFC,
+  0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  /* '1' */
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0xFE, 0x07, 0xFE, 0x04, 0x00,
+  0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+  /* '2' */
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x18, 0x07, 0x1C, 0x05, 0x86, 0x04, 0xC2, 0x04, 0x62, 0x04, 0x3E,
+  0x04, 0x1C, 0x00, 0x00, 0x00, 0x00,
+  /* '3' */
+  0x00, 0x00, 0x02, 0x04, 0x06, 0x06, 0x04, 0x22, 0x04, 0x22, 0x04, 0x22, 0x04, 0x72, 0x07, 0xFE,
+  0x03, 0xCC, 0x00, 0x00, 0x00, 0x00,
+  /* '4' */
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0xE0, 0x05, 0x38, 0x05, 0x0E, 0x07, 0xFE, 0x07, 0xFE,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '5' */
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x7E, 0x04, 0x3E, 0x04, 0x22, 0x04, 0x22, 0x07, 0xE2,
+  0x03, 0xC2, 0x00, 0x00, 0x00, 0x00,
+  /* '6' */
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x03, 0xFC, 0x06, 0x4C, 0x04, 0x26, 0x04, 0x22, 0x07, 0xE2,
+  0x03, 0xC2, 0x00, 0x00, 0x00, 0x00,
+  /* '7' */
+  0x00, 0x00, 0x00, 0x06, 0x00, 0x02, 0x00, 0x02, 0x07, 0x02, 0x07, 0xF2, 0x00, 0xFE, 0x00, 0x0E,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '8' */
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xDC, 0x07, 0xFE, 0x04, 0x22, 0x04, 0x22, 0x04, 0x22, 0x07, 0xFE,
+  0x03, 0xDC, 0x00, 0x00, 0x00, 0x00,
+  /* '9' */
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x3C, 0x04, 0x7E, 0x04, 0x42, 0x06, 0x42, 0x03, 0x26, 0x03, 0xFC,
+  0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  /* ':' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x30, 0x06, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ';' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x06, 0x00, 0x02, 0x30, 0x00, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '<' */
+  0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0xA0, 0x00, 0xA0, 0x01, 0x10, 0x02, 0x08, 0x02, 0x08,
+  0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+  /* '=' */
+  0x00, 0x00, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
+  0x00, 0xA0, 0x00, 0xA0, 0x00, 0x00,
+  /* '>' */
+  0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x02, 0x08, 0x02, 0x08, 0x01, 0x10, 0x00, 0xA0, 0x00, 0xA0,
+  0x00, 0x40, 0x00, 0x40, 0x00, 0x00,
+  /* '?' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x1C, 0x05, 0x84, 0x05, 0xC4, 0x00, 0x44, 0x00, 0x7C,
+  0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
+  /* '@' */
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x04, 0x04, 0x08, 0xC2, 0x09, 0x22, 0x09, 0x22, 0x05, 0xFC,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'A' */
+  0x00, 0x00, 0x04, 0x00, 0x07, 0x04, 0x07, 0xE4, 0x04, 0xFC, 0x00, 0x8C, 0x00, 0x8C, 0x04, 0xFC,
+  0x07, 0xE0, 0x07, 0x00, 0x04, 0x00,
+  /* 'B' */
+  0x00, 0x00, 0x04, 0x04, 0x07, 0xFC, 0x07, 0xFC, 0x04, 0x44, 0x04, 0x44, 0x04, 0x44, 0x07, 0xFC,
+  0x03, 0xB8, 0x00, 0x00, 0x00, 0x00,
+  /* 'C' */
+  0x00, 0x00, 0x01, 0xF0, 0x03, 0xF8, 0x06, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x02, 0x08, 0x01, 0x1C, 0x00, 0x00,
+  /* 'D' */
+  0x00, 0x00, 0x04, 0x04, 0x07, 0xFC, 0x07, 0xFC, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x0C,
+  0x03, 0xF8, 0x01, 0xF0, 0x00, 0x00,
+  /* 'E' */
+  0x00, 0x00, 0x04, 0x04, 0x07, 0xFC, 0x07, 0xFC, 0x04, 0x44, 0x04, 0x44, 0x04, 0xE4, 0x04, 0x04,
+  0x07, 0x1C, 0x00, 0x00, 0x00, 0x00,
+  /* 'F' */
+  0x00, 0x00, 0x04, 0x04, 0x07, 0xFC, 0x07, 0xFC, 0x04, 0x44, 0x04, 0x44, 0x00, 0xE4, 0x00, 0x04,
+  0x00, 0x04, 0x00, 0x1C, 0x00, 0x00,
+  /* 'G' */
+  0x00, 0x00, 0x01, 0xF0, 0x03, 0xF8, 0x06, 0x0C, 0x04, 0x04, 0x04, 0x84, 0x04, 0x84, 0x07, 0x88,
+  0x03, 0x9C, 0x00, 0x80, 0x00, 0x00,
+  /* 'H' */
+  0x00, 0x00, 0x04, 0x04, 0x07, 0xFC, 0x07, 0xFC, 0x04, 0x44, 0x00, 0x40, 0x04, 0x44, 0x07, 0xFC,
+  0x07, 0xFC, 0x04, 0x04, 0x00, 0x00,
+  /* 'I' */
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0xFC, 0x07, 0xFC, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+  /* 'J' */
+  0x00, 0x00, 0x03, 0x80, 0x07, 0x80, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0xFC, 0x03, 0xFC,
+  0x00, 0x04, 0x00, 0x04, 0x00, 0x00,
+  /* 'K' */
+  0x00, 0x00, 0x04, 0x04, 0x07, 0xFC, 0x07, 0xFC, 0x04, 0xC4, 0x00, 0xE0, 0x01, 0xB4, 0x07, 0x1C,
+  0x06, 0x0C, 0x04, 0x04, 0x00, 0x00,
+  /* 'L' */
+  0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x07, 0xFC, 0x07, 0xFC, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00,
+  0x04, 0x00, 0x07, 0x80, 0x00, 0x00,
+  /* 'M' */
+  0x04, 0x04, 0x07, 0xFC, 0x07, 0xFC, 0x04, 0x30, 0x04, 0xE0, 0x01, 0x80, 0x04, 0xE0, 0x04, 0x30,
+  0x07, 0xFC, 0x07, 0xFC, 0x04, 0x04,
+  /* 'N' */
+  0x00, 0x00, 0x04, 0x04, 0x07, 0xFC, 0x07, 0xFC, 0x04, 0x30, 0x00, 0xE0, 0x01, 0x84, 0x07, 0xFC,
+  0x07, 0xFC, 0x00, 0x04, 0x00, 0x00,
+  /* 'O' */
+  0x00, 0x00, 0x01, 0xF0, 0x03, 0xF8, 0x06, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x0C,
+  0x03, 0xF8, 0x01, 0xF0, 0x00, 0x00,
+  /* 'P' */
+  0x00, 0x00, 0x04, 0x04, 0x07, 0xFC, 0x07, 0xFC, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x00, 0xFC,
+  0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
+  /* 'Q' */
+  0x00, 0x00, 0x01, 0xF0, 0x03, 0xF8, 0x16, 0x0C, 0x1C, 0x04, 0x1C, 0x04, 0x14, 0x04, 0x16, 0x0C,
+  0x1B, 0xF8, 0x09, 0xF0, 0x00, 0x00,
+  /* 'R' */
+  0x00, 0x00, 0x04, 0x04, 0x07, 0xFC, 0x07, 0xFC, 0x04, 0x44, 0x04, 0x44, 0x00, 0xC4, 0x03, 0xBC,
+  0x07, 0x38, 0x04, 0x00, 0x04, 0x00,
+  /* 'S' */
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x38, 0x07, 0x7C, 0x04, 0x64, 0x04, 0x44, 0x04, 0xC4, 0x07, 0xDC,
+  0x03, 0x9C, 0x00, 0x00, 0x00, 0x00,
+  /* 'T' */
+  0x00, 0x00, 0x00, 0x3C, 0x04, 0x04, 0x04, 0x04, 0x07, 0xFC, 0x07, 0xFC, 0x04, 0x04, 0x04, 0x04,
+  0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
+  /* 'U' */
+  0x00, 0x00, 0x00, 0x04, 0x03, 0xFC, 0x07, 0xFC, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x07, 0xFC,
+  0x03, 0xFC, 0x00, 0x04, 0x00, 0x00,
+  /* 'V' */
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x1C, 0x00, 0xFC, 0x07, 0xE4, 0x06, 0x00, 0x07, 0xE4, 0x00, 0xFC,
+  0x00, 0x1C, 0x00, 0x04, 0x00, 0x00,
+  /* 'W' */
+  0x00, 0x04, 0x00, 0x7C, 0x07, 0xFC, 0x07, 0x04, 0x03, 0xE4, 0x00, 0x70, 0x03, 0xE4, 0x07, 0x04,
+  0x07, 0xFC, 0x00, 0x7C, 0x00, 0x04,
+  /* 'X' */
+  0x00, 0x00, 0x04, 0x04, 0x06, 0x0C, 0x07, 0x1C, 0x05, 0xF4, 0x00, 0xE0, 0x05, 0xF4, 0x07, 0x1C,
+  0x06, 0x0C, 0x04, 0x04, 0x00, 0x00,
+  /* 'Y' */
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x0C, 0x04, 0x1C, 0x04, 0x34, 0x07, 0xE0, 0x07, 0xE0, 0x04, 0x34,
+  0x04, 0x1C, 0x00, 0x0C, 0x00, 0x04,
+  /* 'Z' */
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x1C, 0x07, 0x04, 0x05, 0x84, 0x04, 0xE4, 0x04, 0x34, 0x04, 0x1C,
+  0x07, 0x0C, 0x00, 0x00, 0x00, 0x00,
+  /* '[' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x1F, 0xFE, 0x10, 0x02,
+  0x10, 0x02, 0x00, 0x00, 0x00, 0x00,
+  /* '\\' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x80,
+  0x1E, 0x00, 0x18, 0x00, 0x00, 0x00,
+  /* ']' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x10, 0x02, 0x1F, 0xFE, 0x1F, 0xFE, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '^' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x08, 0x00, 0x06, 0x00, 0x01, 0x00, 0x06, 0x00, 0x08,
+  0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+  /* '_' */
+  0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
+  0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
+  /* '`' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'a' */
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x90, 0x04, 0x90, 0x04, 0x90, 0x02, 0x90, 0x07, 0xF0,
+  0x07, 0xE0, 0x04, 0x00, 0x00, 0x00,
+  /* 'b' */
+  0x00, 0x00, 0x04, 0x02, 0x07, 0xFE, 0x07, 0xFE, 0x02, 0x20, 0x04, 0x10, 0x04, 0x10, 0x06, 0x30,
+  0x03, 0xE0, 0x01, 0xC0, 0x00, 0x00,
+  /* 'c' */
+  0x00, 0x00, 0x01, 0xC0, 0x03, 0xE0, 0x06, 0x30, 0x04, 0x10, 0x04, 0x10, 0x04, 0x10, 0x06, 0x20,
+  0x03, 0x70, 0x00, 0x00, 0x00, 0x00,
+  /* 'd' */
+  0x00, 0x00, 0x01, 0xC0, 0x03, 0xE0, 0x06, 0x30, 0x04, 0x10, 0x04, 0x10, 0x02, 0x22, 0x07, 0xFE,
+  0x07, 0xFE, 0x04, 0x00, 0x00, 0x00,
+  /* 'e' */
+  0x00, 0x00, 0x01, 0xC0, 0x03, 0xE0, 0x06, 0xB0, 0x04, 0x90, 0x04, 0x90, 0x04, 0x90, 0x04, 0xB0,
+  0x06, 0xE0, 0x02, 0xC0, 0x00, 0x00,
+  /* 'f' */
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x04, 0x10, 0x07, 0xFC, 0x07, 0xFE, 0x04, 0x12, 0x04, 0x12,
+  0x04, 0x12, 0x00, 0x02, 0x00, 0x02,
+  /* 'g' */
+  0x00, 0x00, 0x01, 0xC0, 0x03, 0xE0, 0x26, 0x30, 0x24, 0x10, 0x24, 0x10, 0x22, 0x20, 0x3F, 0xF0,
+  0x1F, 0xF0, 0x00, 0x10, 0x00, 0x00,
+  /* 'h' */
+  0x00, 0x00, 0x04, 0x02, 0x07, 0xFE, 0x07, 0xFE, 0x04, 0x20, 0x00, 0x10, 0x04, 0x10, 0x07, 0xF0,
+  0x07, 0xE0, 0x04, 0x00, 0x00, 0x00,
+  /* 'i' */
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x10, 0x04, 0x10, 0x07, 0xF6, 0x07, 0xF6, 0x04, 0x00,
+  0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+  /* 'j' */
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x16, 0x3F, 0xF6, 0x1F, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'k' */
+  0x00, 0x00, 0x04, 0x02, 0x07, 0xFE, 0x07, 0xFE, 0x00, 0xC0, 0x05, 0xF0, 0x07, 0x30, 0x06, 0x10,
+  0x04, 0x10, 0x04, 0x00, 0x00, 0x00,
+  /* 'l' */
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x02, 0x04, 0x02, 0x07, 0xFE, 0x07, 0xFE, 0x04, 0x00,
+  0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+  /* 'm' */
+  0x00, 0x00, 0x04, 0x10, 0x07, 0xF0, 0x07, 0xF0, 0x00, 0x10, 0x07, 0xF0, 0x07, 0xF0, 0x00, 0x10,
+  0x07, 0xF0, 0x07, 0xE0, 0x04, 0x00,
+  /* 'n' */
+  0x00, 0x00, 0x04, 0x10, 0x07, 0xF0, 0x07, 0xF0, 0x04, 0x20, 0x00, 0x10, 0x04, 0x10, 0x07, 0xF0,
+  0x07, 0xE0, 0x04, 0x00, 0x00, 0x00,
+  /* 'o' */
+  0x00, 0x00, 0x01, 0xC0, 0x03, 0xE0, 0x06, 0x30, 0x04, 0x10, 0x04, 0x10, 0x04, 0x10, 0x06, 0x30,
+  0x03, 0xE0, 0x01, 0xC0, 0x00, 0x00,
+  /* 'p' */
+  0x00, 0x00, 0x20, 0x10, 0x3F, 0xF0, 0x3F, 0xF0, 0x22, 0x20, 0x24, 0x10, 0x04, 0x10, 0x06, 0x30,
+  0x03, 0xE0, 0x01, 0xC0, 0x00, 0x00,
+  /* 'q' */
+  0x00, 0x00, 0x01, 0xC0, 0x03, 0xE0, 0x06, 0x30, 0x04, 0x10, 0x24, 0x10, 0x22, 0x20, 0x3F, 0xF0,
+  0x3F, 0xF0, 0x20, 0x10, 0x00, 0x00,
+  /* 'r' */
+  0x00, 0x00, 0x04, 0x10, 0x04, 0x10, 0x07, 0xF0, 0x07, 0xF0, 0x04, 0x20, 0x04, 0x10, 0x04, 0x10,
+  0x00, 0x30, 0x00, 0x20, 0x00, 0x00,
+  /* 's' */
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x06, 0xF0, 0x04, 0xD0, 0x04, 0xD0, 0x05, 0x90, 0x07, 0xB0,
+  0x03, 0x30, 0x00, 0x00, 0x00, 0x00,
+  /* 't' */
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x03, 0xFE, 0x07, 0xFE, 0x04, 0x10, 0x04, 0x10, 0x04, 0x10,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'u' */
+  0x00, 0x00, 0x00, 0x10, 0x03, 0xF0, 0x07, 0xF0, 0x04, 0x00, 0x04, 0x00, 0x02, 0x10, 0x07, 0xF0,
+  0x07, 0xF0, 0x04, 0x00, 0x00, 0x00,
+  /* 'v' */
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x70, 0x01, 0xF0, 0x07, 0x90, 0x06, 0x00, 0x07, 0x90, 0x01, 0xF0,
+  0x00, 0x70, 0x00, 0x10, 0x00, 0x00,
+  /* 'w' */
+  0x00, 0x10, 0x00, 0xF0, 0x07, 0xF0, 0x07, 0x10, 0x03, 0x80, 0x00, 0xC0, 0x03, 0x80, 0x07, 0x10,
+  0x07, 0xF0, 0x00, 0xF0, 0x00, 0x10,
+  /* 'x' */
+  0x00, 0x00, 0x04, 0x10, 0x04, 0x10, 0x06, 0x30, 0x07, 0xF0, 0x01, 0xC0, 0x07, 0xF0, 0x06, 0x30,
+  0x04, 0x10, 0x04, 0x10, 0x00, 0x00,
+  /* 'y' */
+  0x00, 0x00, 0x00, 0x10, 0x20, 0x30, 0x20, 0xF0, 0x33, 0xD0, 0x3E, 0x00, 0x2F, 0x00, 0x03, 0xD0,
+  0x00, 0xF0, 0x00, 0x30, 0x00, 0x10,
+  /* 'z' */
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x30, 0x07, 0x10, 0x05, 0x90, 0x04, 0x90, 0x04, 0xD0, 0x04, 0x70,
+  0x06, 0x30, 0x00, 0x00, 0x00, 0x00,
+  /* '{' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0F, 0xFC, 0x1F, 0x7E, 0x10, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '|' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x1F, 0xFE, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '}' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x1F, 0x7E, 0x0F, 0xFC, 0x00, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '~' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00, 0x40, 0x00, 0x80, 0x00, 0x80,
+  0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+};
+
+sFONT Font16_Rotate90 = {
+  Font16_Rotate90_Table,
+  11, /* Width */
+  16, /* Height */
+  ROTATE_90,
+  &Font16,
+};
+
+static const uint8_t Font16_Rotate180_Table[] PROGMEM = {
+  /* ' ' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '!' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00,
+  /* '"' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x77, 0x00, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '#' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x1B, 0x00, 0x1B, 0x00, 0x1B, 0x00,
+  0x7F, 0x80, 0x1B, 0x00, 0x7F, 0x80, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x00, 0x00,
+  /* '$' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x1F, 0x80, 0x31, 0x80, 0x31, 0x80,
+  0x38, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x31, 0x80, 0x31, 0x80, 0x3F, 0x00, 0x04, 0x00,
+  /* '%' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x48, 0x00, 0x48, 0x00,
+  0x31, 0x80, 0x0F, 0x00, 0x3C, 0x00, 0x63, 0x00, 0x04, 0x80, 0x04, 0x80, 0x03, 0x00, 0x00, 0x00,
+  /* '&' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x19, 0x80, 0x1D, 0x80,
+  0x37, 0x00, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ''' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '(' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x0E, 0x00, 0x06, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00,
+  /* ')' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x0C, 0x00,
+  0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00,
+  /* '*' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x33, 0x00, 0x3F, 0x00, 0x1E, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00,
+  /* '+' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00,
+  0x04, 0x00, 0x3F, 0x80, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ',' */
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x06, 0x00, 0x04, 0x00, 0x0C, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '-' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '.' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '/' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0x80, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00,
+  0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30, 0x00, 0x60, 0x00, 0x60, 0x00,
+  /* '0' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x1B, 0x00, 0x31, 0x80,
+  0x31, 0x80, 0x31, 0x80, 0x31, 0x80, 0x31, 0x80, 0x31, 0x80, 0x1B, 0x00, 0x0E, 0x00, 0x00, 0x00,
+  /* '1' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x0C, 0x00, 0x0C, 0x00,
+  0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0F, 0x80, 0x0C, 0x00, 0x00, 0x00,
+  /* '2' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x01, 0x80, 0x03, 0x00,
+  0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x31, 0x80, 0x31, 0x80, 0x33, 0x00, 0x1E, 0x00, 0x00, 0x00,
+  /* '3' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x30, 0xC0, 0x30, 0x00,
+  0x30, 0x00, 0x38, 0x00, 0x1F, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30, 0xC0, 0x1F, 0x80, 0x00, 0x00,
+  /* '4' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x18, 0x00, 0x3F, 0x80,
+  0x19, 0x80, 0x19, 0x00, 0x1B, 0x00, 0x1A, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x00, 0x00,
+  /* '5' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x30, 0x80, 0x30, 0x00,
+  0x30, 0x00, 0x31, 0x00, 0x1F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x3F, 0x00, 0x00, 0x00,
+  /* '6' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x33, 0x00, 0x31, 0x80,
+  0x31, 0x80, 0x33, 0x80, 0x1D, 0x80, 0x01, 0x80, 0x03, 0x00, 0x07, 0x00, 0x3C, 0x00, 0x00, 0x00,
+  /* '7' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+  0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x18, 0x40, 0x1F, 0xC0, 0x00, 0x00,
+  /* '8' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x31, 0x80, 0x31, 0x80,
+  0x31, 0x80, 0x31, 0x80, 0x1F, 0x00, 0x31, 0x80, 0x31, 0x80, 0x31, 0x80, 0x1F, 0x00, 0x00, 0x00,
+  /* '9' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x1C, 0x00, 0x18, 0x00,
+  0x30, 0x00, 0x37, 0x00, 0x39, 0x80, 0x31, 0x80, 0x31, 0x80, 0x19, 0x80, 0x0F, 0x00, 0x00, 0x00,
+  /* ':' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ';' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x0C, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '<' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x18, 0x00, 0x04, 0x00,
+  0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x04, 0x00, 0x18, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '=' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '>' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x04, 0x00,
+  0x18, 0x00, 0x60, 0x00, 0x18, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* '?' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x06, 0x00, 0x1C, 0x00, 0x30, 0x00, 0x31, 0x80, 0x31, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '@' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x11, 0x00, 0x00, 0x80, 0x1C, 0x80,
+  0x12, 0x80, 0x12, 0x80, 0x1C, 0x80, 0x10, 0x80, 0x10, 0x80, 0x11, 0x00, 0x0E, 0x00, 0x00, 0x00,
+  /* 'A' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xC0, 0x61, 0x80, 0x61, 0x80,
+  0x3F, 0x00, 0x33, 0x00, 0x33, 0x00, 0x12, 0x00, 0x1E, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
+  /* 'B' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x31, 0x80, 0x31, 0x80,
+  0x31, 0x80, 0x1F, 0x80, 0x31, 0x80, 0x31, 0x80, 0x31, 0x80, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* 'C' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x21, 0x80, 0x40, 0xC0,
+  0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x40, 0xC0, 0x61, 0x80, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'D' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x31, 0x80, 0x61, 0x80,
+  0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x31, 0x80, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* 'E' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x21, 0x80, 0x21, 0x80,
+  0x09, 0x80, 0x0F, 0x80, 0x09, 0x80, 0x21, 0x80, 0x21, 0x80, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* 'F' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x01, 0x80, 0x01, 0x80,
+  0x09, 0x80, 0x0F, 0x80, 0x09, 0x80, 0x41, 0x80, 0x41, 0x80, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* 'G' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x31, 0x80, 0x30, 0xC0,
+  0x7C, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x20, 0xC0, 0x31, 0x80, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'H' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xC0, 0x31, 0x80, 0x31, 0x80,
+  0x31, 0x80, 0x3F, 0x80, 0x31, 0x80, 0x31, 0x80, 0x31, 0x80, 0x7B, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* 'I' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x0C, 0x00, 0x0C, 0x00,
+  0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
+  /* 'J' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x18, 0xC0, 0x18, 0xC0,
+  0x18, 0xC0, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'K' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xC0, 0x31, 0x80, 0x19, 0x80,
+  0x0F, 0x80, 0x07, 0x80, 0x0D, 0x80, 0x19, 0x80, 0x31, 0x80, 0x7B, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* 'L' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x43, 0x00, 0x43, 0x00,
+  0x43, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* 'M' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xE0, 0x60, 0xC0, 0x64, 0xC0,
+  0x6E, 0xC0, 0x6A, 0xC0, 0x7B, 0xC0, 0x71, 0xC0, 0x60, 0xC0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  /* 'N' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xC0, 0x31, 0x80, 0x39, 0x80,
+  0x3D, 0x80, 0x35, 0x80, 0x37, 0x80, 0x33, 0x80, 0x31, 0x80, 0x79, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* 'O' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x31, 0x80, 0x60, 0xC0,
+  0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x31, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'P' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0x80, 0x01, 0x80,
+  0x1F, 0x80, 0x31, 0x80, 0x31, 0x80, 0x31, 0x80, 0x31, 0x80, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* 'Q' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x66, 0x00, 0x1F, 0x00, 0x31, 0x80, 0x60, 0xC0,
+  0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x31, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'R' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0xC0, 0x31, 0x80, 0x31, 0x80,
+  0x19, 0x80, 0x0F, 0x80, 0x31, 0x80, 0x31, 0x80, 0x31, 0x80, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* 'S' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x31, 0x80, 0x31, 0x80,
+  0x38, 0x00, 0x1F, 0x00, 0x03, 0x80, 0x31, 0x80, 0x31, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'T' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x06, 0x00, 0x06, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x26, 0x40, 0x26, 0x40, 0x26, 0x40, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* 'U' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x31, 0x80, 0x31, 0x80,
+  0x31, 0x80, 0x31, 0x80, 0x31, 0x80, 0x31, 0x80, 0x31, 0x80, 0x7B, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* 'V' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0A, 0x00,
+  0x1B, 0x00, 0x1B, 0x00, 0x1B, 0x00, 0x31, 0x80, 0x31, 0x80, 0x7B, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* 'W' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x80, 0x3B, 0x80, 0x3B, 0x80,
+  0x2A, 0x80, 0x6E, 0xC0, 0x6E, 0xC0, 0x64, 0xC0, 0x60, 0xC0, 0xFB, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  /* 'X' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xC0, 0x31, 0x80, 0x1B, 0x00,
+  0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1B, 0x00, 0x31, 0x80, 0x7B, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* 'Y' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0C, 0x00, 0x0C, 0x00,
+  0x0C, 0x00, 0x0C, 0x00, 0x1E, 0x00, 0x33, 0x00, 0x61, 0x80, 0xF3, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* 'Z' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x21, 0x80, 0x23, 0x00,
+  0x06, 0x00, 0x04, 0x00, 0x0C, 0x00, 0x18, 0x80, 0x30, 0x80, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00,
+  /* '[' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00,
+  0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x3C, 0x00, 0x00, 0x00,
+  /* '\\' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x30, 0x00, 0x30, 0x00, 0x18, 0x00,
+  0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x80, 0x01, 0x80,
+  /* ']' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00,
+  0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0F, 0x00, 0x00, 0x00,
+  /* '^' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x80, 0x20, 0x80, 0x11, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x04, 0x00,
+  /* '_' */
+  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '`' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x02, 0x00,
+  /* 'a' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x00, 0x39, 0x80, 0x31, 0x80,
+  0x3F, 0x00, 0x30, 0x00, 0x30, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'b' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xC0, 0x33, 0x80, 0x61, 0x80,
+  0x61, 0x80, 0x61, 0x80, 0x33, 0x80, 0x1D, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x00, 0x00,
+  /* 'c' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x31, 0x80, 0x20, 0xC0,
+  0x00, 0xC0, 0x20, 0xC0, 0x31, 0x80, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'd' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x00, 0x39, 0x80, 0x30, 0xC0,
+  0x30, 0xC0, 0x30, 0xC0, 0x39, 0x80, 0x37, 0x00, 0x30, 0x00, 0x30, 0x00, 0x38, 0x00, 0x00, 0x00,
+  /* 'e' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x61, 0x80, 0x00, 0xC0,
+  0x7F, 0xC0, 0x60, 0xC0, 0x31, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'f' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x06, 0x00, 0x06, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x3F, 0x80, 0x06, 0x00, 0x06, 0x00, 0xFC, 0x00, 0x00, 0x00,
+  /* 'g' */
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x30, 0x00, 0x30, 0x00, 0x37, 0x00, 0x39, 0x80, 0x30, 0xC0,
+  0x30, 0xC0, 0x30, 0xC0, 0x39, 0x80, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'h' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xC0, 0x31, 0x80, 0x31, 0x80,
+  0x31, 0x80, 0x31, 0x80, 0x33, 0x80, 0x1D, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x00, 0x00,
+  /* 'i' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x0C, 0x00, 0x0C, 0x00,
+  0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00,
+  /* 'j' */
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,
+  0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00,
+  /* 'k' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xC0, 0x19, 0x80, 0x0D, 0x80,
+  0x07, 0x80, 0x07, 0x80, 0x0D, 0x80, 0x3D, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x00, 0x00,
+  /* 'l' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x0C, 0x00, 0x0C, 0x00,
+  0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0F, 0x00, 0x00, 0x00,
+  /* 'm' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xED, 0xC0, 0x6D, 0x80, 0x6D, 0x80,
+  0x6D, 0x80, 0x6D, 0x80, 0x6D, 0x80, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'n' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xC0, 0x31, 0x80, 0x31, 0x80,
+  0x31, 0x80, 0x31, 0x80, 0x33, 0x80, 0x1D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'o' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x31, 0x80, 0x60, 0xC0,
+  0x60, 0xC0, 0x60, 0xC0, 0x31, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'p' */
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x1D, 0x80, 0x33, 0x80, 0x61, 0x80,
+  0x61, 0x80, 0x61, 0x80, 0x33, 0x80, 0x1D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'q' */
+  0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x30, 0x00, 0x30, 0x00, 0x37, 0x00, 0x39, 0x80, 0x30, 0xC0,
+  0x30, 0xC0, 0x30, 0xC0, 0x39, 0x80, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'r' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x03, 0x00, 0x67, 0x00, 0x3B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 's' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x31, 0x80, 0x38, 0x00,
+  0x1F, 0x00, 0x07, 0x80, 0x31, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 't' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x23, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x1F, 0xC0, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00,
+  /* 'u' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x00, 0x39, 0x80, 0x31, 0x80,
+  0x31, 0x80, 0x31, 0x80, 0x31, 0x80, 0x39, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'v' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1B, 0x00,
+  0x1B, 0x00, 0x31, 0x80, 0x31, 0x80, 0x7B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'w' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x80, 0x3B, 0x80, 0x3B, 0x80,
+  0x6E, 0xC0, 0x64, 0xC0, 0x60, 0xC0, 0xF1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'x' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xC0, 0x1B, 0x00, 0x0E, 0x00,
+  0x0E, 0x00, 0x0E, 0x00, 0x1B, 0x00, 0x7B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'y' */
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x06, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x1E, 0x00, 0x1A, 0x00,
+  0x33, 0x00, 0x33, 0x00, 0x61, 0x80, 0xF3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'z' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x21, 0x80, 0x03, 0x00,
+  0x0E, 0x00, 0x18, 0x00, 0x30, 0x80, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '{' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+  0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x00, 0x00,
+  /* '|' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00,
+  0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00,
+  /* '}' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00,
+  0x18, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x00, 0x00,
+  /* '~' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x24, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+sFONT Font16_Rotate180 = {
+  Font16_Rotate180_Table,
+  11, /* Width */
+  16, /* Height */
+  ROTATE_180,
+  &Font16,
+};
+
+static const uint8_t Font16_Rotate270_Table[] PROGMEM = {
+  /* ' ' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '!' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xA0, 0x7F, 0xA0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '"' */
+  0x00, 0x00, 0x30, 0x00, 0x3E, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x3E, 0x00, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '#' */
+  0x00, 0x00, 0x05, 0x00, 0x7D, 0x00, 0x7F, 0xF0, 0x07, 0xF0, 0x7D, 0x00, 0x7F, 0xF0, 0x07, 0xF0,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '$' */
+  0x00, 0x00, 0x00, 0x00, 0x71, 0xC0, 0x73, 0xE0, 0x47, 0x20, 0xC6, 0x38, 0x4E, 0x20, 0x7C, 0xE0,
+  0x38, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  /* '%' */
+  0x00, 0x00, 0x08, 0xC0, 0x0D, 0x20, 0x05, 0x20, 0x06, 0xC0, 0x36, 0x00, 0x4A, 0x00, 0x4B, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '&' */
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x21, 0xE0, 0x20, 0xC0, 0x23, 0xA0, 0x3F, 0x20, 0x1D, 0xE0,
+  0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* ''' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x3E, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '(' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x78, 0x78, 0x1F, 0xE0, 0x0F, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ')' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xF0, 0x70, 0x38, 0x60, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '*' */
+  0x00, 0x00, 0x18, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x1F, 0x00, 0x1B, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '+' */
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x1F, 0xC0, 0x02, 0x00, 0x02, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ',' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '-' */
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '.' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '/' */
+  0x00, 0x00, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x01, 0xE0, 0x00, 0x78,
+  0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
+  /* '0' */
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xC0, 0x60, 0x60, 0x40, 0x20, 0x60, 0x60, 0x3F, 0xC0,
+  0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
+  /* '1' */
+  0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x7F, 0xE0, 0x7F, 0xE0, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+  /* '2' */
+  0x00, 0x00, 0x00, 0x00, 0x38, 0x20, 0x7C, 0x20, 0x46, 0x20, 0x43, 0x20, 0x61, 0xA0, 0x38, 0xE0,
+  0x18, 0x60, 0x00, 0x00, 0x00, 0x00,
+  /* '3' */
+  0x00, 0x00, 0x00, 0x00, 0x33, 0xC0, 0x7F, 0xE0, 0x4E, 0x20, 0x44, 0x20, 0x44, 0x20, 0x44, 0x20,
+  0x60, 0x60, 0x20, 0x40, 0x00, 0x00,
+  /* '4' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x7F, 0xE0, 0x7F, 0xE0, 0x70, 0xA0, 0x1C, 0xA0, 0x07, 0x80,
+  0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
+  /* '5' */
+  0x00, 0x00, 0x00, 0x00, 0x43, 0xC0, 0x47, 0xE0, 0x44, 0x20, 0x44, 0x20, 0x7C, 0x20, 0x7E, 0x20,
+  0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+  /* '6' */
+  0x00, 0x00, 0x00, 0x00, 0x43, 0xC0, 0x47, 0xE0, 0x44, 0x20, 0x64, 0x20, 0x32, 0x60, 0x3F, 0xC0,
+  0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
+  /* '7' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x7F, 0x00, 0x4F, 0xE0, 0x40, 0xE0, 0x40, 0x00,
+  0x40, 0x00, 0x60, 0x00, 0x00, 0x00,
+  /* '8' */
+  0x00, 0x00, 0x00, 0x00, 0x3B, 0xC0, 0x7F, 0xE0, 0x44, 0x20, 0x44, 0x20, 0x44, 0x20, 0x7F, 0xE0,
+  0x3B, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* '9' */
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x3F, 0xC0, 0x64, 0xC0, 0x42, 0x60, 0x42, 0x20, 0x7E, 0x20,
+  0x3C, 0x20, 0x00, 0x00, 0x00, 0x00,
+  /* ':' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x60, 0x0C, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ';' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x40, 0x00, 0x60, 0x00, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '<' */
+  0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x10, 0x40, 0x10, 0x40, 0x08, 0x80, 0x05, 0x00, 0x05, 0x00,
+  0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+  /* '=' */
+  0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00,
+  0x05, 0x00, 0x05, 0x00, 0x00, 0x00,
+  /* '>' */
+  0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x05, 0x00, 0x05, 0x00, 0x08, 0x80, 0x10, 0x40, 0x10, 0x40,
+  0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
+  /* '?' */
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x3E, 0x00, 0x22, 0x00, 0x23, 0xA0, 0x21, 0xA0, 0x38, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '@' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xA0, 0x44, 0x90, 0x44, 0x90, 0x43, 0x10, 0x20, 0x20,
+  0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* 'A' */
+  0x00, 0x20, 0x00, 0xE0, 0x07, 0xE0, 0x3F, 0x20, 0x31, 0x00, 0x31, 0x00, 0x3F, 0x20, 0x27, 0xE0,
+  0x20, 0xE0, 0x00, 0x20, 0x00, 0x00,
+  /* 'B' */
+  0x00, 0x00, 0x00, 0x00, 0x1D, 0xC0, 0x3F, 0xE0, 0x22, 0x20, 0x22, 0x20, 0x22, 0x20, 0x3F, 0xE0,
+  0x3F, 0xE0, 0x20, 0x20, 0x00, 0x00,
+  /* 'C' */
+  0x00, 0x00, 0x38, 0x80, 0x10, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x60,
+  0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00,
+  /* 'D' */
+  0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x30, 0x60, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3F, 0xE0,
+  0x3F, 0xE0, 0x20, 0x20, 0x00, 0x00,
+  /* 'E' */
+  0x00, 0x00, 0x00, 0x00, 0x38, 0xE0, 0x20, 0x20, 0x27, 0x20, 0x22, 0x20, 0x22, 0x20, 0x3F, 0xE0,
+  0x3F, 0xE0, 0x20, 0x20, 0x00, 0x00,
+  /* 'F' */
+  0x00, 0x00, 0x38, 0x00, 0x20, 0x00, 0x20, 0x00, 0x27, 0x00, 0x22, 0x20, 0x22, 0x20, 0x3F, 0xE0,
+  0x3F, 0xE0, 0x20, 0x20, 0x00, 0x00,
+  /* 'G' */
+  0x00, 0x00, 0x01, 0x00, 0x39, 0xC0, 0x11, 0xE0, 0x21, 0x20, 0x21, 0x20, 0x20, 0x20, 0x30, 0x60,
+  0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00,
+  /* 'H' */
+  0x00, 0x00, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x22, 0x20, 0x02, 0x00, 0x22, 0x20, 0x3F, 0xE0,
+  0x3F, 0xE0, 0x20, 0x20, 0x00, 0x00,
+  /* 'I' */
+  0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+  /* 'J' */
+  0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x01, 0xE0, 0x01, 0xC0, 0x00, 0x00,
+  /* 'K' */
+  0x00, 0x00, 0x20, 0x20, 0x30, 0x60, 0x38, 0xE0, 0x2D, 0x80, 0x07, 0x00, 0x23, 0x20, 0x3F, 0xE0,
+  0x3F, 0xE0, 0x20, 0x20, 0x00, 0x00,
+  /* 'L' */
+  0x00, 0x00, 0x01, 0xE0, 0x00, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0,
+  0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
+  /* 'M' */
+  0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x0C, 0x20, 0x07, 0x20, 0x01, 0x80, 0x07, 0x20, 0x0C, 0x20,
+  0x3F, 0xE0, 0x3F, 0xE0, 0x20, 0x20,
+  /* 'N' */
+  0x00, 0x00, 0x20, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x21, 0x80, 0x07, 0x00, 0x0C, 0x20, 0x3F, 0xE0,
+  0x3F, 0xE0, 0x20, 0x20, 0x00, 0x00,
+  /* 'O' */
+  0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x30, 0x60, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x60,
+  0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00,
+  /* 'P' */
+  0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x3F, 0x00, 0x21, 0x20, 0x21, 0x20, 0x21, 0x20, 0x3F, 0xE0,
+  0x3F, 0xE0, 0x20, 0x20, 0x00, 0x00,
+  /* 'Q' */
+  0x00, 0x00, 0x0F, 0x90, 0x1F, 0xD8, 0x30, 0x68, 0x20, 0x28, 0x20, 0x38, 0x20, 0x38, 0x30, 0x68,
+  0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00,
+  /* 'R' */
+  0x00, 0x20, 0x00, 0x20, 0x1C, 0xE0, 0x3D, 0xC0, 0x23, 0x00, 0x22, 0x20, 0x22, 0x20, 0x3F, 0xE0,
+  0x3F, 0xE0, 0x20, 0x20, 0x00, 0x00,
+  /* 'S' */
+  0x00, 0x00, 0x00, 0x00, 0x39, 0xC0, 0x3B, 0xE0, 0x23, 0x20, 0x22, 0x20, 0x26, 0x20, 0x3E, 0xE0,
+  0x1C, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  /* 'T' */
+  0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x20, 0x20, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x20, 0x20,
+  0x20, 0x20, 0x3C, 0x00, 0x00, 0x00,
+  /* 'U' */
+  0x00, 0x00, 0x20, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x3F, 0xE0,
+  0x3F, 0xC0, 0x20, 0x00, 0x00, 0x00,
+  /* 'V' */
+  0x00, 0x00, 0x20, 0x00, 0x38, 0x00, 0x3F, 0x00, 0x27, 0xE0, 0x00, 0x60, 0x27, 0xE0, 0x3F, 0x00,
+  0x38, 0x00, 0x20, 0x00, 0x00, 0x00,
+  /* 'W' */
+  0x20, 0x00, 0x3E, 0x00, 0x3F, 0xE0, 0x20, 0xE0, 0x27, 0xC0, 0x0E, 0x00, 0x27, 0xC0, 0x20, 0xE0,
+  0x3F, 0xE0, 0x3E, 0x00, 0x20, 0x00,
+  /* 'X' */
+  0x00, 0x00, 0x20, 0x20, 0x30, 0x60, 0x38, 0xE0, 0x2F, 0xA0, 0x07, 0x00, 0x2F, 0xA0, 0x38, 0xE0,
+  0x30, 0x60, 0x20, 0x20, 0x00, 0x00,
+  /* 'Y' */
+  0x20, 0x00, 0x30, 0x00, 0x38, 0x20, 0x2C, 0x20, 0x07, 0xE0, 0x07, 0xE0, 0x2C, 0x20, 0x38, 0x20,
+  0x30, 0x00, 0x20, 0x00, 0x00, 0x00,
+  /* 'Z' */
+  0x00, 0x00, 0x00, 0x00, 0x30, 0xE0, 0x38, 0x20, 0x2C, 0x20, 0x27, 0x20, 0x21, 0xA0, 0x20, 0xE0,
+  0x38, 0x60, 0x00, 0x00, 0x00, 0x00,
+  /* '[' */
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x40, 0x08, 0x7F, 0xF8, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '\\' */
+  0x00, 0x00, 0x00, 0x18, 0x00, 0x78, 0x01, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x3C, 0x00, 0xF0, 0x00,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ']' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x7F, 0xF8, 0x40, 0x08, 0x40, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '^' */
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x10, 0x00, 0x60, 0x00, 0x80, 0x00, 0x60, 0x00, 0x10, 0x00,
+  0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '_' */
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  /* '`' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'a' */
+  0x00, 0x00, 0x00, 0x20, 0x07, 0xE0, 0x0F, 0xE0, 0x09, 0x40, 0x09, 0x20, 0x09, 0x20, 0x09, 0xE0,
+  0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* 'b' */
+  0x00, 0x00, 0x03, 0x80, 0x07, 0xC0, 0x0C, 0x60, 0x08, 0x20, 0x08, 0x20, 0x04, 0x40, 0x7F, 0xE0,
+  0x7F, 0xE0, 0x40, 0x20, 0x00, 0x00,
+  /* 'c' */
+  0x00, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x04, 0x60, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x0C, 0x60,
+  0x07, 0xC0, 0x03, 0x80, 0x00, 0x00,
+  /* 'd' */
+  0x00, 0x00, 0x00, 0x20, 0x7F, 0xE0, 0x7F, 0xE0, 0x44, 0x40, 0x08, 0x20, 0x08, 0x20, 0x0C, 0x60,
+  0x07, 0xC0, 0x03, 0x80, 0x00, 0x00,
+  /* 'e' */
+  0x00, 0x00, 0x03, 0x40, 0x07, 0x60, 0x0D, 0x20, 0x09, 0x20, 0x09, 0x20, 0x09, 0x20, 0x0D, 0x60,
+  0x07, 0xC0, 0x03, 0x80, 0x00, 0x00,
+  /* 'f' */
+  0x40, 0x00, 0x40, 0x00, 0x48, 0x20, 0x48, 0x20, 0x48, 0x20, 0x7F, 0xE0, 0x3F, 0xE0, 0x08, 0x20,
+  0x08, 0x20, 0x00, 0x00, 0x00, 0x00,
+  /* 'g' */
+  0x00, 0x00, 0x08, 0x00, 0x0F, 0xF8, 0x0F, 0xFC, 0x04, 0x44, 0x08, 0x24, 0x08, 0x24, 0x0C, 0x64,
+  0x07, 0xC0, 0x03, 0x80, 0x00, 0x00,
+  /* 'h' */
+  0x00, 0x00, 0x00, 0x20, 0x07, 0xE0, 0x0F, 0xE0, 0x08, 0x20, 0x08, 0x00, 0x04, 0x20, 0x7F, 0xE0,
+  0x7F, 0xE0, 0x40, 0x20, 0x00, 0x00,
+  /* 'i' */
+  0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x6F, 0xE0, 0x6F, 0xE0, 0x08, 0x20, 0x08, 0x20,
+  0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+  /* 'j' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x6F, 0xFC, 0x68, 0x04, 0x08, 0x04, 0x08, 0x04,
+  0x08, 0x04, 0x00, 0x00, 0x00, 0x00,
+  /* 'k' */
+  0x00, 0x00, 0x00, 0x20, 0x08, 0x20, 0x08, 0x60, 0x0C, 0xE0, 0x0F, 0xA0, 0x03, 0x00, 0x7F, 0xE0,
+  0x7F, 0xE0, 0x40, 0x20, 0x00, 0x00,
+  /* 'l' */
+  0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x7F, 0xE0, 0x7F, 0xE0, 0x40, 0x20, 0x40, 0x20,
+  0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+  /* 'm' */
+  0x00, 0x20, 0x07, 0xE0, 0x0F, 0xE0, 0x08, 0x00, 0x0F, 0xE0, 0x0F, 0xE0, 0x08, 0x00, 0x0F, 0xE0,
+  0x0F, 0xE0, 0x08, 0x20, 0x00, 0x00,
+  /* 'n' */
+  0x00, 0x00, 0x00, 0x20, 0x07, 0xE0, 0x0F, 0xE0, 0x08, 0x20, 0x08, 0x00, 0x04, 0x20, 0x0F, 0xE0,
+  0x0F, 0xE0, 0x08, 0x20, 0x00, 0x00,
+  /* 'o' */
+  0x00, 0x00, 0x03, 0x80, 0x07, 0xC0, 0x0C, 0x60, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x0C, 0x60,
+  0x07, 0xC0, 0x03, 0x80, 0x00, 0x00,
+  /* 'p' */
+  0x00, 0x00, 0x03, 0x80, 0x07, 0xC0, 0x0C, 0x60, 0x08, 0x20, 0x08, 0x24, 0x04, 0x44, 0x0F, 0xFC,
+  0x0F, 0xFC, 0x08, 0x04, 0x00, 0x00,
+  /* 'q' */
+  0x00, 0x00, 0x08, 0x04, 0x0F, 0xFC, 0x0F, 0xFC, 0x04, 0x44, 0x08, 0x24, 0x08, 0x20, 0x0C, 0x60,
+  0x07, 0xC0, 0x03, 0x80, 0x00, 0x00,
+  /* 'r' */
+  0x00, 0x00, 0x04, 0x00, 0x0C, 0x00, 0x08, 0x20, 0x08, 0x20, 0x04, 0x20, 0x0F, 0xE0, 0x0F, 0xE0,
+  0x08, 0x20, 0x08, 0x20, 0x00, 0x00,
+  /* 's' */
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0xC0, 0x0D, 0xE0, 0x09, 0xA0, 0x0B, 0x20, 0x0B, 0x20, 0x0F, 0x60,
+  0x06, 0x60, 0x00, 0x00, 0x00, 0x00,
+  /* 't' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x7F, 0xE0, 0x7F, 0xC0,
+  0x08, 0x00, 0x08, 0x00, 0x00, 0x00,
+  /* 'u' */
+  0x00, 0x00, 0x00, 0x20, 0x0F, 0xE0, 0x0F, 0xE0, 0x08, 0x40, 0x00, 0x20, 0x00, 0x20, 0x0F, 0xE0,
+  0x0F, 0xC0, 0x08, 0x00, 0x00, 0x00,
+  /* 'v' */
+  0x00, 0x00, 0x08, 0x00, 0x0E, 0x00, 0x0F, 0x80, 0x09, 0xE0, 0x00, 0x60, 0x09, 0xE0, 0x0F, 0x80,
+  0x0E, 0x00, 0x08, 0x00, 0x00, 0x00,
+  /* 'w' */
+  0x08, 0x00, 0x0F, 0x00, 0x0F, 0xE0, 0x08, 0xE0, 0x01, 0xC0, 0x03, 0x00, 0x01, 0xC0, 0x08, 0xE0,
+  0x0F, 0xE0, 0x0F, 0x00, 0x08, 0x00,
+  /* 'x' */
+  0x00, 0x00, 0x08, 0x20, 0x08, 0x20, 0x0C, 0x60, 0x0F, 0xE0, 0x03, 0x80, 0x0F, 0xE0, 0x0C, 0x60,
+  0x08, 0x20, 0x08, 0x20, 0x00, 0x00,
+  /* 'y' */
+  0x08, 0x00, 0x0C, 0x00, 0x0F, 0x00, 0x0B, 0xC0, 0x00, 0xF4, 0x00, 0x7C, 0x0B, 0xCC, 0x0F, 0x04,
+  0x0C, 0x04, 0x08, 0x00, 0x00, 0x00,
+  /* 'z' */
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x60, 0x0E, 0x20, 0x0B, 0x20, 0x09, 0x20, 0x09, 0xA0, 0x08, 0xE0,
+  0x0C, 0x60, 0x00, 0x00, 0x00, 0x00,
+  /* '{' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x7E, 0xF8, 0x3F, 0xF0, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '|' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '}' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3F, 0xF0, 0x7E, 0xF8, 0x40, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '~' */
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x04, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+sFONT Font16_Rotate270 = {
+  Font16_Rotate270_Table,
+  11, /* Width */
+  16, /* Height */
+  ROTATE_270,
+  &Font16,
+};
+
+static const uint8_t Font20_Rotate90_Table[] PROGMEM = {
+  /* ' ' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '!' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x0F, 0xE0, 0x03, 0x3F, 0xE0, 0x03, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '"' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x0F, 0xC0, 0x00,
+  0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x01,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '#' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x0F, 0xFF, 0xF0, 0x0F,
+  0xFF, 0xF0, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x00, 0x66,
+  0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '$' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE7, 0x00, 0x01, 0xEF, 0x80, 0x01,
+  0x8C, 0xC0, 0x0F, 0x8C, 0xF0, 0x0F, 0x8C, 0xF0, 0x01, 0x98, 0xC0, 0x00, 0xF9, 0xC0, 0x00, 0x71,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '%' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xC0, 0x00, 0x32, 0x20, 0x00, 0x1A, 0x20, 0x00,
+  0x1A, 0x20, 0x01, 0xC9, 0xC0, 0x02, 0x2C, 0x00, 0x02, 0x2C, 0x00, 0x02, 0x26, 0x00, 0x01, 0xC6,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '&' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xF7, 0x00, 0x03,
+  0x3F, 0x00, 0x03, 0x39, 0x80, 0x03, 0x71, 0x80, 0x03, 0xE1, 0x80, 0x01, 0xE1, 0x80, 0x03, 0x71,
+  0x80, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ''' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '(' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xFF, 0x80, 0x1F, 0x03, 0xE0, 0x18, 0x00, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ')' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x60, 0x1F,
+  0x03, 0xE0, 0x07, 0xFF, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '*' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x33, 0x00, 0x00,
+  0x3E, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x3E, 0x00, 0x00, 0x33, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '+' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
+  0x18, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ',' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C,
+  0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '-' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '.' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '/' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03,
+  0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '0' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xC0, 0x03, 0x80, 0xE0, 0x03,
+  0x00, 0x60, 0x03, 0x00, 0x60, 0x03, 0x00, 0x60, 0x03, 0x80, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0x7F,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '1' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x03, 0x00, 0xC0, 0x03,
+  0x00, 0xC0, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '2' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x80, 0x03, 0x81, 0xC0, 0x03, 0xC0, 0xE0, 0x03,
+  0x60, 0x60, 0x03, 0x30, 0x60, 0x03, 0x18, 0x60, 0x03, 0x0C, 0xE0, 0x03, 0x07, 0xC0, 0x03, 0x03,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '3' */
+  0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x03, 0x80, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0x00, 0x60, 0x03,
+  0x0C, 0x60, 0x03, 0x0C, 0x60, 0x03, 0x0C, 0x60, 0x03, 0x9E, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0xF3,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '4' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x78, 0x00, 0x00, 0x6E, 0x00, 0x00,
+  0x67, 0x00, 0x03, 0x61, 0xC0, 0x03, 0x60, 0xE0, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x03, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '5' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x03, 0x8F, 0xE0, 0x03, 0x0F, 0xE0, 0x03,
+  0x06, 0x60, 0x03, 0x06, 0x60, 0x03, 0x06, 0x60, 0x03, 0x8E, 0x60, 0x01, 0xFC, 0x60, 0x00, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '6' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x9B, 0xC0, 0x03,
+  0x0C, 0xC0, 0x03, 0x0C, 0xE0, 0x03, 0x0C, 0x60, 0x03, 0x9C, 0x60, 0x01, 0xF8, 0x60, 0x00, 0xF0,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '7' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x60, 0x00,
+  0x00, 0x60, 0x03, 0x80, 0x60, 0x03, 0xF0, 0x60, 0x00, 0x7E, 0x60, 0x00, 0x0F, 0xE0, 0x00, 0x01,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '8' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x80, 0x01, 0xFF, 0xC0, 0x03, 0x9E, 0xE0, 0x03,
+  0x0C, 0x60, 0x03, 0x0C, 0x60, 0x03, 0x0C, 0x60, 0x03, 0x9E, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0xF3,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '9' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x80, 0x03, 0x0F, 0xC0, 0x03, 0x1C, 0xE0, 0x03,
+  0x18, 0x60, 0x03, 0x98, 0x60, 0x01, 0x98, 0x60, 0x01, 0xEC, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x3F,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ':' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x8E, 0x00, 0x03, 0x8E, 0x00, 0x03, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ';' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0x8E, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '<' */
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00,
+  0x6C, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x03, 0x01,
+  0x80, 0x03, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '=' */
+  0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00,
+  0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66,
+  0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '>' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x01, 0x83, 0x00, 0x01,
+  0x83, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+  /* '?' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0xC0, 0x03,
+  0x00, 0xC0, 0x03, 0x30, 0xC0, 0x03, 0x38, 0xC0, 0x00, 0x18, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '@' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xC0, 0x04,
+  0x00, 0x40, 0x04, 0x38, 0x20, 0x04, 0x44, 0x20, 0x04, 0x44, 0x60, 0x02, 0x7F, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'A' */
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0xE0, 0xC0, 0x03, 0x78, 0xC0, 0x00,
+  0x7E, 0xC0, 0x00, 0x67, 0xC0, 0x00, 0x61, 0xC0, 0x00, 0x6F, 0xC0, 0x03, 0x7E, 0x00, 0x03, 0xF0,
+  0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'B' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03,
+  0x18, 0xC0, 0x03, 0x18, 0xC0, 0x03, 0x18, 0xC0, 0x03, 0x1C, 0xC0, 0x03, 0x3F, 0x80, 0x03, 0xF7,
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'C' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xC3, 0x80, 0x03,
+  0x81, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0x81, 0x80, 0x01, 0xC3,
+  0xC0, 0x00, 0xC3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'D' */
+  0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0x00, 0xC0, 0x03,
+  0x00, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0x81, 0xC0, 0x01, 0xC3, 0x80, 0x00, 0xFF,
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'E' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03,
+  0x18, 0xC0, 0x03, 0x18, 0xC0, 0x03, 0x3C, 0xC0, 0x03, 0x3C, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0xC3,
+  0xC0, 0x03, 0xC3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'F' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03,
+  0x18, 0xC0, 0x03, 0x18, 0xC0, 0x03, 0x3C, 0xC0, 0x00, 0x3C, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x03,
+  0xC0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'G' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x81, 0x80, 0x03,
+  0x00, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0x30, 0xC0, 0x03, 0x30, 0xC0, 0x03, 0x31, 0x80, 0x01, 0xF3,
+  0xC0, 0x01, 0xF3, 0xC0, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+  /* 'H' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03,
+  0x18, 0xC0, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x03, 0x18, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF,
+  0xC0, 0x03, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'I' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x03, 0x00, 0xC0, 0x03,
+  0x00, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0x00,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'J' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x03, 0x00, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0x80, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0xFF,
+  0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,
+  /* 'K' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03,
+  0x18, 0xC0, 0x03, 0x0C, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0x73, 0xC0, 0x01, 0xE1, 0xC0, 0x03, 0x81,
+  0xC0, 0x03, 0x00, 0xC0, 0x03, 0x00, 0xC0, 0x00, 0x00, 0x00,
+  /* 'L' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0xFF, 0xC0, 0x03,
+  0xFF, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xE0,
+  0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'M' */
+  0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0x03, 0xC0, 0x03,
+  0x1E, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x03, 0x1E, 0x00, 0x03, 0x03, 0xC0, 0x03, 0xFF,
+  0xC0, 0x03, 0xFF, 0xC0, 0x03, 0x00, 0xC0, 0x00, 0x00, 0x00,
+  /* 'N' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03,
+  0x07, 0x80, 0x03, 0x1E, 0x00, 0x00, 0x78, 0xC0, 0x01, 0xE0, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF,
+  0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'O' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xC3, 0x80, 0x03,
+  0x81, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0x81, 0xC0, 0x01, 0xC3, 0x80, 0x00, 0xFF,
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'P' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03,
+  0x30, 0xC0, 0x03, 0x30, 0xC0, 0x03, 0x30, 0xC0, 0x00, 0x30, 0xC0, 0x00, 0x39, 0xC0, 0x00, 0x1F,
+  0x80, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'Q' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x19, 0xC3, 0x80, 0x1F,
+  0x81, 0xC0, 0x0F, 0x00, 0xC0, 0x0F, 0x00, 0xC0, 0x1F, 0x81, 0xC0, 0x19, 0xC3, 0x80, 0x1C, 0xFF,
+  0x00, 0x0C, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'R' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03,
+  0x18, 0xC0, 0x03, 0x18, 0xC0, 0x00, 0x18, 0xC0, 0x00, 0x38, 0xC0, 0x00, 0xFD, 0xC0, 0x01, 0xEF,
+  0x80, 0x03, 0x87, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'S' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC7, 0x00, 0x03, 0xCF, 0x80, 0x01, 0x8D, 0xC0, 0x03,
+  0x18, 0xC0, 0x03, 0x18, 0xC0, 0x03, 0x18, 0xC0, 0x03, 0x18, 0xC0, 0x03, 0xB1, 0x80, 0x01, 0xF3,
+  0xC0, 0x00, 0xE3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'T' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x03, 0x00, 0xC0, 0x03,
+  0x00, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0x00, 0xC0, 0x00, 0x07,
+  0xC0, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'U' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x03,
+  0x80, 0xC0, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x80, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0xFF,
+  0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'V' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x7C, 0xC0, 0x03,
+  0xF0, 0x00, 0x03, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7C, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03,
+  0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'W' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x1F, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xC0, 0xC0, 0x01,
+  0xF0, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0xC0, 0x03, 0xC0,
+  0xC0, 0x03, 0xFF, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xC0,
+  /* 'X' */
+  0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x03, 0x81, 0xC0, 0x03, 0xC3, 0xC0, 0x03, 0x66, 0xC0, 0x00,
+  0x3C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x3C, 0x00, 0x03, 0x66, 0xC0, 0x03, 0xC3, 0xC0, 0x03, 0x81,
+  0xC0, 0x03, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'Y' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x01, 0xC0, 0x03, 0x03, 0xC0, 0x03,
+  0x0E, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0x0E, 0xC0, 0x03, 0x03, 0xC0, 0x00, 0x01,
+  0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'Z' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x83, 0xC0, 0x03, 0xC3, 0xC0, 0x03,
+  0x60, 0xC0, 0x03, 0x38, 0xC0, 0x03, 0x1C, 0xC0, 0x03, 0x06, 0xC0, 0x03, 0xC3, 0xC0, 0x03, 0xC1,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '[' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '\\' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x01, 0xF0, 0x00,
+  0x07, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x0C, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ']' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x60, 0x18,
+  0x00, 0x60, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '^' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00,
+  0x00, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x06,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '_' */
+  0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
+  0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
+  0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,
+  /* '`' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x20, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'a' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xE4, 0x00, 0x03, 0x76, 0x00, 0x03,
+  0x36, 0x00, 0x03, 0x36, 0x00, 0x03, 0x36, 0x00, 0x01, 0xB6, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFC,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'b' */
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x01, 0x8C, 0x00, 0x03,
+  0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x01, 0x8C, 0x00, 0x01, 0xFC,
+  0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'c' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x03, 0x8C, 0x00, 0x03,
+  0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x04, 0x00, 0x01, 0x9E,
+  0x00, 0x01, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'd' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x01, 0x8C, 0x00, 0x03,
+  0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x01, 0x8C, 0x60, 0x03, 0xFF,
+  0xE0, 0x03, 0xFF, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'e' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xBC, 0x00, 0x03,
+  0x36, 0x00, 0x03, 0x36, 0x00, 0x03, 0x36, 0x00, 0x03, 0x36, 0x00, 0x03, 0x3C, 0x00, 0x01, 0xBC,
+  0x00, 0x01, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'f' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03,
+  0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x03, 0x06, 0x60, 0x03, 0x06, 0x60, 0x03, 0x06, 0x60, 0x03, 0x06,
+  0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'g' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x01, 0xFC, 0x00, 0x31, 0x8C, 0x00, 0x33,
+  0x06, 0x00, 0x33, 0x06, 0x00, 0x33, 0x06, 0x00, 0x33, 0x06, 0x00, 0x39, 0x8C, 0x00, 0x1F, 0xFE,
+  0x00, 0x0F, 0xFE, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+  /* 'h' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x03,
+  0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFC,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'i' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03,
+  0x06, 0x00, 0x03, 0xFE, 0x60, 0x03, 0xFE, 0x60, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'j' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x06, 0x00, 0x30, 0x06, 0x00, 0x30,
+  0x06, 0x00, 0x30, 0x06, 0x60, 0x38, 0x06, 0x60, 0x1F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'k' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x00,
+  0x30, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xCE, 0x00, 0x03, 0x86, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'l' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x03, 0x00, 0x60, 0x03,
+  0x00, 0x60, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'm' */
+  0x00, 0x00, 0x00, 0x03, 0x06, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0x06, 0x00, 0x00,
+  0x06, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x03, 0x06, 0x00, 0x00, 0x06, 0x00, 0x03, 0xFE,
+  0x00, 0x03, 0xFC, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'n' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03,
+  0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFC,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'o' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x01, 0xFC, 0x00, 0x01, 0x8C, 0x00, 0x03,
+  0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x01, 0x8C, 0x00, 0x01, 0xFC,
+  0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'p' */
+  0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x31, 0x8C, 0x00, 0x33,
+  0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x01, 0x8C, 0x00, 0x01, 0xFC,
+  0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'q' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x01, 0xFC, 0x00, 0x01, 0x8C, 0x00, 0x03,
+  0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x33, 0x06, 0x00, 0x31, 0x8C, 0x00, 0x3F, 0xFE,
+  0x00, 0x3F, 0xFE, 0x00, 0x30, 0x06, 0x00, 0x00, 0x00, 0x00,
+  /* 'r' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0xFE, 0x00, 0x03,
+  0xFE, 0x00, 0x03, 0x18, 0x00, 0x03, 0x0C, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x00, 0x0E,
+  0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 's' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x9C, 0x00, 0x03, 0xBC, 0x00, 0x03,
+  0x36, 0x00, 0x03, 0x36, 0x00, 0x03, 0x66, 0x00, 0x03, 0x66, 0x00, 0x01, 0xEE, 0x00, 0x01, 0xCE,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 't' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x01, 0xFF, 0xC0, 0x03,
+  0xFF, 0xC0, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x01, 0x86,
+  0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'u' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x86, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'v' */
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xF6, 0x00, 0x03,
+  0xC0, 0x00, 0x03, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0E,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'w' */
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xC6, 0x00, 0x00,
+  0xE0, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x03, 0xE6, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3E,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'x' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x8E, 0x00, 0x03,
+  0xDE, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x03, 0xDE, 0x00, 0x03, 0x8E, 0x00, 0x03, 0x06,
+  0x00, 0x03, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'y' */
+  0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0x30, 0x0E, 0x00, 0x30, 0x3E, 0x00, 0x38, 0xF6, 0x00, 0x3F,
+  0xC0, 0x00, 0x37, 0x80, 0x00, 0x31, 0xC0, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0E,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'z' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0E, 0x00, 0x03, 0x8E, 0x00, 0x03,
+  0xC6, 0x00, 0x03, 0x66, 0x00, 0x03, 0x36, 0x00, 0x03, 0x1E, 0x00, 0x03, 0x8E, 0x00, 0x03, 0x86,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '{' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+  0x70, 0x00, 0x0F, 0xFF, 0xC0, 0x1F, 0xDF, 0xE0, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '|' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '}' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x1F,
+  0xDF, 0xE0, 0x0F, 0xFF, 0xC0, 0x00, 0x70, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '~' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00,
+  0x0C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x38,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+sFONT Font20_Rotate90 = {
+  Font20_Rotate90_Table,
+  14, /* Width */
+  20, /* Height */
+  ROTATE_90,
+  &Font20,
+};
+
+static const uint8_t Font20_Rotate180_Table[] PROGMEM = {
+  /* ' ' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '!' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+  0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00,
+  /* '"' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x1C, 0xE0,
+  0x1C, 0xE0, 0x1C, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  /* '#' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0,
+  0x0C, 0xC0, 0x3F, 0xF0, 0x3F, 0xF0, 0x0C, 0xC0, 0x0C, 0xC0, 0x3F, 0xF0, 0x3F, 0xF0, 0x0C, 0xC0,
+  0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0,
+  /* '$' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x07, 0xE0,
+  0x0F, 0xE0, 0x18, 0x60, 0x18, 0x60, 0x1C, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x00, 0x60, 0x18, 0x60,
+  0x1F, 0xC0, 0x1F, 0x80, 0x03, 0x00, 0x03, 0x00,
+  /* '%' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x11, 0x00,
+  0x11, 0x00, 0x11, 0x00, 0x0E, 0x30, 0x00, 0xF0, 0x07, 0xC0, 0x1E, 0x00, 0x18, 0xE0, 0x01, 0x10,
+  0x01, 0x10, 0x01, 0x10, 0x00, 0xE0, 0x00, 0x00,
+  /* '&' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x80, 0x3F, 0xE0,
+  0x0C, 0x60, 0x1E, 0x60, 0x3F, 0xE0, 0x33, 0xC0, 0x01, 0x80, 0x00, 0xC0, 0x00, 0xC0, 0x1F, 0xC0,
+  0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ''' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x07, 0x00,
+  0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '(' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+  0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x06, 0x00,
+  0x06, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00,
+  /* ')' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
+  0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x80, 0x01, 0x80,
+  0x01, 0x80, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00,
+  /* '*' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0xC0, 0x0F, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x1F, 0xE0, 0x1B, 0x60,
+  0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00,
+  /* '+' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ',' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x03, 0x00, 0x03, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '-' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '.' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '/' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0xC0, 0x00, 0xC0,
+  0x00, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00,
+  0x0C, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x18, 0x00,
+  /* '0' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0xE0,
+  0x0C, 0x60, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30,
+  0x0C, 0x60, 0x0F, 0xE0, 0x07, 0xC0, 0x00, 0x00,
+  /* '1' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xE0,
+  0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x03, 0xE0, 0x03, 0xE0, 0x03, 0x00, 0x00, 0x00,
+  /* '2' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x1F, 0xF0,
+  0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x18, 0x30,
+  0x1C, 0x70, 0x0F, 0xE0, 0x07, 0xC0, 0x00, 0x00,
+  /* '3' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xF8,
+  0x1C, 0x18, 0x18, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x1C, 0x00, 0x18, 0x00,
+  0x1C, 0x30, 0x0F, 0xF0, 0x07, 0xC0, 0x00, 0x00,
+  /* '4' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00,
+  0x0C, 0x00, 0x1F, 0xF0, 0x1F, 0xF0, 0x0C, 0x30, 0x0C, 0x60, 0x0C, 0xC0, 0x0C, 0xC0, 0x0D, 0x80,
+  0x0F, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x00, 0x00,
+  /* '5' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xF0,
+  0x1C, 0x30, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x1C, 0x60, 0x0F, 0xE0, 0x07, 0xE0, 0x00, 0x60,
+  0x00, 0x60, 0x0F, 0xE0, 0x0F, 0xE0, 0x00, 0x00,
+  /* '6' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x0F, 0xE0,
+  0x1C, 0x60, 0x18, 0x30, 0x18, 0x30, 0x1C, 0x70, 0x0F, 0xF0, 0x07, 0xB0, 0x00, 0x70, 0x00, 0x60,
+  0x01, 0xE0, 0x1F, 0xC0, 0x1F, 0x00, 0x00, 0x00,
+  /* '7' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x18, 0x00,
+  0x18, 0x30, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0x00,
+  /* '8' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0xE0,
+  0x1C, 0x70, 0x18, 0x30, 0x18, 0x30, 0x1C, 0x70, 0x0F, 0xE0, 0x0F, 0xE0, 0x1C, 0x70, 0x18, 0x30,
+  0x1C, 0x70, 0x0F, 0xE0, 0x07, 0xC0, 0x00, 0x00,
+  /* '9' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x07, 0xF0,
+  0x0F, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0x1B, 0xC0, 0x1F, 0xE0, 0x1C, 0x70, 0x18, 0x30, 0x18, 0x30,
+  0x0C, 0x70, 0x0F, 0xE0, 0x03, 0xC0, 0x00, 0x00,
+  /* ':' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ';' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x03, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '<' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x78, 0x00, 0xE0, 0x03, 0x80, 0x0F, 0x00, 0x3C, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '=' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '>' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0xF0,
+  0x03, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '?' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x18, 0x00, 0x18, 0x60, 0x18, 0x60,
+  0x0F, 0xE0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* '@' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x08, 0x40, 0x00, 0x40,
+  0x00, 0x20, 0x0E, 0x20, 0x09, 0x20, 0x09, 0x20, 0x09, 0x20, 0x0E, 0x20, 0x08, 0x20, 0x08, 0x20,
+  0x08, 0x40, 0x04, 0xC0, 0x07, 0x00, 0x00, 0x00,
+  /* 'A' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x78, 0x78, 0x78,
+  0x30, 0x30, 0x1F, 0xE0, 0x1F, 0xE0, 0x18, 0xC0, 0x0C, 0xC0, 0x0D, 0x80, 0x0D, 0x80, 0x07, 0x00,
+  0x07, 0xE0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  /* 'B' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xF0,
+  0x30, 0x60, 0x30, 0x60, 0x38, 0x60, 0x1F, 0xE0, 0x0F, 0xE0, 0x1C, 0x60, 0x18, 0x60, 0x18, 0x60,
+  0x0F, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  /* 'C' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0,
+  0x38, 0xE0, 0x30, 0x70, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x30, 0x70, 0x38, 0xE0,
+  0x3F, 0xC0, 0x37, 0x80, 0x00, 0x00, 0x00, 0x00,
+  /* 'D' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x0F, 0xF8,
+  0x1C, 0x30, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x30, 0x1C, 0x30,
+  0x0F, 0xF8, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  /* 'E' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0,
+  0x30, 0x60, 0x30, 0x60, 0x06, 0x60, 0x07, 0xE0, 0x07, 0xE0, 0x06, 0x60, 0x30, 0x60, 0x30, 0x60,
+  0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  /* 'F' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0,
+  0x00, 0x60, 0x00, 0x60, 0x06, 0x60, 0x07, 0xE0, 0x07, 0xE0, 0x06, 0x60, 0x30, 0x60, 0x30, 0x60,
+  0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  /* 'G' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0xE0,
+  0x30, 0x60, 0x30, 0x30, 0x7E, 0x30, 0x7E, 0x30, 0x00, 0x30, 0x00, 0x30, 0x30, 0x30, 0x38, 0x60,
+  0x3F, 0xE0, 0x37, 0x80, 0x00, 0x00, 0x00, 0x00,
+  /* 'H' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xF0, 0x3C, 0xF0,
+  0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x1F, 0xE0, 0x1F, 0xE0, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60,
+  0x3C, 0xF0, 0x3C, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  /* 'I' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xE0,
+  0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x1F, 0xE0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  /* 'J' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0xF0,
+  0x1C, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,
+  0x7F, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'K' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xF0, 0x79, 0xF0,
+  0x18, 0x60, 0x0C, 0x60, 0x0C, 0x60, 0x06, 0xE0, 0x03, 0xE0, 0x03, 0x60, 0x06, 0x60, 0x1C, 0x60,
+  0x7D, 0xF0, 0x7D, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  /* 'L' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0,
+  0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
+  0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  /* 'M' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xF8, 0x7C, 0xF8,
+  0x30, 0x30, 0x33, 0x30, 0x33, 0x30, 0x37, 0xB0, 0x37, 0xB0, 0x34, 0xB0, 0x3C, 0xF0, 0x38, 0x70,
+  0x78, 0x78, 0x78, 0x78, 0x00, 0x00, 0x00, 0x00,
+  /* 'N' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xF0, 0x1D, 0xF0,
+  0x1C, 0x60, 0x1E, 0x60, 0x1E, 0x60, 0x1B, 0x60, 0x1B, 0x60, 0x19, 0xE0, 0x19, 0xE0, 0x18, 0xE0,
+  0x3E, 0xF0, 0x3E, 0x70, 0x00, 0x00, 0x00, 0x00,
+  /* 'O' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x0F, 0xC0,
+  0x1C, 0xE0, 0x38, 0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x70, 0x1C, 0xE0,
+  0x0F, 0xC0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00,
+  /* 'P' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0,
+  0x00, 0x60, 0x00, 0x60, 0x0F, 0xE0, 0x1F, 0xE0, 0x38, 0x60, 0x30, 0x60, 0x30, 0x60, 0x38, 0x60,
+  0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  /* 'Q' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xC0, 0x3F, 0xC0, 0x37, 0x80, 0x07, 0x80, 0x0F, 0xC0,
+  0x1C, 0xE0, 0x38, 0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x70, 0x1C, 0xE0,
+  0x0F, 0xC0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00,
+  /* 'R' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xF0, 0x71, 0xF0,
+  0x38, 0x60, 0x18, 0x60, 0x1C, 0x60, 0x0F, 0xE0, 0x1F, 0xE0, 0x38, 0x60, 0x30, 0x60, 0x38, 0x60,
+  0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  /* 'S' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x1F, 0xF0,
+  0x38, 0x70, 0x30, 0x30, 0x38, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x00, 0x70, 0x30, 0x30, 0x38, 0x70,
+  0x3F, 0xE0, 0x37, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* 'T' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0,
+  0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30,
+  0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  /* 'U' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x0F, 0xC0,
+  0x1C, 0xE0, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60,
+  0x3C, 0xF0, 0x3C, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  /* 'V' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
+  0x03, 0x80, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x0C, 0x60, 0x0C, 0x60, 0x18, 0x30, 0x18, 0x30,
+  0x3C, 0x78, 0x3C, 0x78, 0x00, 0x00, 0x00, 0x00,
+  /* 'W' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0x38, 0xE0,
+  0x38, 0xE0, 0x38, 0xE0, 0x2D, 0xA0, 0x6D, 0xB0, 0x67, 0x30, 0x67, 0x30, 0x67, 0x30, 0x60, 0x30,
+  0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  /* 'X' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x78, 0x3C, 0x78,
+  0x18, 0x30, 0x0C, 0x60, 0x06, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x06, 0xC0, 0x0C, 0x60, 0x18, 0x30,
+  0x3C, 0x78, 0x3C, 0x78, 0x00, 0x00, 0x00, 0x00,
+  /* 'Y' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0,
+  0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x07, 0x80, 0x07, 0x80, 0x0C, 0xC0, 0x18, 0x60,
+  0x3C, 0xF0, 0x3C, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  /* 'Z' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xE0,
+  0x18, 0x60, 0x18, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x60, 0x18, 0x60,
+  0x1F, 0xE0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  /* '[' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00,
+  /* '\\' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x0C, 0x00,
+  0x0C, 0x00, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x80, 0x01, 0x80, 0x00, 0xC0,
+  0x00, 0xC0, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x60,
+  /* ']' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x00,
+  /* '^' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x18, 0x30, 0x0C, 0x60,
+  0x06, 0xC0, 0x03, 0x80, 0x01, 0x00, 0x00, 0x00,
+  /* '_' */
+  0xFF, 0xFC, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '`' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x03, 0x00, 0x00, 0x80, 0x00, 0x00,
+  /* 'a' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xE0, 0x3F, 0xF0,
+  0x1C, 0x30, 0x18, 0x70, 0x1F, 0xE0, 0x1F, 0xC0, 0x18, 0x00, 0x1F, 0xE0, 0x0F, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'b' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xB8, 0x1F, 0xF8,
+  0x18, 0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x70, 0x1F, 0xF0, 0x07, 0xB0, 0x00, 0x30,
+  0x00, 0x30, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00,
+  /* 'c' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0xE0,
+  0x30, 0x70, 0x00, 0x30, 0x00, 0x30, 0x30, 0x30, 0x30, 0x60, 0x3F, 0xE0, 0x37, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'd' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x80, 0x7F, 0xE0,
+  0x38, 0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x60, 0x3F, 0xE0, 0x37, 0x80, 0x30, 0x00,
+  0x30, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00,
+  /* 'e' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0xE0,
+  0x30, 0x60, 0x00, 0x30, 0x3F, 0xF0, 0x3F, 0xF0, 0x18, 0x60, 0x1F, 0xE0, 0x07, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'f' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xE0,
+  0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x1F, 0xE0, 0x1F, 0xE0, 0x01, 0x80,
+  0x01, 0x80, 0x3F, 0x80, 0x3F, 0x00, 0x00, 0x00,
+  /* 'g' */
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x38, 0x00, 0x30, 0x00, 0x37, 0x80, 0x3F, 0xE0,
+  0x38, 0x60, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x60, 0x7F, 0xE0, 0x77, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'h' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xF0, 0x3C, 0xF0,
+  0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0xE0, 0x1F, 0xE0, 0x0F, 0x60, 0x00, 0x60,
+  0x00, 0x60, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00,
+  /* 'i' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xE0,
+  0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00,
+  /* 'j' */
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x0E, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00,
+  0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0F, 0xE0, 0x0F, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00,
+  /* 'k' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x70, 0x3E, 0x70,
+  0x06, 0x60, 0x03, 0x60, 0x01, 0xE0, 0x01, 0xE0, 0x03, 0x60, 0x1F, 0x60, 0x1F, 0x60, 0x00, 0x60,
+  0x00, 0x60, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00,
+  /* 'l' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xE0,
+  0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x00,
+  /* 'm' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x78, 0x77, 0x78,
+  0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x3F, 0xF8, 0x1D, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'n' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xF0, 0x3C, 0xF0,
+  0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0xE0, 0x1F, 0xF0, 0x0F, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'o' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x1F, 0xE0,
+  0x18, 0x60, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x60, 0x1F, 0xE0, 0x07, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'p' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x30, 0x00, 0x30, 0x07, 0xB0, 0x1F, 0xF0,
+  0x18, 0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x70, 0x1F, 0xF8, 0x07, 0xB8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'q' */
+  0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x30, 0x00, 0x30, 0x00, 0x37, 0x80, 0x3F, 0xE0,
+  0x38, 0x60, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x60, 0x7F, 0xE0, 0x77, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'r' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0,
+  0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x01, 0xC0, 0x33, 0xC0, 0x3E, 0xF0, 0x1C, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 's' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xE0,
+  0x18, 0x60, 0x1E, 0x00, 0x0F, 0xC0, 0x01, 0xE0, 0x18, 0x60, 0x1F, 0xE0, 0x1F, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 't' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0xC0,
+  0x30, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0xC0,
+  0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* 'u' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xC0, 0x3F, 0xE0,
+  0x1C, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x1C, 0x70, 0x1C, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'v' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
+  0x06, 0xC0, 0x06, 0xC0, 0x0C, 0x60, 0x0C, 0x60, 0x18, 0x30, 0x3C, 0x78, 0x3C, 0x78, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'w' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x60, 0x0C, 0x60,
+  0x0E, 0xE0, 0x0E, 0xE0, 0x1F, 0xB0, 0x19, 0x30, 0x19, 0x30, 0x3C, 0x78, 0x3C, 0x78, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'x' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xF0, 0x3C, 0xF0,
+  0x0C, 0xC0, 0x07, 0x80, 0x03, 0x00, 0x07, 0x80, 0x0C, 0xC0, 0x3C, 0xF0, 0x3C, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'y' */
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x03, 0xF8, 0x00, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x03, 0x80,
+  0x07, 0xC0, 0x06, 0xC0, 0x0C, 0x60, 0x0C, 0x60, 0x18, 0x30, 0x3C, 0x78, 0x3C, 0x78, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'z' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xE0,
+  0x18, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x60, 0x1F, 0xE0, 0x1F, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '{' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x03, 0x80, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x00, 0x00,
+  /* '|' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00,
+  /* '}' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0xE0, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
+  0x01, 0x80, 0x03, 0x80, 0x07, 0x00, 0x03, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
+  0x01, 0x80, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0x00,
+  /* '~' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x3F, 0x30, 0x33, 0xF0, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+sFONT Font20_Rotate180 = {
+  Font20_Rotate180_Table,
+  14, /* Width */
+  20, /* Height */
+  ROTATE_180,
+  &Font20,
+};
+
+static const uint8_t Font20_Rotate270_Table[] PROGMEM = {
+  /* ' ' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '!' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0x0C, 0x00, 0x7F, 0xCC, 0x00, 0x7F, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '"' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '#' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+  0xFF, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x06, 0x60,
+  0x00, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '$' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xE0, 0x00, 0x39, 0xF0, 0x00, 0x31,
+  0x98, 0x00, 0xF3, 0x1F, 0x00, 0xF3, 0x1F, 0x00, 0x33, 0x18, 0x00, 0x1F, 0x78, 0x00, 0x0E, 0x78,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '%' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x38, 0x00, 0x06, 0x44, 0x00, 0x03,
+  0x44, 0x00, 0x03, 0x44, 0x00, 0x39, 0x38, 0x00, 0x45, 0x80, 0x00, 0x45, 0x80, 0x00, 0x44, 0xC0,
+  0x00, 0x38, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '&' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x18, 0xEC, 0x00, 0x18, 0x78, 0x00, 0x18,
+  0x7C, 0x00, 0x18, 0xEC, 0x00, 0x19, 0xCC, 0x00, 0x0F, 0xCC, 0x00, 0x0E, 0xF8, 0x00, 0x00, 0x78,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ''' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
+  0x00, 0x00, 0x3F, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '(' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x01, 0x80, 0x7C,
+  0x0F, 0x80, 0x1F, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ')' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x7C, 0x0F, 0x80, 0x60, 0x01, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '*' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x07,
+  0xC0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x0C, 0xC0, 0x00, 0x0C, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '+' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
+  0x80, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80,
+  0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ',' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '-' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
+  0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80,
+  0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '.' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '/' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E,
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '0' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xF8, 0x00, 0x70,
+  0x1C, 0x00, 0x60, 0x0C, 0x00, 0x60, 0x0C, 0x00, 0x60, 0x0C, 0x00, 0x70, 0x1C, 0x00, 0x3F, 0xF8,
+  0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '1' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00,
+  0x0C, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '2' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x0C, 0x00, 0x3E, 0x0C, 0x00, 0x73,
+  0x0C, 0x00, 0x61, 0x8C, 0x00, 0x60, 0xCC, 0x00, 0x60, 0x6C, 0x00, 0x70, 0x3C, 0x00, 0x38, 0x1C,
+  0x00, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '3' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x77,
+  0x9C, 0x00, 0x63, 0x0C, 0x00, 0x63, 0x0C, 0x00, 0x63, 0x0C, 0x00, 0x60, 0x0C, 0x00, 0x30, 0x0C,
+  0x00, 0x30, 0x1C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
+  /* '4' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x7F, 0xFC, 0x00, 0x7F,
+  0xFC, 0x00, 0x70, 0x6C, 0x00, 0x38, 0x6C, 0x00, 0x0E, 0x60, 0x00, 0x07, 0x60, 0x00, 0x01, 0xE0,
+  0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '5' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x63, 0xF8, 0x00, 0x67,
+  0x1C, 0x00, 0x66, 0x0C, 0x00, 0x66, 0x0C, 0x00, 0x66, 0x0C, 0x00, 0x7F, 0x0C, 0x00, 0x7F, 0x1C,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '6' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xF0, 0x00, 0x61, 0xF8, 0x00, 0x63,
+  0x9C, 0x00, 0x63, 0x0C, 0x00, 0x73, 0x0C, 0x00, 0x33, 0x0C, 0x00, 0x3D, 0x98, 0x00, 0x1F, 0xF8,
+  0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '7' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x67,
+  0xE0, 0x00, 0x60, 0xFC, 0x00, 0x60, 0x1C, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x70, 0x00,
+  0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '8' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x77,
+  0x9C, 0x00, 0x63, 0x0C, 0x00, 0x63, 0x0C, 0x00, 0x63, 0x0C, 0x00, 0x77, 0x9C, 0x00, 0x3F, 0xF8,
+  0x00, 0x1C, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '9' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x33,
+  0x78, 0x00, 0x61, 0x98, 0x00, 0x61, 0x9C, 0x00, 0x61, 0x8C, 0x00, 0x73, 0x8C, 0x00, 0x3F, 0x0C,
+  0x00, 0x1E, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ':' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x1C, 0x00, 0x07, 0x1C, 0x00, 0x07, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ';' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+  0x10, 0x00, 0x07, 0x18, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '<' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0C, 0x00, 0x18, 0x0C, 0x00, 0x0C, 0x18, 0x00, 0x0C,
+  0x18, 0x00, 0x06, 0x30, 0x00, 0x06, 0x30, 0x00, 0x03, 0x60, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0,
+  0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+  /* '=' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06,
+  0x60, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60,
+  0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00,
+  /* '>' */
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x03,
+  0x60, 0x00, 0x06, 0x30, 0x00, 0x06, 0x30, 0x00, 0x0C, 0x18, 0x00, 0x0C, 0x18, 0x00, 0x18, 0x0C,
+  0x00, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '?' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x31,
+  0x80, 0x00, 0x31, 0xCC, 0x00, 0x30, 0xCC, 0x00, 0x30, 0x0C, 0x00, 0x3C, 0x00, 0x00, 0x1C, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '@' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0x62,
+  0x22, 0x00, 0x42, 0x22, 0x00, 0x41, 0xC2, 0x00, 0x20, 0x02, 0x00, 0x30, 0x0C, 0x00, 0x0F, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'A' */
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xEC, 0x00, 0x3F,
+  0x60, 0x00, 0x38, 0x60, 0x00, 0x3E, 0x60, 0x00, 0x37, 0xE0, 0x00, 0x31, 0xEC, 0x00, 0x30, 0x7C,
+  0x00, 0x00, 0x1C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
+  /* 'B' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x0E, 0xFC, 0x00, 0x1F, 0xCC, 0x00, 0x33,
+  0x8C, 0x00, 0x31, 0x8C, 0x00, 0x31, 0x8C, 0x00, 0x31, 0x8C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC,
+  0x00, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'C' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x30, 0x00, 0x3C, 0x38, 0x00, 0x18, 0x1C, 0x00, 0x30,
+  0x0C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x38, 0x1C, 0x00, 0x1C, 0x38, 0x00, 0x0F, 0xF0,
+  0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'D' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x1C, 0x38, 0x00, 0x38,
+  0x1C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x3F, 0xFC,
+  0x00, 0x3F, 0xFC, 0x00, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00,
+  /* 'E' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x3C, 0x3C, 0x00, 0x30, 0x0C, 0x00, 0x33,
+  0xCC, 0x00, 0x33, 0xCC, 0x00, 0x31, 0x8C, 0x00, 0x31, 0x8C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC,
+  0x00, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'F' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x30, 0x00, 0x00, 0x33,
+  0xC0, 0x00, 0x33, 0xCC, 0x00, 0x31, 0x8C, 0x00, 0x31, 0x8C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC,
+  0x00, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'G' */
+  0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x3C, 0xF8, 0x00, 0x3C, 0xF8, 0x00, 0x18, 0xCC, 0x00, 0x30,
+  0xCC, 0x00, 0x30, 0xCC, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x18, 0x18, 0x00, 0x1F, 0xF8,
+  0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'H' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x31,
+  0x8C, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x31, 0x8C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC,
+  0x00, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'I' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x30,
+  0x0C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'J' */
+  0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x30,
+  0x1C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'K' */
+  0x00, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x38, 0x1C, 0x00, 0x38, 0x78, 0x00, 0x3C,
+  0xE0, 0x00, 0x07, 0x80, 0x00, 0x33, 0x0C, 0x00, 0x31, 0x8C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC,
+  0x00, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'L' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0C, 0x00, 0x00,
+  0x0C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x30, 0x0C,
+  0x00, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'M' */
+  0x00, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3C, 0x0C, 0x00, 0x07,
+  0x8C, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x8C, 0x00, 0x3C, 0x0C, 0x00, 0x3F, 0xFC,
+  0x00, 0x3F, 0xFC, 0x00, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00,
+  /* 'N' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x30,
+  0x78, 0x00, 0x31, 0xE0, 0x00, 0x07, 0x8C, 0x00, 0x1E, 0x0C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC,
+  0x00, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'O' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x1C, 0x38, 0x00, 0x38,
+  0x1C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x38, 0x1C, 0x00, 0x1C, 0x38, 0x00, 0x0F, 0xF0,
+  0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'P' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x39, 0xC0, 0x00, 0x30,
+  0xC0, 0x00, 0x30, 0xCC, 0x00, 0x30, 0xCC, 0x00, 0x30, 0xCC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC,
+  0x00, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'Q' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE3, 0x00, 0x0F, 0xF3, 0x80, 0x1C, 0x39, 0x80, 0x38,
+  0x1F, 0x80, 0x30, 0x0F, 0x00, 0x30, 0x0F, 0x00, 0x38, 0x1F, 0x80, 0x1C, 0x39, 0x80, 0x0F, 0xF0,
+  0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'R' */
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0E, 0x1C, 0x00, 0x1F, 0x78, 0x00, 0x3B, 0xF0, 0x00, 0x31,
+  0xC0, 0x00, 0x31, 0x80, 0x00, 0x31, 0x8C, 0x00, 0x31, 0x8C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC,
+  0x00, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'S' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x70, 0x00, 0x3C, 0xF8, 0x00, 0x18, 0xDC, 0x00, 0x31,
+  0x8C, 0x00, 0x31, 0x8C, 0x00, 0x31, 0x8C, 0x00, 0x31, 0x8C, 0x00, 0x3B, 0x18, 0x00, 0x1F, 0x3C,
+  0x00, 0x0E, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'T' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x30,
+  0x0C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x3E, 0x00,
+  0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'U' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x30,
+  0x1C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x30, 0x1C, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF0,
+  0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'V' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x33,
+  0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xFC, 0x00, 0x33, 0xE0, 0x00, 0x3F, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'W' */
+  0x30, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xFC, 0x00, 0x30, 0x3C, 0x00, 0x30, 0xF8, 0x00, 0x07,
+  0xC0, 0x00, 0x07, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x30, 0xF8, 0x00, 0x30, 0x3C, 0x00, 0x3F, 0xFC,
+  0x00, 0x3F, 0x80, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'X' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x38, 0x1C, 0x00, 0x3C, 0x3C, 0x00, 0x36,
+  0x6C, 0x00, 0x03, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x36, 0x6C, 0x00, 0x3C, 0x3C,
+  0x00, 0x38, 0x1C, 0x00, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00,
+  /* 'Y' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x38, 0x00, 0x00, 0x3C, 0x0C, 0x00, 0x37,
+  0x0C, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x37, 0x0C, 0x00, 0x3C, 0x0C, 0x00, 0x38, 0x00,
+  0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'Z' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x3C, 0x00, 0x3C, 0x3C, 0x00, 0x36,
+  0x0C, 0x00, 0x33, 0x8C, 0x00, 0x31, 0xCC, 0x00, 0x30, 0x6C, 0x00, 0x3C, 0x3C, 0x00, 0x3C, 0x1C,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '[' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x01, 0x80, 0x60,
+  0x01, 0x80, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '\\' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1F, 0x00, 0x00,
+  0x7C, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ']' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x60, 0x01, 0x80, 0x60, 0x01, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '^' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00,
+  0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '_' */
+  0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00,
+  0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30,
+  /* '`' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'a' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x06,
+  0xD8, 0x00, 0x06, 0xCC, 0x00, 0x06, 0xCC, 0x00, 0x06, 0xCC, 0x00, 0x06, 0xEC, 0x00, 0x02, 0x7C,
+  0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'b' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x03, 0x18, 0x00, 0x06,
+  0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x03, 0x18, 0x00, 0x7F, 0xFC,
+  0x00, 0x7F, 0xFC, 0x00, 0x60, 0x0C, 0x00, 0x00, 0x00, 0x00,
+  /* 'c' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x98, 0x00, 0x07, 0x98, 0x00, 0x02, 0x0C, 0x00, 0x06,
+  0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x03, 0x1C, 0x00, 0x03, 0xF8,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'd' */
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x63, 0x18, 0x00, 0x06,
+  0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x03, 0x18, 0x00, 0x03, 0xF8,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'e' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x00, 0x03, 0xD8, 0x00, 0x03, 0xCC, 0x00, 0x06,
+  0xCC, 0x00, 0x06, 0xCC, 0x00, 0x06, 0xCC, 0x00, 0x06, 0xCC, 0x00, 0x03, 0xD8, 0x00, 0x03, 0xF8,
+  0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'f' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x66, 0x0C, 0x00, 0x66, 0x0C, 0x00, 0x66,
+  0x0C, 0x00, 0x66, 0x0C, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'g' */
+  0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x03, 0x19, 0xC0, 0x06,
+  0x0C, 0xC0, 0x06, 0x0C, 0xC0, 0x06, 0x0C, 0xC0, 0x06, 0x0C, 0xC0, 0x03, 0x18, 0xC0, 0x03, 0xF8,
+  0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'h' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x06,
+  0x0C, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x0C, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFC,
+  0x00, 0x60, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'i' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00,
+  0x0C, 0x00, 0x67, 0xFC, 0x00, 0x67, 0xFC, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'j' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x07,
+  0xFF, 0x80, 0x66, 0x01, 0xC0, 0x66, 0x00, 0xC0, 0x06, 0x00, 0xC0, 0x06, 0x00, 0xC0, 0x06, 0x00,
+  0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'k' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06,
+  0x1C, 0x00, 0x07, 0x3C, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xC0, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFC,
+  0x00, 0x60, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'l' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00,
+  0x0C, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x60, 0x0C, 0x00, 0x60, 0x0C, 0x00, 0x60, 0x0C,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'm' */
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x06, 0x00, 0x00, 0x06,
+  0x0C, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x06, 0x00, 0x00, 0x06, 0x0C, 0x00, 0x07, 0xFC,
+  0x00, 0x07, 0xFC, 0x00, 0x06, 0x0C, 0x00, 0x00, 0x00, 0x00,
+  /* 'n' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x06,
+  0x0C, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x0C, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC,
+  0x00, 0x06, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'o' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x03, 0x18, 0x00, 0x06,
+  0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x03, 0x18, 0x00, 0x03, 0xF8,
+  0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'p' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x03, 0x18, 0x00, 0x06,
+  0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0xC0, 0x03, 0x18, 0xC0, 0x07, 0xFF,
+  0xC0, 0x07, 0xFF, 0xC0, 0x06, 0x00, 0xC0, 0x00, 0x00, 0x00,
+  /* 'q' */
+  0x00, 0x00, 0x00, 0x06, 0x00, 0xC0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x03, 0x18, 0xC0, 0x06,
+  0x0C, 0xC0, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x03, 0x18, 0x00, 0x03, 0xF8,
+  0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'r' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x06, 0x0C, 0x00, 0x06,
+  0x0C, 0x00, 0x03, 0x0C, 0x00, 0x01, 0x8C, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x06, 0x0C,
+  0x00, 0x06, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 's' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x38, 0x00, 0x07, 0x78, 0x00, 0x06,
+  0x6C, 0x00, 0x06, 0x6C, 0x00, 0x06, 0xCC, 0x00, 0x06, 0xCC, 0x00, 0x03, 0xDC, 0x00, 0x03, 0x9C,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 't' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x06, 0x18, 0x00, 0x06, 0x0C, 0x00, 0x06,
+  0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x06, 0x00,
+  0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'u' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x06,
+  0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xF8,
+  0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'v' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x06,
+  0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x3C, 0x00, 0x06, 0xF0, 0x00, 0x07, 0xC0,
+  0x00, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'w' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x06,
+  0x7C, 0x00, 0x00, 0x70, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x70, 0x00, 0x06, 0x3C, 0x00, 0x07, 0xFC,
+  0x00, 0x07, 0xC0, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'x' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x07, 0x1C, 0x00, 0x07,
+  0xBC, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x07, 0xBC, 0x00, 0x07, 0x1C, 0x00, 0x06, 0x0C,
+  0x00, 0x06, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'y' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x06,
+  0xF0, 0x00, 0x00, 0x38, 0xC0, 0x00, 0x1E, 0xC0, 0x00, 0x3F, 0xC0, 0x06, 0xF1, 0xC0, 0x07, 0xC0,
+  0xC0, 0x07, 0x00, 0xC0, 0x06, 0x00, 0xC0, 0x00, 0x00, 0x00,
+  /* 'z' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1C, 0x00, 0x07, 0x1C, 0x00, 0x07,
+  0x8C, 0x00, 0x06, 0xCC, 0x00, 0x06, 0x6C, 0x00, 0x06, 0x3C, 0x00, 0x07, 0x1C, 0x00, 0x07, 0x0C,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '{' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x01, 0x80, 0x60,
+  0x01, 0x80, 0x7F, 0xBF, 0x80, 0x3F, 0xFF, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '|' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '}' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xBF, 0x80, 0x60, 0x01, 0x80, 0x60, 0x01,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '~' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,
+  0xC0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80,
+  0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+sFONT Font20_Rotate270 = {
+  Font20_Rotate270_Table,
+  14, /* Width */
+  20, /* Height */
+  ROTATE_270,
+  &Font20,
+};
+
+static const uint8_t Font24_Rotate90_Table[] PROGMEM = {
+  /* ' ' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '!' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x87, 0xFC, 0x01, 0x9F, 0xFC, 0x01, 0x87, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '"' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
+  0x03, 0xF8, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x03,
+  0xF8, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '#' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x80, 0x00, 0x19, 0x80, 0x03, 0xFD, 0x80, 0x03,
+  0xFF, 0xFC, 0x00, 0x1B, 0xFC, 0x00, 0x19, 0x80, 0x03, 0xFD, 0x80, 0x03, 0xFF, 0xFC, 0x00, 0x1B,
+  0xFC, 0x00, 0x19, 0x80, 0x00, 0x19, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '$' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xE0, 0x00, 0xF9, 0xF0, 0x00,
+  0x73, 0x98, 0x00, 0xC3, 0x18, 0x0F, 0xC3, 0x1E, 0x0F, 0xC7, 0x1E, 0x00, 0xE6, 0x70, 0x00, 0x7E,
+  0x78, 0x00, 0x3C, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '%' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x05, 0xF8, 0x00,
+  0x7F, 0x9C, 0x00, 0xFF, 0x0C, 0x01, 0xCF, 0x0C, 0x01, 0x87, 0x9C, 0x01, 0x87, 0xF8, 0x01, 0xCF,
+  0xF0, 0x00, 0xFD, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '&' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xF9, 0xC0, 0x01,
+  0x9F, 0xE0, 0x01, 0x8E, 0x30, 0x01, 0x9C, 0x30, 0x01, 0xB8, 0x30, 0x01, 0xF0, 0x70, 0x00, 0xF0,
+  0x70, 0x01, 0xF8, 0x30, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* ''' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '(' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x07, 0xC0,
+  0xF8, 0x0F, 0x00, 0x3C, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* ')' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x0F, 0x00, 0x3C, 0x07,
+  0xC0, 0xF8, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '*' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,
+  0x0C, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x0C,
+  0xE0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '+' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x06, 0x00, 0x00, 0x06,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* ',' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '-' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '.' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '/' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03,
+  0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00,
+  0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '0' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0xF0, 0x00,
+  0xE0, 0x38, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x0C, 0x00, 0xE0,
+  0x38, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '1' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01,
+  0x80, 0x38, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xFC, 0x01, 0x80, 0x00, 0x01, 0x80,
+  0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '2' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x70, 0x01, 0xC0, 0x78, 0x01, 0xE0, 0x18, 0x01,
+  0xB0, 0x0C, 0x01, 0x98, 0x0C, 0x01, 0x8C, 0x0C, 0x01, 0x8C, 0x0C, 0x01, 0x86, 0x0C, 0x01, 0x83,
+  0x18, 0x01, 0x81, 0xF8, 0x01, 0x80, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '3' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x01, 0xC0, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x83, 0x0C, 0x01, 0x83, 0x0C, 0x01, 0x83, 0x0C, 0x01, 0x87, 0x9C, 0x00, 0xC6,
+  0xF8, 0x00, 0xFC, 0x70, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '4' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x37, 0x00, 0x00,
+  0x33, 0xC0, 0x01, 0xB0, 0xE0, 0x01, 0xB0, 0x38, 0x01, 0xB0, 0x1C, 0x01, 0xFF, 0xFC, 0x01, 0xFF,
+  0xFC, 0x01, 0xB0, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '5' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC3, 0xFC, 0x01, 0x83, 0xFC, 0x01,
+  0x83, 0x0C, 0x01, 0x81, 0x8C, 0x01, 0x81, 0x8C, 0x01, 0x81, 0x8C, 0x01, 0x81, 0x8C, 0x00, 0xC3,
+  0x0C, 0x00, 0xFF, 0x0C, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '6' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0xE0, 0x00,
+  0xC6, 0x70, 0x01, 0x83, 0x38, 0x01, 0x83, 0x18, 0x01, 0x83, 0x0C, 0x01, 0x83, 0x0C, 0x01, 0xC6,
+  0x0C, 0x00, 0xFE, 0x0C, 0x00, 0x78, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '7' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0x0C, 0x00, 0x00, 0x0C, 0x01, 0xC0, 0x0C, 0x01, 0xF8, 0x0C, 0x00, 0x7F, 0x0C, 0x00, 0x0F,
+  0xEC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '8' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x70, 0x00, 0xFC, 0xF8, 0x01,
+  0xC7, 0x9C, 0x01, 0x83, 0x0C, 0x01, 0x83, 0x0C, 0x01, 0x83, 0x0C, 0x01, 0x83, 0x0C, 0x01, 0xC7,
+  0x9C, 0x00, 0xFC, 0xF8, 0x00, 0x78, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '9' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0xF0, 0x01, 0x83, 0xF8, 0x01,
+  0x83, 0x1C, 0x01, 0x86, 0x0C, 0x01, 0x86, 0x0C, 0x00, 0xC6, 0x0C, 0x00, 0xE6, 0x0C, 0x00, 0x73,
+  0x18, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* ':' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xC1, 0xC0, 0x01, 0xC1, 0xC0, 0x01, 0xC1, 0xC0, 0x01, 0xC1, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* ';' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE1, 0xC0, 0x00, 0x61, 0xC0, 0x00, 0x21,
+  0xC0, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '<' */
+  0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1B, 0x00, 0x00,
+  0x1B, 0x00, 0x00, 0x31, 0x80, 0x00, 0x31, 0x80, 0x00, 0x60, 0xC0, 0x00, 0x60, 0xC0, 0x00, 0xC0,
+  0x60, 0x01, 0xC0, 0x70, 0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '=' */
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x80, 0x00, 0x19, 0x80, 0x00, 0x19, 0x80, 0x00, 0x19, 0x80, 0x00,
+  0x19, 0x80, 0x00, 0x19, 0x80, 0x00, 0x19, 0x80, 0x00, 0x19, 0x80, 0x00, 0x19, 0x80, 0x00, 0x19,
+  0x80, 0x00, 0x19, 0x80, 0x00, 0x19, 0x80, 0x00, 0x19, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '>' */
+  0x00, 0x00, 0x00, 0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01, 0xC0, 0x70, 0x00, 0xC0, 0x60, 0x00,
+  0x60, 0xC0, 0x00, 0x60, 0xC0, 0x00, 0x31, 0x80, 0x00, 0x31, 0x80, 0x00, 0x1B, 0x00, 0x00, 0x1B,
+  0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '?' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF0, 0x01,
+  0x80, 0x18, 0x01, 0x9C, 0x18, 0x01, 0x9C, 0x18, 0x00, 0x0E, 0x18, 0x00, 0x07, 0x38, 0x00, 0x03,
+  0xF0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '@' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0xF0, 0x03,
+  0x80, 0x38, 0x07, 0x00, 0x1C, 0x06, 0x0F, 0x0C, 0x06, 0x1F, 0x8C, 0x06, 0x31, 0xCC, 0x06, 0x30,
+  0xDC, 0x03, 0x3F, 0xF8, 0x03, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'A' */
+  0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xF0, 0x18, 0x01, 0xBC, 0x18, 0x01,
+  0x9F, 0x18, 0x00, 0x1B, 0xD8, 0x00, 0x18, 0xF8, 0x00, 0x18, 0x38, 0x01, 0x98, 0xF0, 0x01, 0x9F,
+  0xC0, 0x01, 0x9F, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xE0, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'B' */
+  0x00, 0x00, 0x00, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x01,
+  0x86, 0x18, 0x01, 0x86, 0x18, 0x01, 0x86, 0x18, 0x01, 0x86, 0x18, 0x01, 0x86, 0x18, 0x01, 0x87,
+  0x38, 0x01, 0x8F, 0xF0, 0x00, 0xFD, 0xE0, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'C' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0xE0, 0x70, 0x00,
+  0xC0, 0x30, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0xC0, 0x30, 0x00, 0xE0, 0xF8, 0x00, 0x60, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'D' */
+  0x00, 0x00, 0x00, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xC0,
+  0x30, 0x00, 0xE0, 0x70, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'E' */
+  0x00, 0x00, 0x00, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x01,
+  0x86, 0x18, 0x01, 0x86, 0x18, 0x01, 0x9F, 0x98, 0x01, 0x9F, 0x98, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0xF0, 0xF8, 0x01, 0xF0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'F' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF8, 0x01,
+  0xFF, 0xF8, 0x01, 0x86, 0x18, 0x01, 0x86, 0x18, 0x01, 0x9F, 0x98, 0x01, 0x9F, 0x98, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'G' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0xE0, 0x70, 0x00,
+  0xC0, 0x30, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x8C, 0x18, 0x01, 0x8C, 0x18, 0x01, 0x8C,
+  0x18, 0x01, 0xCC, 0x30, 0x00, 0xFC, 0xF8, 0x00, 0xFC, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'H' */
+  0x00, 0x00, 0x00, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x01,
+  0x86, 0x18, 0x01, 0x86, 0x18, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x01, 0x86, 0x18, 0x01, 0x86,
+  0x18, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'I' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'J' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0x80, 0x00, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xFF,
+  0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'K' */
+  0x00, 0x00, 0x00, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x01,
+  0x8C, 0x18, 0x01, 0x86, 0x18, 0x01, 0x87, 0x18, 0x00, 0x0F, 0x80, 0x00, 0x1C, 0xC0, 0x00, 0x78,
+  0x78, 0x01, 0xF0, 0x38, 0x01, 0xC0, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'L' */
+  0x00, 0x00, 0x00, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF8, 0x01,
+  0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x00, 0x01, 0x80,
+  0x00, 0x01, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'M' */
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x01, 0x80, 0xF0, 0x01,
+  0x83, 0xC0, 0x01, 0x8F, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x01, 0x8F, 0x00, 0x01, 0x83,
+  0xC0, 0x01, 0x80, 0xF0, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+  0x00, 0x00, 0x00,
+  /* 'N' */
+  0x00, 0x00, 0x00, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x01,
+  0x80, 0xE0, 0x01, 0x83, 0xC0, 0x01, 0x87, 0x80, 0x00, 0x1E, 0x18, 0x00, 0x3C, 0x18, 0x00, 0x70,
+  0x18, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'O' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0xF0, 0xF0, 0x00,
+  0xC0, 0x30, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x00, 0xC0,
+  0x30, 0x00, 0xF0, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'P' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF8, 0x01,
+  0xFF, 0xF8, 0x01, 0x8C, 0x18, 0x01, 0x8C, 0x18, 0x01, 0x8C, 0x18, 0x01, 0x8C, 0x18, 0x00, 0x0C,
+  0x18, 0x00, 0x06, 0x38, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'Q' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0xE0, 0x0C, 0xF0, 0xF0, 0x0F,
+  0xC0, 0x30, 0x07, 0x80, 0x18, 0x07, 0x80, 0x18, 0x07, 0x80, 0x18, 0x07, 0x80, 0x18, 0x0C, 0xC0,
+  0x30, 0x0C, 0xF0, 0xF0, 0x0E, 0x7F, 0xE0, 0x06, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'R' */
+  0x00, 0x00, 0x00, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x01,
+  0x86, 0x18, 0x01, 0x86, 0x18, 0x01, 0x86, 0x18, 0x00, 0x0E, 0x18, 0x00, 0x1E, 0x18, 0x00, 0x7B,
+  0x38, 0x00, 0xF3, 0xF0, 0x01, 0xC1, 0xE0, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'S' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF1, 0xE0, 0x01, 0xF3, 0xF0, 0x00,
+  0xC3, 0x38, 0x01, 0x87, 0x18, 0x01, 0x86, 0x18, 0x01, 0x86, 0x18, 0x01, 0x8E, 0x18, 0x01, 0xCC,
+  0x30, 0x00, 0xFC, 0xF8, 0x00, 0x78, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'T' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'U' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xF8, 0x00,
+  0xC0, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x18, 0x00, 0xC0,
+  0x18, 0x00, 0xFF, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'V' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x01, 0xF8, 0x00,
+  0x07, 0xD8, 0x00, 0x3E, 0x18, 0x00, 0xF8, 0x18, 0x01, 0xC0, 0x00, 0x00, 0xF8, 0x18, 0x00, 0x3E,
+  0x18, 0x00, 0x07, 0xD8, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x00,
+  /* 'W' */
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0x18, 0x01,
+  0xF0, 0x18, 0x00, 0x7C, 0x18, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x7C,
+  0x18, 0x01, 0xF0, 0x18, 0x01, 0xFF, 0x18, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x18,
+  /* 'X' */
+  0x00, 0x00, 0x00, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xC0, 0x38, 0x01, 0xE0, 0x78, 0x01,
+  0xB0, 0xD8, 0x01, 0x99, 0x98, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x99, 0x98, 0x01, 0xB0,
+  0xD8, 0x01, 0xE0, 0x78, 0x01, 0xC0, 0x38, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'Y' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x01, 0x80, 0x78, 0x01,
+  0x81, 0xD8, 0x01, 0x83, 0x80, 0x01, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x01, 0x83, 0x98, 0x01, 0x81,
+  0xD8, 0x01, 0x80, 0x78, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'Z' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xE1, 0xF8, 0x01, 0xB1, 0xF8, 0x01,
+  0x98, 0x18, 0x01, 0x8C, 0x18, 0x01, 0x86, 0x18, 0x01, 0x83, 0x18, 0x01, 0x81, 0x98, 0x01, 0x80,
+  0xD8, 0x01, 0xF8, 0x78, 0x01, 0xF8, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '[' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x0C, 0x00, 0x0C, 0x0C, 0x00,
+  0x0C, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '\\' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x1F, 0x00,
+  0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0,
+  0x00, 0x0F, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* ']' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x0C,
+  0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '^' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xC0, 0x00,
+  0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '_' */
+  0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
+  0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
+  0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '`' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'a' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xF8, 0x80, 0x01, 0x98, 0xC0, 0x01,
+  0x8C, 0xC0, 0x01, 0x8C, 0xC0, 0x01, 0x8C, 0xC0, 0x01, 0x8C, 0xC0, 0x00, 0xCC, 0xC0, 0x01, 0xFF,
+  0x80, 0x01, 0xFF, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'b' */
+  0x00, 0x00, 0x00, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x0C, 0x01, 0xFF, 0xFC, 0x01, 0xFF, 0xFC, 0x00,
+  0xC1, 0x80, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80,
+  0xC0, 0x00, 0xC1, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'c' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xE3, 0x80, 0x00,
+  0xC1, 0x80, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80,
+  0xC0, 0x01, 0xC1, 0x80, 0x00, 0xE7, 0xC0, 0x00, 0x67, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'd' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xC1, 0x80, 0x01,
+  0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xCC, 0x00, 0xC1,
+  0x8C, 0x01, 0xFF, 0xFC, 0x01, 0xFF, 0xFC, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'e' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xCD, 0x80, 0x01,
+  0x8C, 0xC0, 0x01, 0x8C, 0xC0, 0x01, 0x8C, 0xC0, 0x01, 0x8C, 0xC0, 0x01, 0x8C, 0xC0, 0x01, 0x8C,
+  0xC0, 0x01, 0x8D, 0x80, 0x00, 0xCF, 0x80, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'f' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01,
+  0xFF, 0xF0, 0x01, 0xFF, 0xF8, 0x01, 0x80, 0xCC, 0x01, 0x80, 0xCC, 0x01, 0x80, 0xCC, 0x01, 0x80,
+  0xCC, 0x01, 0x80, 0xCC, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'g' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xFF, 0x80, 0x30, 0xC1, 0x80, 0x31,
+  0x80, 0xC0, 0x31, 0x80, 0xC0, 0x31, 0x80, 0xC0, 0x31, 0x80, 0xC0, 0x31, 0x80, 0xC0, 0x18, 0xC1,
+  0x80, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'h' */
+  0x00, 0x00, 0x00, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x0C, 0x01, 0xFF, 0xFC, 0x01, 0xFF, 0xFC, 0x01,
+  0x81, 0x80, 0x01, 0x80, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x81,
+  0xC0, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'i' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01,
+  0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0xFF, 0xCC, 0x01, 0xFF, 0xCC, 0x01, 0x80, 0x00, 0x01, 0x80,
+  0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'j' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x30,
+  0x00, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xCC, 0x18, 0x00, 0xCC, 0x1F, 0xFF,
+  0xC0, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'k' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x0C, 0x01, 0xFF, 0xFC, 0x01,
+  0xFF, 0xFC, 0x00, 0x1C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x77, 0xC0, 0x01, 0xE1, 0xC0, 0x01, 0xC0,
+  0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'l' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x0C, 0x01,
+  0x80, 0x0C, 0x01, 0x80, 0x0C, 0x01, 0xFF, 0xFC, 0x01, 0xFF, 0xFC, 0x01, 0x80, 0x00, 0x01, 0x80,
+  0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'm' */
+  0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x01, 0x81, 0x80, 0x01,
+  0x80, 0xC0, 0x00, 0x00, 0xC0, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x01, 0x81, 0xC0, 0x01, 0x80,
+  0xC0, 0x00, 0x00, 0xC0, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'n' */
+  0x00, 0x00, 0x00, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x01,
+  0x81, 0x80, 0x01, 0x80, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x81,
+  0xC0, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'o' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xE3, 0x80, 0x00,
+  0xC1, 0x80, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x00, 0xC1,
+  0x80, 0x00, 0xE3, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'p' */
+  0x00, 0x00, 0x00, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x30,
+  0xC1, 0x80, 0x31, 0x80, 0xC0, 0x31, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80,
+  0xC0, 0x00, 0xC1, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'q' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xC1, 0x80, 0x01,
+  0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x31, 0x80, 0xC0, 0x31, 0x80, 0xC0, 0x30, 0xC1,
+  0x80, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'r' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01,
+  0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x01, 0x83, 0x00, 0x01, 0x81, 0x80, 0x01, 0x81, 0xC0, 0x01, 0x80,
+  0xC0, 0x01, 0x80, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 's' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE7, 0x00, 0x01, 0xEF, 0x80, 0x01,
+  0x8C, 0xC0, 0x01, 0x8C, 0xC0, 0x01, 0x8C, 0xC0, 0x01, 0x9C, 0xC0, 0x01, 0x98, 0xC0, 0x01, 0xD8,
+  0xC0, 0x00, 0xFB, 0xC0, 0x00, 0x73, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 't' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x7F, 0xFC, 0x00,
+  0xFF, 0xFC, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80,
+  0xC0, 0x01, 0xC0, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'u' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xC0, 0x01,
+  0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0xC0, 0x00, 0xC0,
+  0xC0, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'v' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xC0, 0x00,
+  0x7C, 0xC0, 0x01, 0xF0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C,
+  0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'w' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xC0, 0x01, 0xF8, 0xC0, 0x01,
+  0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF8,
+  0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'x' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0xC1, 0xC0, 0x01,
+  0xE3, 0xC0, 0x01, 0xB6, 0xC0, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x01, 0xB6, 0xC0, 0x01, 0xE3,
+  0xC0, 0x01, 0xC1, 0xC0, 0x01, 0x80, 0xC0, 0x01, 0x80, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'y' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x30, 0x00, 0xC0, 0x30, 0x01, 0xC0, 0x30, 0x07, 0xC0, 0x30,
+  0x1E, 0xC0, 0x38, 0x78, 0xC0, 0x3E, 0xE0, 0x00, 0x37, 0xC0, 0x00, 0x31, 0xE0, 0x00, 0x00, 0x78,
+  0x00, 0x00, 0x1E, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
+  0x00, 0x00, 0x00,
+  /* 'z' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x83, 0xC0, 0x01, 0xC3, 0xC0, 0x01,
+  0xE0, 0xC0, 0x01, 0xB0, 0xC0, 0x01, 0x98, 0xC0, 0x01, 0x8C, 0xC0, 0x01, 0x86, 0xC0, 0x01, 0x83,
+  0xC0, 0x01, 0xE1, 0xC0, 0x01, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '{' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x1C, 0x00, 0x07, 0xFF, 0xF8, 0x0F, 0xF7, 0xFC, 0x0C, 0x00, 0x0C, 0x0C, 0x00,
+  0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '|' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '}' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+  0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0F, 0xF7, 0xFC, 0x07, 0xFF, 0xF8, 0x00, 0x1C, 0x00, 0x00, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '~' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1C,
+  0x00, 0x00, 0x0E, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+};
+
+sFONT Font24_Rotate90 = {
+  Font24_Rotate90_Table,
+  17, /* Width */
+  24, /* Height */
+  ROTATE_90,
+  &Font24,
+};
+
+static const uint8_t Font24_Rotate180_Table[] PROGMEM = {
+  /* ' ' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '!' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00,
+  0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '"' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x02, 0x10, 0x00,
+  0x02, 0x10, 0x00, 0x02, 0x10, 0x00, 0x07, 0x38, 0x00, 0x07, 0x38, 0x00, 0x07, 0x38, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '#' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98,
+  0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0x98, 0x00, 0x03, 0x30, 0x00, 0x0F, 0xFE, 0x00,
+  0x0F, 0xFE, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '$' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00,
+  0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x01, 0xEC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0x1C,
+  0x00, 0x06, 0x1C, 0x00, 0x06, 0x0C, 0x00, 0x07, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0x1C, 0x00, 0x07, 0x0C, 0x00, 0x07, 0x0C, 0x00, 0x07, 0xF8, 0x00, 0x06, 0xF0, 0x00, 0x00,
+  0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* '%' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x0E, 0x70, 0x00, 0x0C, 0x30,
+  0x00, 0x0C, 0x30, 0x00, 0x0E, 0x70, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xF8, 0x00,
+  0x03, 0x9C, 0x00, 0x03, 0x0C, 0x00, 0x03, 0x0C, 0x00, 0x03, 0x9C, 0x00, 0x01, 0xF8, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '&' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0x0C, 0x00, 0x07, 0x8C,
+  0x00, 0x1F, 0xDC, 0x00, 0x1C, 0xF8, 0x00, 0x00, 0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x18, 0x00, 0x03, 0x18, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ''' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00,
+  0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '(' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0E,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x01, 0xC0,
+  0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00,
+  0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0C,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ')' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00,
+  0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x78, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0,
+  0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00,
+  0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00,
+  0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '*' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00,
+  0x03, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x0E, 0xDC, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '+' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
+  0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0xC0, 0x00,
+  0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ',' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
+  0xC0, 0x00, 0x00, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '-' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '.' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '/' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00,
+  0x0C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30,
+  0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x80, 0x00,
+  0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0E,
+  0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00,
+  /* '0' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x06, 0x18, 0x00, 0x06, 0x18,
+  0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00,
+  0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x06, 0x18, 0x00, 0x06, 0x18, 0x00, 0x03, 0xF0, 0x00, 0x01,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '1' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
+  0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
+  0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xDC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '2' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x30, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00,
+  0x0C, 0x00, 0x00, 0x0C, 0x06, 0x00, 0x0C, 0x06, 0x00, 0x06, 0x0E, 0x00, 0x07, 0xFC, 0x00, 0x01,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '3' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x0E, 0x0C, 0x00, 0x0C, 0x00,
+  0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xE0, 0x00,
+  0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x07, 0x18, 0x00, 0x03, 0xF8, 0x00, 0x01,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '4' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0x00, 0x00, 0x0F, 0xFE,
+  0x00, 0x0F, 0xFE, 0x00, 0x03, 0x06, 0x00, 0x03, 0x0C, 0x00, 0x03, 0x18, 0x00, 0x03, 0x18, 0x00,
+  0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x60, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '5' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x06, 0x06, 0x00, 0x0C, 0x00,
+  0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x1C, 0x00, 0x07, 0xFC, 0x00,
+  0x01, 0xEC, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x07, 0xFC, 0x00, 0x07,
+  0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '6' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x0E, 0x18, 0x00, 0x0C, 0x0C,
+  0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x06, 0x1C, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xEC, 0x00,
+  0x00, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x0F, 0xE0, 0x00, 0x0F,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '7' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0x80,
+  0x00, 0x01, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0E, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
+  0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '8' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x0E, 0x1C, 0x00, 0x0C, 0x0C,
+  0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x06, 0x18, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00,
+  0x06, 0x18, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0E, 0x1C, 0x00, 0x07, 0xF8, 0x00, 0x03,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '9' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFC, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00,
+  0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0D, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x0E, 0x18, 0x00,
+  0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x06, 0x1C, 0x00, 0x07, 0xF8, 0x00, 0x01,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ':' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00,
+  0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ';' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00,
+  0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '<' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0,
+  0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00,
+  0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '=' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1F, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00,
+  0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '>' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00,
+  0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '?' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x60, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00,
+  0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x07, 0x0C, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '@' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x0C, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x0F, 0x0C,
+  0x00, 0x0F, 0x8C, 0x00, 0x0C, 0xCC, 0x00, 0x0C, 0xCC, 0x00, 0x0C, 0xCC, 0x00, 0x0D, 0xCC, 0x00,
+  0x0F, 0x8C, 0x00, 0x0F, 0x0C, 0x00, 0x0C, 0x18, 0x00, 0x0E, 0x38, 0x00, 0x07, 0xF0, 0x00, 0x03,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'A' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0x80, 0x7F, 0x1F, 0x80, 0x18, 0x06, 0x00, 0x18, 0x0C,
+  0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x06, 0x18, 0x00, 0x06, 0x30, 0x00, 0x06, 0x30, 0x00,
+  0x03, 0x60, 0x00, 0x03, 0x60, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'B' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x18, 0x0C, 0x00, 0x18, 0x0C,
+  0x00, 0x18, 0x0C, 0x00, 0x1C, 0x0C, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0E, 0x0C, 0x00,
+  0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0E, 0x0C, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'C' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x1C, 0x1C, 0x00, 0x18, 0x0C,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00,
+  0x18, 0x06, 0x00, 0x18, 0x0C, 0x00, 0x1C, 0x1C, 0x00, 0x1F, 0xF8, 0x00, 0x1B, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'D' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x0E, 0x0C, 0x00, 0x0C, 0x0C,
+  0x00, 0x18, 0x0C, 0x00, 0x18, 0x0C, 0x00, 0x18, 0x0C, 0x00, 0x18, 0x0C, 0x00, 0x18, 0x0C, 0x00,
+  0x18, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0E, 0x0C, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'E' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C,
+  0x00, 0x0C, 0xCC, 0x00, 0x00, 0xCC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xCC, 0x00,
+  0x0C, 0xCC, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'F' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
+  0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01, 0x98, 0x00,
+  0x19, 0x98, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'G' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x1C, 0x1C, 0x00, 0x18, 0x0E,
+  0x00, 0x18, 0x06, 0x00, 0x3F, 0x86, 0x00, 0x3F, 0x86, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00,
+  0x18, 0x06, 0x00, 0x18, 0x0C, 0x00, 0x1C, 0x1C, 0x00, 0x1F, 0xF8, 0x00, 0x1B, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'H' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C,
+  0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0C, 0x0C, 0x00,
+  0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'I' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
+  0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
+  0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'J' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x03, 0x06, 0x00, 0x06, 0x06,
+  0x00, 0x06, 0x06, 0x00, 0x06, 0x06, 0x00, 0x06, 0x06, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'K' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7F, 0x00, 0x7C, 0x7F, 0x00, 0x0E, 0x0C, 0x00, 0x06, 0x0C,
+  0x00, 0x07, 0x0C, 0x00, 0x03, 0x9C, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xEC, 0x00, 0x00, 0xCC, 0x00,
+  0x01, 0x8C, 0x00, 0x03, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x3E, 0x7F, 0x00, 0x3E, 0x7F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'L' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18,
+  0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'M' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x3F, 0x80, 0x7F, 0x3F, 0x80, 0x18, 0x06, 0x00, 0x18, 0x06,
+  0x00, 0x18, 0xC6, 0x00, 0x19, 0xE6, 0x00, 0x19, 0xE6, 0x00, 0x1B, 0x36, 0x00, 0x1B, 0x36, 0x00,
+  0x1E, 0x1E, 0x00, 0x1E, 0x1E, 0x00, 0x1C, 0x0E, 0x00, 0x7C, 0x0F, 0x80, 0x78, 0x07, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'N' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x7F, 0x00, 0x0C, 0x7F, 0x00, 0x0E, 0x0C, 0x00, 0x0F, 0x0C,
+  0x00, 0x0F, 0x8C, 0x00, 0x0D, 0x8C, 0x00, 0x0D, 0xCC, 0x00, 0x0C, 0xEC, 0x00, 0x0C, 0x6C, 0x00,
+  0x0C, 0x7C, 0x00, 0x0C, 0x3C, 0x00, 0x0C, 0x1C, 0x00, 0x3F, 0x8F, 0x00, 0x3F, 0x8F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'O' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x0E, 0x1C, 0x00, 0x0C, 0x0C,
+  0x00, 0x1C, 0x0E, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00,
+  0x1C, 0x0E, 0x00, 0x0C, 0x0C, 0x00, 0x0E, 0x1C, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'P' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x18, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0C, 0x18, 0x00, 0x18, 0x18, 0x00,
+  0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x1C, 0x18, 0x00, 0x0F, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'Q' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x18, 0x00, 0x1F,
+  0xF8, 0x00, 0x19, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x0E, 0x1C, 0x00, 0x0C, 0x0C,
+  0x00, 0x1C, 0x0E, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00,
+  0x1C, 0x0E, 0x00, 0x0C, 0x0C, 0x00, 0x0E, 0x1C, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'R' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x7F, 0x00, 0x3C, 0x7F, 0x00, 0x0E, 0x0C, 0x00, 0x06, 0x0C,
+  0x00, 0x07, 0x0C, 0x00, 0x03, 0x8C, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0E, 0x0C, 0x00,
+  0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0E, 0x0C, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'S' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEC, 0x00, 0x07, 0xFC, 0x00, 0x0E, 0x1C, 0x00, 0x0C, 0x0C,
+  0x00, 0x0C, 0x0C, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3C, 0x00,
+  0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0E, 0x1C, 0x00, 0x0F, 0xF8, 0x00, 0x0D, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'T' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
+  0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x18, 0xC6, 0x00,
+  0x18, 0xC6, 0x00, 0x18, 0xC6, 0x00, 0x18, 0xC6, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'U' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x06, 0x18, 0x00, 0x0C, 0x0C,
+  0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00,
+  0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'V' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x60,
+  0x00, 0x03, 0x60, 0x00, 0x03, 0x60, 0x00, 0x06, 0x30, 0x00, 0x06, 0x30, 0x00, 0x0C, 0x18, 0x00,
+  0x0C, 0x18, 0x00, 0x0C, 0x18, 0x00, 0x18, 0x0C, 0x00, 0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'W' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x18, 0x00, 0x0C, 0x18, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38,
+  0x00, 0x1F, 0x3C, 0x00, 0x1B, 0x6C, 0x00, 0x1B, 0x6C, 0x00, 0x19, 0xCC, 0x00, 0x19, 0xCC, 0x00,
+  0x30, 0x86, 0x00, 0x30, 0x06, 0x00, 0x30, 0x06, 0x00, 0xFE, 0x3F, 0x80, 0xFE, 0x3F, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'X' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x00, 0x0C, 0x0C, 0x00, 0x06, 0x18,
+  0x00, 0x03, 0x30, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x01, 0xE0, 0x00,
+  0x03, 0x30, 0x00, 0x06, 0x18, 0x00, 0x0C, 0x0C, 0x00, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'Y' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
+  0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0x30, 0x00,
+  0x03, 0x30, 0x00, 0x06, 0x18, 0x00, 0x0C, 0x0C, 0x00, 0x3F, 0x1F, 0x00, 0x3F, 0x1F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'Z' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x0C, 0x06, 0x00, 0x0C, 0x0C,
+  0x00, 0x0C, 0x18, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x8C, 0x00,
+  0x03, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '[' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x07,
+  0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
+  0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
+  0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '\\' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C,
+  0x00, 0x00, 0x0E, 0x00, 0x00, 0x06, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x60, 0x00,
+  0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00,
+  0x1C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00,
+  /* ']' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
+  0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
+  0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '^' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00,
+  0x18, 0x0C, 0x00, 0x0C, 0x18, 0x00, 0x06, 0x30, 0x00, 0x07, 0x70, 0x00, 0x03, 0xE0, 0x00, 0x01,
+  0xC0, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+  /* '_' */
+  0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '`' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
+  0xE0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
+  /* 'a' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0x06, 0x00, 0x06, 0x06,
+  0x00, 0x06, 0x0E, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00,
+  0x03, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'b' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0x00, 0x0F, 0xFF, 0x00, 0x0C, 0x1C, 0x00, 0x18, 0x0C,
+  0x00, 0x18, 0x0C, 0x00, 0x18, 0x0C, 0x00, 0x18, 0x0C, 0x00, 0x18, 0x0C, 0x00, 0x0C, 0x1C, 0x00,
+  0x0F, 0xFC, 0x00, 0x03, 0xEC, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0F, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'c' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x1C, 0x1C, 0x00, 0x18, 0x0E,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x0E, 0x00, 0x1C, 0x1C, 0x00,
+  0x1F, 0xF8, 0x00, 0x1B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'd' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0E, 0x0C, 0x00, 0x0C, 0x06,
+  0x00, 0x0C, 0x06, 0x00, 0x0C, 0x06, 0x00, 0x0C, 0x06, 0x00, 0x0C, 0x06, 0x00, 0x0E, 0x0C, 0x00,
+  0x0F, 0xFC, 0x00, 0x0D, 0xF0, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'e' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x18, 0x0C, 0x00, 0x00, 0x06,
+  0x00, 0x00, 0x06, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x18, 0x06, 0x00, 0x0C, 0x0C, 0x00,
+  0x0F, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'f' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30,
+  0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00,
+  0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x1F, 0xE0, 0x00, 0x1F,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'g' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x0E, 0x00, 0x00, 0x0C,
+  0x00, 0x00, 0x0C, 0x00, 0x00, 0x0D, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x0E, 0x0C, 0x00, 0x0C, 0x06,
+  0x00, 0x0C, 0x06, 0x00, 0x0C, 0x06, 0x00, 0x0C, 0x06, 0x00, 0x0C, 0x06, 0x00, 0x0E, 0x0C, 0x00,
+  0x3F, 0xFC, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'h' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C,
+  0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0E, 0x1C, 0x00,
+  0x07, 0xFC, 0x00, 0x03, 0xEC, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0F, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'i' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
+  0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
+  0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'j' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0x00, 0x00, 0x06,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00,
+  0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'k' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1E, 0x00, 0x1F, 0x1E, 0x00, 0x03, 0x98, 0x00, 0x01, 0xD8,
+  0x00, 0x00, 0xF8, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xD8, 0x00, 0x01, 0x98, 0x00,
+  0x0F, 0x98, 0x00, 0x0F, 0x98, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1E, 0x00, 0x00,
+  0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'l' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
+  0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
+  0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
+  0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'm' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xDF, 0x80, 0x7B, 0xDF, 0x80, 0x18, 0xC6, 0x00, 0x18, 0xC6,
+  0x00, 0x18, 0xC6, 0x00, 0x18, 0xC6, 0x00, 0x18, 0xC6, 0x00, 0x18, 0xC6, 0x00, 0x19, 0xCE, 0x00,
+  0x1F, 0xFF, 0x80, 0x0F, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'n' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C,
+  0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0E, 0x1C, 0x00,
+  0x07, 0xFF, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'o' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x0E, 0x1C, 0x00, 0x1C, 0x0E,
+  0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0x1C, 0x0E, 0x00, 0x0E, 0x1C, 0x00,
+  0x07, 0xF8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'p' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0C, 0x00, 0x00,
+  0x0C, 0x00, 0x00, 0x0C, 0x00, 0x03, 0xEC, 0x00, 0x0F, 0xFC, 0x00, 0x0C, 0x1C, 0x00, 0x18, 0x0C,
+  0x00, 0x18, 0x0C, 0x00, 0x18, 0x0C, 0x00, 0x18, 0x0C, 0x00, 0x18, 0x0C, 0x00, 0x0C, 0x1C, 0x00,
+  0x0F, 0xFF, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'q' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x0C, 0x00, 0x00, 0x0C,
+  0x00, 0x00, 0x0C, 0x00, 0x00, 0x0D, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x0E, 0x0C, 0x00, 0x0C, 0x06,
+  0x00, 0x0C, 0x06, 0x00, 0x0C, 0x06, 0x00, 0x0C, 0x06, 0x00, 0x0C, 0x06, 0x00, 0x0E, 0x0C, 0x00,
+  0x3F, 0xFC, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'r' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30,
+  0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x19, 0xF0, 0x00,
+  0x1F, 0xBE, 0x00, 0x0F, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 's' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0E, 0x0C, 0x00, 0x0C, 0x0C,
+  0x00, 0x0F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00,
+  0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 't' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x1C, 0x18, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
+  0x07, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'u' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x0E, 0x0C, 0x00, 0x0C, 0x0C,
+  0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00,
+  0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'v' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0x30,
+  0x00, 0x03, 0x30, 0x00, 0x06, 0x18, 0x00, 0x06, 0x18, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00,
+  0x3E, 0x1F, 0x00, 0x3E, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'w' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0x00, 0x03, 0x18, 0x00, 0x03, 0x1C, 0x00, 0x07, 0xBC,
+  0x00, 0x07, 0xBC, 0x00, 0x06, 0xAC, 0x00, 0x0C, 0xE6, 0x00, 0x0C, 0xE6, 0x00, 0x0C, 0x46, 0x00,
+  0x1E, 0x0F, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'x' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x3E, 0x00, 0x1F, 0x3E, 0x00, 0x06, 0x18, 0x00, 0x03, 0x30,
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0x30, 0x00, 0x06, 0x18, 0x00,
+  0x1F, 0x3E, 0x00, 0x1F, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'y' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x60, 0x00, 0x00,
+  0xC0, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0x60,
+  0x00, 0x06, 0x30, 0x00, 0x06, 0x30, 0x00, 0x0C, 0x18, 0x00, 0x0C, 0x18, 0x00, 0x18, 0x0C, 0x00,
+  0x7C, 0x3F, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'z' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0C, 0x18, 0x00, 0x0C, 0x30,
+  0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x03, 0x0C, 0x00, 0x06, 0x0C, 0x00,
+  0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '{' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03,
+  0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
+  0x00, 0x00, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
+  0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '|' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00,
+  0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
+  0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
+  0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '}' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
+  0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
+  0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '~' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x80, 0x00, 0x07, 0xC6, 0x00, 0x0E, 0xEE, 0x00, 0x0C, 0x7C, 0x00, 0x00, 0x38, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+sFONT Font24_Rotate180 = {
+  Font24_Rotate180_Table,
+  17, /* Width */
+  24, /* Height */
+  ROTATE_180,
+  &Font24,
+};
+
+static const uint8_t Font24_Rotate270_Table[] PROGMEM = {
+  /* ' ' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '!' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE1, 0x80, 0x3F, 0xF9, 0x80, 0x3F, 0xE1,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '"' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C,
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00,
+  0x00, 0x1F, 0xC0, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '#' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x00, 0x01,
+  0x98, 0x00, 0x3F, 0xD8, 0x00, 0x3F, 0xFF, 0xC0, 0x01, 0xBF, 0xC0, 0x01, 0x98, 0x00, 0x3F, 0xD8,
+  0x00, 0x3F, 0xFF, 0xC0, 0x01, 0xBF, 0xC0, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '$' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
+  0x3C, 0x00, 0x1E, 0x7E, 0x00, 0x0E, 0x67, 0x00, 0x78, 0xE3, 0xF0, 0x78, 0xC3, 0xF0, 0x18, 0xC3,
+  0x00, 0x19, 0xCE, 0x00, 0x0F, 0x9F, 0x00, 0x07, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '%' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0x00, 0x00,
+  0xBF, 0x00, 0x0F, 0xF3, 0x80, 0x1F, 0xE1, 0x80, 0x39, 0xE1, 0x80, 0x30, 0xF3, 0x80, 0x30, 0xFF,
+  0x00, 0x39, 0xFE, 0x00, 0x1F, 0xA0, 0x00, 0x0F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '&' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x80, 0x00, 0x19, 0x80, 0x0C,
+  0x1F, 0x80, 0x0E, 0x0F, 0x00, 0x0E, 0x0F, 0x80, 0x0C, 0x1D, 0x80, 0x0C, 0x39, 0x80, 0x0C, 0x71,
+  0x80, 0x07, 0xF9, 0x80, 0x03, 0x9F, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* ''' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1C, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '(' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x3C,
+  0x00, 0xF0, 0x1F, 0x03, 0xE0, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* ')' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x0F, 0xFF,
+  0xC0, 0x1F, 0x03, 0xE0, 0x3C, 0x00, 0xF0, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '*' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06,
+  0x00, 0x00, 0x07, 0x30, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF0,
+  0x00, 0x07, 0x30, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '+' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x60,
+  0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* ',' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '-' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60,
+  0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '.' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '/' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1F,
+  0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '0' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x0F,
+  0xFE, 0x00, 0x1C, 0x07, 0x00, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01,
+  0x80, 0x1C, 0x07, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '1' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
+  0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x3F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01,
+  0x80, 0x1C, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '2' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x80, 0x1F,
+  0x81, 0x80, 0x18, 0xC1, 0x80, 0x30, 0x61, 0x80, 0x30, 0x31, 0x80, 0x30, 0x31, 0x80, 0x30, 0x19,
+  0x80, 0x30, 0x0D, 0x80, 0x18, 0x07, 0x80, 0x1E, 0x03, 0x80, 0x0E, 0x01, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '3' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x0E,
+  0x3F, 0x00, 0x1F, 0x63, 0x00, 0x39, 0xE1, 0x80, 0x30, 0xC1, 0x80, 0x30, 0xC1, 0x80, 0x30, 0xC1,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '4' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x80, 0x00,
+  0x0D, 0x80, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x38, 0x0D, 0x80, 0x1C, 0x0D, 0x80, 0x07, 0x0D,
+  0x80, 0x03, 0xCC, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '5' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x30,
+  0xFF, 0x00, 0x30, 0xC3, 0x00, 0x31, 0x81, 0x80, 0x31, 0x81, 0x80, 0x31, 0x81, 0x80, 0x31, 0x81,
+  0x80, 0x30, 0xC1, 0x80, 0x3F, 0xC1, 0x80, 0x3F, 0xC3, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '6' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x1E, 0x00, 0x30,
+  0x7F, 0x00, 0x30, 0x63, 0x80, 0x30, 0xC1, 0x80, 0x30, 0xC1, 0x80, 0x18, 0xC1, 0x80, 0x1C, 0xC1,
+  0x80, 0x0E, 0x63, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '7' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3F,
+  0x80, 0x00, 0x37, 0xF0, 0x00, 0x30, 0xFE, 0x00, 0x30, 0x1F, 0x80, 0x30, 0x03, 0x80, 0x30, 0x00,
+  0x00, 0x30, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '8' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x1E, 0x00, 0x1F,
+  0x3F, 0x00, 0x39, 0xE3, 0x80, 0x30, 0xC1, 0x80, 0x30, 0xC1, 0x80, 0x30, 0xC1, 0x80, 0x30, 0xC1,
+  0x80, 0x39, 0xE3, 0x80, 0x1F, 0x3F, 0x00, 0x0E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '9' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x1F,
+  0xFC, 0x00, 0x18, 0xCE, 0x00, 0x30, 0x67, 0x00, 0x30, 0x63, 0x00, 0x30, 0x61, 0x80, 0x30, 0x61,
+  0x80, 0x38, 0xC1, 0x80, 0x1F, 0xC1, 0x80, 0x0F, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* ':' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x83, 0x80, 0x03, 0x83, 0x80, 0x03, 0x83, 0x80, 0x03, 0x83,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* ';' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x80, 0x00, 0x03, 0x84, 0x00, 0x03, 0x86, 0x00, 0x03, 0x87, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '<' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x0E,
+  0x03, 0x80, 0x06, 0x03, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x01, 0x8C, 0x00, 0x01, 0x8C,
+  0x00, 0x00, 0xD8, 0x00, 0x00, 0xD8, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x20, 0x00,
+  0x00, 0x20, 0x00,
+  /* '=' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01,
+  0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98,
+  0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00,
+  0x00, 0x00, 0x00,
+  /* '>' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x70, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0xD8, 0x00, 0x00, 0xD8, 0x00, 0x01, 0x8C, 0x00, 0x01, 0x8C, 0x00, 0x03, 0x06,
+  0x00, 0x03, 0x06, 0x00, 0x06, 0x03, 0x00, 0x0E, 0x03, 0x80, 0x0C, 0x01, 0x80, 0x0C, 0x01, 0x80,
+  0x00, 0x00, 0x00,
+  /* '?' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x80, 0x00, 0x0F, 0xC0, 0x00, 0x1C, 0xE0, 0x00, 0x18, 0x70, 0x00, 0x18, 0x39, 0x80, 0x18, 0x39,
+  0x80, 0x18, 0x01, 0x80, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '@' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xC0, 0x1F,
+  0xFC, 0xC0, 0x3B, 0x0C, 0x60, 0x33, 0x8C, 0x60, 0x31, 0xF8, 0x60, 0x30, 0xF0, 0x60, 0x38, 0x00,
+  0xE0, 0x1C, 0x01, 0xC0, 0x0F, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'A' */
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x07, 0x80, 0x00, 0x1F, 0x80, 0x00,
+  0xF9, 0x80, 0x03, 0xF9, 0x80, 0x0F, 0x19, 0x80, 0x1C, 0x18, 0x00, 0x1F, 0x18, 0x00, 0x1B, 0xD8,
+  0x00, 0x18, 0xF9, 0x80, 0x18, 0x3D, 0x80, 0x18, 0x0F, 0x80, 0x00, 0x03, 0x80, 0x00, 0x01, 0x80,
+  0x00, 0x01, 0x80,
+  /* 'B' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x07, 0xBF, 0x00, 0x0F,
+  0xF1, 0x80, 0x1C, 0xE1, 0x80, 0x18, 0x61, 0x80, 0x18, 0x61, 0x80, 0x18, 0x61, 0x80, 0x18, 0x61,
+  0x80, 0x18, 0x61, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x00, 0x00, 0x00,
+  /* 'C' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x06, 0x00, 0x1F, 0x07, 0x00, 0x0C,
+  0x03, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x0C, 0x03, 0x00, 0x0E, 0x07, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'D' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x0E,
+  0x07, 0x00, 0x0C, 0x03, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x00, 0x00, 0x00,
+  /* 'E' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x0F, 0x80, 0x1F,
+  0x0F, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x19, 0xF9, 0x80, 0x19, 0xF9, 0x80, 0x18, 0x61,
+  0x80, 0x18, 0x61, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x00, 0x00, 0x00,
+  /* 'F' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x19, 0xF9, 0x80, 0x19, 0xF9, 0x80, 0x18, 0x61, 0x80, 0x18, 0x61,
+  0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'G' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x1F, 0x3F, 0x00, 0x1F, 0x3F, 0x00, 0x0C,
+  0x33, 0x80, 0x18, 0x31, 0x80, 0x18, 0x31, 0x80, 0x18, 0x31, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x0C, 0x03, 0x00, 0x0E, 0x07, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'H' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F,
+  0xFF, 0x80, 0x18, 0x61, 0x80, 0x18, 0x61, 0x80, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x18, 0x61,
+  0x80, 0x18, 0x61, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x00, 0x00, 0x00,
+  /* 'I' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'J' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1F,
+  0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x18, 0x03, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'K' */
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x03, 0x80, 0x1C,
+  0x0F, 0x80, 0x1E, 0x1E, 0x00, 0x03, 0x38, 0x00, 0x01, 0xF0, 0x00, 0x18, 0xE1, 0x80, 0x18, 0x61,
+  0x80, 0x18, 0x31, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x00, 0x00, 0x00,
+  /* 'L' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00,
+  0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x00, 0x00, 0x00,
+  /* 'M' */
+  0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x0F,
+  0x01, 0x80, 0x03, 0xC1, 0x80, 0x00, 0xF1, 0x80, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0xF1,
+  0x80, 0x03, 0xC1, 0x80, 0x0F, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80,
+  0x18, 0x01, 0x80,
+  /* 'N' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x1F,
+  0xFF, 0x80, 0x18, 0x0E, 0x00, 0x18, 0x3C, 0x00, 0x18, 0x78, 0x00, 0x01, 0xE1, 0x80, 0x03, 0xC1,
+  0x80, 0x07, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x00, 0x00, 0x00,
+  /* 'O' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x0F,
+  0x0F, 0x00, 0x0C, 0x03, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x0C, 0x03, 0x00, 0x0F, 0x0F, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'P' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x1C,
+  0x60, 0x00, 0x18, 0x30, 0x00, 0x18, 0x31, 0x80, 0x18, 0x31, 0x80, 0x18, 0x31, 0x80, 0x18, 0x31,
+  0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'Q' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x60, 0x07, 0xFE, 0x70, 0x0F,
+  0x0F, 0x30, 0x0C, 0x03, 0x30, 0x18, 0x01, 0xE0, 0x18, 0x01, 0xE0, 0x18, 0x01, 0xE0, 0x18, 0x01,
+  0xE0, 0x0C, 0x03, 0xF0, 0x0F, 0x0F, 0x30, 0x07, 0xFE, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'R' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x07, 0x83, 0x80, 0x0F,
+  0xCF, 0x00, 0x1C, 0xDE, 0x00, 0x18, 0x78, 0x00, 0x18, 0x70, 0x00, 0x18, 0x61, 0x80, 0x18, 0x61,
+  0x80, 0x18, 0x61, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x00, 0x00, 0x00,
+  /* 'S' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1E, 0x00, 0x1F,
+  0x3F, 0x00, 0x0C, 0x33, 0x80, 0x18, 0x71, 0x80, 0x18, 0x61, 0x80, 0x18, 0x61, 0x80, 0x18, 0xE1,
+  0x80, 0x1C, 0xC3, 0x00, 0x0F, 0xCF, 0x80, 0x07, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'T' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'U' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x1F,
+  0xFF, 0x00, 0x18, 0x03, 0x00, 0x18, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x18, 0x03, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'V' */
+  0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1B,
+  0xE0, 0x00, 0x18, 0x7C, 0x00, 0x18, 0x1F, 0x00, 0x00, 0x03, 0x80, 0x18, 0x1F, 0x00, 0x18, 0x7C,
+  0x00, 0x1B, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x1C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'W' */
+  0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x18, 0xFF, 0x80, 0x18,
+  0x0F, 0x80, 0x18, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x18, 0x3E,
+  0x00, 0x18, 0x0F, 0x80, 0x18, 0xFF, 0x80, 0x1F, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x18, 0x00, 0x00,
+  0x18, 0x00, 0x00,
+  /* 'X' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1C, 0x03, 0x80, 0x1E,
+  0x07, 0x80, 0x1B, 0x0D, 0x80, 0x19, 0x99, 0x80, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x19, 0x99,
+  0x80, 0x1B, 0x0D, 0x80, 0x1E, 0x07, 0x80, 0x1C, 0x03, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+  0x00, 0x00, 0x00,
+  /* 'Y' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1E,
+  0x01, 0x80, 0x1B, 0x81, 0x80, 0x19, 0xC1, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x01, 0xC1,
+  0x80, 0x1B, 0x81, 0x80, 0x1E, 0x01, 0x80, 0x1C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'Z' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1F, 0x80, 0x1E,
+  0x1F, 0x80, 0x1B, 0x01, 0x80, 0x19, 0x81, 0x80, 0x18, 0xC1, 0x80, 0x18, 0x61, 0x80, 0x18, 0x31,
+  0x80, 0x18, 0x19, 0x80, 0x1F, 0x8D, 0x80, 0x1F, 0x87, 0x80, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '[' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+  0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x00, 0x30, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '\\' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
+  0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x80,
+  0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* ']' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x30, 0x00,
+  0x30, 0x30, 0x00, 0x30, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '^' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x0E,
+  0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00,
+  0x00, 0x0E, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '_' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x03,
+  /* '`' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'a' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00,
+  0xFF, 0x80, 0x01, 0xFF, 0x80, 0x03, 0x33, 0x00, 0x03, 0x31, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31,
+  0x80, 0x03, 0x31, 0x80, 0x03, 0x19, 0x80, 0x01, 0x1F, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'b' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0x01,
+  0x83, 0x00, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01,
+  0x80, 0x01, 0x83, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80,
+  0x00, 0x00, 0x00,
+  /* 'c' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE6, 0x00, 0x03, 0xE7, 0x00, 0x01,
+  0x83, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01,
+  0x80, 0x01, 0x83, 0x00, 0x01, 0xC7, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'd' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x3F, 0xFF, 0x80, 0x3F,
+  0xFF, 0x80, 0x31, 0x83, 0x00, 0x33, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01,
+  0x80, 0x03, 0x01, 0x80, 0x01, 0x83, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'e' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x00, 0x01, 0xF3, 0x00, 0x01,
+  0xB1, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31,
+  0x80, 0x03, 0x31, 0x80, 0x01, 0xB3, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'f' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33,
+  0x01, 0x80, 0x33, 0x01, 0x80, 0x33, 0x01, 0x80, 0x33, 0x01, 0x80, 0x33, 0x01, 0x80, 0x1F, 0xFF,
+  0x80, 0x0F, 0xFF, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'g' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x03,
+  0xFF, 0xF8, 0x01, 0x83, 0x18, 0x03, 0x01, 0x8C, 0x03, 0x01, 0x8C, 0x03, 0x01, 0x8C, 0x03, 0x01,
+  0x8C, 0x03, 0x01, 0x8C, 0x01, 0x83, 0x0C, 0x01, 0xFF, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'h' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0xFF, 0x80, 0x01,
+  0xFF, 0x80, 0x03, 0x81, 0x80, 0x03, 0x01, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x01,
+  0x80, 0x01, 0x81, 0x80, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80,
+  0x00, 0x00, 0x00,
+  /* 'i' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00,
+  0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x33, 0xFF, 0x80, 0x33, 0xFF, 0x80, 0x03, 0x01,
+  0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'j' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xFF, 0xF0, 0x03, 0xFF, 0xF8, 0x33, 0x00, 0x18, 0x33, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00,
+  0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'k' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03,
+  0x01, 0x80, 0x03, 0x03, 0x80, 0x03, 0x87, 0x80, 0x03, 0xEE, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x38,
+  0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'l' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00,
+  0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x30, 0x01,
+  0x80, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'm' */
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03,
+  0x00, 0x00, 0x03, 0x01, 0x80, 0x03, 0x81, 0x80, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0x00,
+  0x00, 0x03, 0x01, 0x80, 0x01, 0x81, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0x01, 0x80,
+  0x03, 0x01, 0x80,
+  /* 'n' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0xFF, 0x80, 0x01,
+  0xFF, 0x80, 0x03, 0x81, 0x80, 0x03, 0x01, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x01,
+  0x80, 0x01, 0x81, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80,
+  0x00, 0x00, 0x00,
+  /* 'o' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFE, 0x00, 0x01,
+  0xC7, 0x00, 0x01, 0x83, 0x00, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01,
+  0x80, 0x01, 0x83, 0x00, 0x01, 0xC7, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'p' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0x01,
+  0x83, 0x00, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x8C, 0x03, 0x01,
+  0x8C, 0x01, 0x83, 0x0C, 0x03, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C,
+  0x00, 0x00, 0x00,
+  /* 'q' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0xFF, 0xFC, 0x03,
+  0xFF, 0xFC, 0x01, 0x83, 0x0C, 0x03, 0x01, 0x8C, 0x03, 0x01, 0x8C, 0x03, 0x01, 0x80, 0x03, 0x01,
+  0x80, 0x03, 0x01, 0x80, 0x01, 0x83, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'r' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03,
+  0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x81, 0x80, 0x01, 0x81, 0x80, 0x00, 0xC1, 0x80, 0x03, 0xFF,
+  0x80, 0x03, 0xFF, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 's' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCE, 0x00, 0x03,
+  0xDF, 0x00, 0x03, 0x1B, 0x80, 0x03, 0x19, 0x80, 0x03, 0x39, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31,
+  0x80, 0x03, 0x31, 0x80, 0x01, 0xF7, 0x80, 0x00, 0xE7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 't' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x03,
+  0x03, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01,
+  0x80, 0x3F, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'u' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x03, 0xFF, 0x80, 0x03,
+  0xFF, 0x80, 0x03, 0x03, 0x00, 0x03, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01,
+  0x80, 0x00, 0x01, 0x80, 0x03, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'v' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x03,
+  0xF0, 0x00, 0x03, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x0F,
+  0x80, 0x03, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'w' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x03,
+  0xFC, 0x00, 0x03, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x7C,
+  0x00, 0x00, 0x0F, 0x80, 0x03, 0x1F, 0x80, 0x03, 0xFE, 0x00, 0x03, 0xE0, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'x' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03,
+  0x83, 0x80, 0x03, 0xC7, 0x80, 0x03, 0x6D, 0x80, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x03, 0x6D,
+  0x80, 0x03, 0xC7, 0x80, 0x03, 0x83, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'y' */
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x03,
+  0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x8C, 0x00, 0x03, 0xEC, 0x00, 0x07, 0x7C, 0x03, 0x1E,
+  0x1C, 0x03, 0x78, 0x0C, 0x03, 0xE0, 0x0C, 0x03, 0x80, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'z' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x80, 0x03,
+  0x87, 0x80, 0x03, 0xC1, 0x80, 0x03, 0x61, 0x80, 0x03, 0x31, 0x80, 0x03, 0x19, 0x80, 0x03, 0x0D,
+  0x80, 0x03, 0x07, 0x80, 0x03, 0xC3, 0x80, 0x03, 0xC1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '{' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x30, 0x00, 0x30, 0x30, 0x00, 0x30, 0x3F, 0xEF, 0xF0, 0x1F, 0xFF, 0xE0, 0x00, 0x38,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '|' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '}' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x38, 0x00, 0x1F, 0xFF, 0xE0, 0x3F, 0xEF, 0xF0, 0x30, 0x00,
+  0x30, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* '~' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0,
+  0x00, 0x00, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+};
+
+sFONT Font24_Rotate270 = {
+  Font24_Rotate270_Table,
+  17, /* Width */
+  24, /* Height */
+  ROTATE_270,
+  &Font24,
+};
@@ -0,0 +1,31 @@
+/* Generated by tools/make_rotated_fonts.cpp - do not edit */
+
+#ifndef __FONTS_ROTATED_H
+#define __FONTS_ROTATED_H
+
+#include "fonts.h"
+
+/* Fonts laid out for one Paint rotation - use FontNN_RotateRR at that rotation and a glyph
+   is a single BitBlt. At any other rotation they draw like FontNN */
+
+extern sFONT Font8_Rotate90;
+extern sFONT Font8_Rotate180;
+extern sFONT Font8_Rotate270;
+
+extern sFONT Font12_Rotate90;
+extern sFONT Font12_Rotate180;
+extern sFONT Font12_Rotate270;
+
+extern sFONT Font16_Rotate90;
+extern sFONT Font16_Rotate180;
+extern sFONT Font16_Rotate270;
+
+extern sFONT Font20_Rotate90;
+extern sFONT Font20_Rotate180;
+extern sFONT Font20_Rotate270;
+
+extern sFONT Font24_Rotate90;
+extern sFONT Font24_Rotate180;
+extern sFONT Font24_Rotate270;
+
+#endif /* __FONTS_ROTATED_H */
@@ -0,0 +1,302 @@
+/* Generated by tools/make_proportional_fonts.cpp - do not edit */
+
+#include <pgmspace.h>
+#include "pfonts.h"
+
+static const uint8_t PFont12_Bitmaps[] PROGMEM = {
+  /* ' ' */
+  /* '!' */
+  0x7C, 0x80,
+  /* '"' */
+  0x06, 0xE5, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '#' */
+  0x01, 0x4A, 0xAF, 0xAB, 0xEA, 0xA5, 0x00, 0x00,
+  /* '$' */
+  0x02, 0x78, 0x87, 0x9E, 0x22, 0x00,
+  /* '%' */
+  0x02, 0x28, 0x81, 0xF0, 0x45, 0x10, 0x00, 0x00,
+  /* '&' */
+  0x00, 0x00, 0x64, 0x22, 0xB2, 0x68, 0x00, 0x00,
+  /* ''' */
+  0x78, 0x00,
+  /* '(' */
+  0x16, 0xAA, 0x94,
+  /* ')' */
+  0x29, 0x55, 0x68,
+  /* '*' */
+  0x01, 0x3E, 0x45, 0x28, 0x00, 0x00, 0x00, 0x00,
+  /* '+' */
+  0x00, 0x00, 0x40, 0x81, 0x1F, 0xC4, 0x08, 0x10, 0x00, 0x00, 0x00,
+  /* ',' */
+  0x00, 0x00, 0x03, 0x5A, 0x00,
+  /* '-' */
+  0x18, 0x84, 0x1D,
+  /* '.' */
+  0x00, 0x03, 0xC0,
+  /* '/' */
+  0x00, 0x42, 0x21, 0x10, 0x88, 0x44, 0x00, 0x00,
+  /* '0' */
+  0x03, 0xA3, 0x18, 0xC6, 0x31, 0x70, 0x00, 0x00,
+  /* '1' */
+  0x03, 0x08, 0x42, 0x10, 0x84, 0xF8, 0x00, 0x00,
+  /* '2' */
+  0x03, 0xA2, 0x11, 0x11, 0x11, 0xF8, 0x00, 0x00,
+  /* '3' */
+  0x03, 0xA2, 0x13, 0x04, 0x31, 0x70, 0x00, 0x00,
+  /* '4' */
+  0x00, 0x62, 0x8A, 0x4A, 0x2F, 0xC2, 0x1C, 0x00, 0x00,
+  /* '5' */
+  0x03, 0xD0, 0x87, 0x04, 0x31, 0x70, 0x00, 0x00,
+  /* '6' */
+  0x01, 0xD1, 0x0F, 0x46, 0x31, 0x70, 0x00, 0x00,
+  /* '7' */
+  0x07, 0xE2, 0x11, 0x08, 0x44, 0x20, 0x00, 0x00,
+  /* '8' */
+  0x03, 0xA3, 0x17, 0x46, 0x31, 0x70, 0x00, 0x00,
+  /* '9' */
+  0x03, 0xA3, 0x18, 0xBC, 0x22, 0xE0, 0x00, 0x00,
+  /* ':' */
+  0x03, 0xC3, 0xC0,
+  /* ';' */
+  0x00, 0x36, 0x03, 0xD0, 0x00,
+  /* '<' */
+  0x00, 0x00, 0xC4, 0x62, 0x06, 0x04, 0x0C, 0x00, 0x00,
+  /* '=' */
+  0x13, 0x84, 0x04, 0x84, 0x18,
+  /* '>' */
+  0x00, 0x0C, 0x08, 0x18, 0x11, 0x88, 0xC0, 0x00, 0x00,
+  /* '?' */
+  0x00, 0x69, 0x12, 0x40, 0xC0, 0x00,
+  /* '@' */
+  0x74, 0x63, 0x3A, 0xD6, 0x70, 0x8B, 0x80, 0x00,
+  /* 'A' */
+  0x00, 0x60, 0x41, 0x42, 0x85, 0x1F, 0x22, 0xEE, 0x00, 0x00, 0x00,
+  /* 'B' */
+  0x03, 0xE4, 0x51, 0x79, 0x14, 0x51, 0xF8, 0x00, 0x00,
+  /* 'C' */
+  0x03, 0xE3, 0x08, 0x42, 0x11, 0x70, 0x00, 0x00,
+  /* 'D' */
+  0x03, 0xC4, 0x91, 0x45, 0x14, 0x52, 0xF0, 0x00, 0x00,
+  /* 'E' */
+  0x03, 0xF4, 0x54, 0x71, 0x44, 0x11, 0xFC, 0x00, 0x00,
+  /* 'F' */
+  0x03, 0xF4, 0x54, 0x71, 0x44, 0x10, 0xE0, 0x00, 0x00,
+  /* 'G' */
+  0x01, 0xE8, 0xA0, 0x82, 0x78, 0xA2, 0x70, 0x00, 0x00,
+  /* 'H' */
+  0x01, 0xDD, 0x12, 0x27, 0xC8, 0x91, 0x22, 0xEE, 0x00, 0x00, 0x00,
+  /* 'I' */
+  0x07, 0xC8, 0x42, 0x10, 0x84, 0xF8, 0x00, 0x00,
+  /* 'J' */
+  0x03, 0xC4, 0x21, 0x4A, 0x52, 0x60, 0x00, 0x00,
+  /* 'K' */
+  0x01, 0xDD, 0x12, 0x45, 0x0E, 0x12, 0x22, 0xE6, 0x00, 0x00, 0x00,
+  /* 'L' */
+  0x07, 0x10, 0x84, 0x21, 0x29, 0xF8, 0x00, 0x00,
+  /* 'M' */
+  0x01, 0xDD, 0xB3, 0x65, 0x4A, 0x91, 0x22, 0xEE, 0x00, 0x00, 0x00,
+  /* 'N' */
+  0x01, 0xDD, 0x93, 0x25, 0x4A, 0x95, 0x26, 0xEC, 0x00, 0x00, 0x00,
+  /* 'O' */
+  0x03, 0xA3, 0x18, 0xC6, 0x31, 0x70, 0x00, 0x00,
+  /* 'P' */
+  0x07, 0x92, 0x94, 0xB9, 0x08, 0xE0, 0x00, 0x00,
+  /* 'Q' */
+  0x03, 0xA3, 0x18, 0xC6, 0x31, 0x71, 0xC0, 0x00,
+  /* 'R' */
+  0x01, 0xF1, 0x12, 0x24, 0x4F, 0x12, 0x22, 0xE2, 0x00, 0x00, 0x00,
+  /* 'S' */
+  0x03, 0x67, 0x07, 0x04, 0x39, 0xB0, 0x00, 0x00,
+  /* 'T' */
+  0x01, 0xFE, 0x48, 0x81, 0x02, 0x04, 0x08, 0x38, 0x00, 0x00, 0x00,
+  /* 'U' */
+  0x01, 0xDD, 0x12, 0x24, 0x48, 0x91, 0x22, 0x38, 0x00, 0x00, 0x00,
+  /* 'V' */
+  0x01, 0xDD, 0x12, 0x22, 0x85, 0x0A, 0x08, 0x10, 0x00, 0x00, 0x00,
+  /* 'W' */
+  0x01, 0xDD, 0x12, 0x25, 0x4A, 0x95, 0x2A, 0x28, 0x00, 0x00, 0x00,
+  /* 'X' */
+  0x01, 0x8D, 0x11, 0x41, 0x02, 0x0A, 0x22, 0xC6, 0x00, 0x00, 0x00,
+  /* 'Y' */
+  0x01, 0xDD, 0x11, 0x42, 0x82, 0x04, 0x08, 0x38, 0x00, 0x00, 0x00,
+  /* 'Z' */
+  0x07, 0xE2, 0x22, 0x11, 0x11, 0xF8, 0x00, 0x00,
+  /* '[' */
+  0x1E, 0x49, 0x24, 0x93, 0x80,
+  /* '\\' */
+  0x08, 0x44, 0x42, 0x21, 0x11, 0x00,
+  /* ']' */
+  0x1C, 0x92, 0x49, 0x27, 0x80,
+  /* '^' */
+  0x01, 0x08, 0xA8, 0x80, 0x00, 0x00, 0x00, 0x00,
+  /* '_' */
+  0x4C, 0x86,
+  /* '`' */
+  0x24, 0x00, 0x00,
+  /* 'a' */
+  0x00, 0x00, 0x1C, 0x89, 0xE8, 0xA2, 0x7C, 0x00, 0x00,
+  /* 'b' */
+  0x03, 0x04, 0x16, 0x65, 0x14, 0x51, 0xF8, 0x00, 0x00,
+  /* 'c' */
+  0x00, 0x00, 0xF8, 0xC2, 0x11, 0x70, 0x00, 0x00,
+  /* 'd' */
+  0x00, 0x60, 0x9A, 0x9A, 0x28, 0xA2, 0x7C, 0x00, 0x00,
+  /* 'e' */
+  0x00, 0x00, 0xE8, 0xFE, 0x10, 0x78, 0x00, 0x00,
+  /* 'f' */
+  0x01, 0xD1, 0xF4, 0x21, 0x08, 0xF8, 0x00, 0x00,
+  /* 'g' */
+  0x00, 0x00, 0x1B, 0x9A, 0x28, 0xA2, 0x78, 0x27, 0x00,
+  /* 'h' */
+  0x01, 0x81, 0x02, 0xC6, 0x48, 0x91, 0x22, 0xEE, 0x00, 0x00, 0x00,
+  /* 'i' */
+  0x01, 0x01, 0xC2, 0x10, 0x84, 0xF8, 0x00, 0x00,
+  /* 'j' */
+  0x02, 0x0F, 0x11, 0x11, 0x11, 0xE0,
+  /* 'k' */
+  0x03, 0x04, 0x17, 0x49, 0xC5, 0x12, 0xDC, 0x00, 0x00,
+  /* 'l' */
+  0x03, 0x08, 0x42, 0x10, 0x84, 0xF8, 0x00, 0x00,
+  /* 'm' */
+  0x00, 0x00, 0x07, 0x45, 0x4A, 0x95, 0x2A, 0xFE, 0x00, 0x00, 0x00,
+  /* 'n' */
+  0x00, 0x00, 0x06, 0xC6, 0x48, 0x91, 0x22, 0xEE, 0x00, 0x00, 0x00,
+  /* 'o' */
+  0x00, 0x00, 0xE8, 0xC6, 0x31, 0x70, 0x00, 0x00,
+  /* 'p' */
+  0x00, 0x00, 0x36, 0x65, 0x14, 0x51, 0x79, 0x0E, 0x00,
+  /* 'q' */
+  0x00, 0x00, 0x1B, 0x9A, 0x28, 0xA2, 0x78, 0x21, 0xC0,
+  /* 'r' */
+  0x00, 0x01, 0xB6, 0x21, 0x08, 0xF8, 0x00, 0x00,
+  /* 's' */
+  0x00, 0x00, 0xF8, 0xB8, 0x31, 0xF0, 0x00, 0x00,
+  /* 't' */
+  0x00, 0x04, 0x3E, 0x41, 0x04, 0x11, 0x38, 0x00, 0x00,
+  /* 'u' */
+  0x00, 0x00, 0x06, 0x64, 0x48, 0x91, 0x26, 0x36, 0x00, 0x00, 0x00,
+  /* 'v' */
+  0x00, 0x00, 0x07, 0x74, 0x48, 0x8A, 0x14, 0x10, 0x00, 0x00, 0x00,
+  /* 'w' */
+  0x00, 0x00, 0x07, 0x74, 0x4A, 0x95, 0x2A, 0x28, 0x00, 0x00, 0x00,
+  /* 'x' */
+  0x00, 0x00, 0x33, 0x48, 0xC3, 0x12, 0xCC, 0x00, 0x00,
+  /* 'y' */
+  0x00, 0x00, 0x07, 0x74, 0x44, 0x8A, 0x0C, 0x10, 0x21, 0xE0, 0x00,
+  /* 'z' */
+  0x00, 0x01, 0xF9, 0x11, 0x11, 0xF8, 0x00, 0x00,
+  /* '{' */
+  0x05, 0x24, 0xA2, 0x48, 0x80,
+  /* '|' */
+  0x7F, 0xC0,
+  /* '}' */
+  0x11, 0x24, 0x8A, 0x4A, 0x00,
+  /* '~' */
+  0x19, 0x80, 0x01, 0x81, 0x00, 0x81, 0x19,
+};
+
+static const sPGLYPH PFont12_Glyphs[] PROGMEM = {
+  {   0,  0,  3}, /* ' ' */
+  {   0,  1,  2}, /* '!' */
+  {   2,  5,  6}, /* '"' */
+  {  10,  5,  6}, /* '#' */
+  {  18,  4,  5}, /* '$' */
+  {  24,  5,  6}, /* '%' */
+  {  32,  5,  6}, /* '&' */
+  {  40,  1,  2}, /* ''' */
+  {  42,  2,  3}, /* '(' */
+  {  45,  2,  3}, /* ')' */
+  {  48,  5,  6}, /* '*' */
+  {  56,  7,  8}, /* '+' */
+  {  67,  3,  4}, /* ',' */
+  {  72,  5 | PGLYPH_RLE,  6}, /* '-' */
+  {  75,  2,  3}, /* '.' */
+  {  78,  5,  6}, /* '/' */
+  {  86,  5,  6}, /* '0' */
+  {  94,  5,  6}, /* '1' */
+  { 102,  5,  6}, /* '2' */
+  { 110,  5,  6}, /* '3' */
+  { 118,  6,  7}, /* '4' */
+  { 127,  5,  6}, /* '5' */
+  { 135,  5,  6}, /* '6' */
+  { 143,  5,  6}, /* '7' */
+  { 151,  5,  6}, /* '8' */
+  { 159,  5,  6}, /* '9' */
+  { 167,  2,  3}, /* ':' */
+  { 170,  3,  4}, /* ';' */
+  { 175,  6,  7}, /* '<' */
+  { 184,  5 | PGLYPH_RLE,  6}, /* '=' */
+  { 189,  6,  7}, /* '>' */
+  { 198,  4,  5}, /* '?' */
+  { 204,  5,  6}, /* '@' */
+  { 212,  7,  8}, /* 'A' */
+  { 223,  6,  7}, /* 'B' */
+  { 232,  5,  6}, /* 'C' */
+  { 240,  6,  7}, /* 'D' */
+  { 249,  6,  7}, /* 'E' */
+  { 258,  6,  7}, /* 'F' */
+  { 267,  6,  7}, /* 'G' */
+  { 276,  7,  8}, /* 'H' */
+  { 287,  5,  6}, /* 'I' */
+  { 295,  5,  6}, /* 'J' */
+  { 303,  7,  8}, /* 'K' */
+  { 314,  5,  6}, /* 'L' */
+  { 322,  7,  8}, /* 'M' */
+  { 333,  7,  8}, /* 'N' */
+  { 344,  5,  6}, /* 'O' */
+  { 352,  5,  6}, /* 'P' */
+  { 360,  5,  6}, /* 'Q' */
+  { 368,  7,  8}, /* 'R' */
+  { 379,  5,  6}, /* 'S' */
+  { 387,  7,  8}, /* 'T' */
+  { 398,  7,  8}, /* 'U' */
+  { 409,  7,  8}, /* 'V' */
+  { 420,  7,  8}, /* 'W' */
+  { 431,  7,  8}, /* 'X' */
+  { 442,  7,  8}, /* 'Y' */
+  { 453,  5,  6}, /* 'Z' */
+  { 461,  3,  4}, /* '[' */
+  { 466,  4,  5}, /* '\\' */
+  { 472,  3,  4}, /* ']' */
+  { 477,  5,  6}, /* '^' */
+  { 485,  7 | PGLYPH_RLE,  8}, /* '_' */
+  { 487,  2,  3}, /* '`' */
+  { 490,  6,  7}, /* 'a' */
+  { 499,  6,  7}, /* 'b' */
+  { 508,  5,  6}, /* 'c' */
+  { 516,  6,  7}, /* 'd' */
+  { 525,  5,  6}, /* 'e' */
+  { 533,  5,  6}, /* 'f' */
+  { 541,  6,  7}, /* 'g' */
+  { 550,  7,  8}, /* 'h' */
+  { 561,  5,  6}, /* 'i' */
+  { 569,  4,  5}, /* 'j' */
+  { 575,  6,  7}, /* 'k' */
+  { 584,  5,  6}, /* 'l' */
+  { 592,  7,  8}, /* 'm' */
+  { 603,  7,  8}, /* 'n' */
+  { 614,  5,  6}, /* 'o' */
+  { 622,  6,  7}, /* 'p' */
+  { 631,  6,  7}, /* 'q' */
+  { 640,  5,  6}, /* 'r' */
+  { 648,  5,  6}, /* 's' */
+  { 656,  6,  7}, /* 't' */
+  { 665,  7,  8}, /* 'u' */
+  { 676,  7,  8}, /* 'v' */
+  { 687,  7,  8}, /* 'w' */
+  { 698,  6,  7}, /* 'x' */
+  { 707,  7,  8}, /* 'y' */
+  { 718,  5,  6}, /* 'z' */
+  { 726,  3,  4}, /* '{' */
+  { 731,  1,  2}, /* '|' */
+  { 733,  3,  4}, /* '}' */
+  { 738,  5 | PGLYPH_RLE,  6}, /* '~' */
+};
+
+const sPFONT PFont12 = {
+  PFont12_Bitmaps,
+  PFont12_Glyphs,
+  ' ',
+  '~',
+  12, /* Height */
+};
@@ -0,0 +1,341 @@
+/* Generated by tools/make_proportional_fonts.cpp - do not edit */
+
+#include <pgmspace.h>
+#include "pfonts.h"
+
+static const uint8_t PFont16_Bitmaps[] PROGMEM = {
+  /* ' ' */
+  /* '!' */
+  0x3F, 0xFF, 0xCC, 0x00,
+  /* '"' */
+  0x00, 0x03, 0xBF, 0x74, 0x48, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '#' */
+  0x00, 0x36, 0x36, 0x36, 0x36, 0xFF, 0x6C, 0xFF, 0x6C, 0x6C, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x00,
+  /* '$' */
+  0x10, 0xFF, 0x1E, 0x3E, 0x0F, 0x0F, 0x07, 0xC7, 0x8F, 0xF0, 0x81, 0x00, 0x00, 0x00,
+  /* '%' */
+  0x00, 0x60, 0x90, 0x90, 0x63, 0x1E, 0x78, 0xC6, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '&' */
+  0x00, 0x00, 0xF3, 0x06, 0x0C, 0x0C, 0x3B, 0xDD, 0x99, 0xD8, 0x00, 0x00, 0x00, 0x00,
+  /* ''' */
+  0x03, 0xF4, 0x90, 0x00, 0x00, 0x00,
+  /* '(' */
+  0x03, 0x36, 0xEC, 0xCC, 0xCE, 0x63, 0x30, 0x00,
+  /* ')' */
+  0x0C, 0xC6, 0x33, 0x33, 0x33, 0x6E, 0xC0, 0x00,
+  /* '*' */
+  0x0A, 0x81, 0x05, 0x81, 0x02, 0x8F, 0x01, 0x83, 0x02, 0x85, 0x01, 0x81, 0x01, 0x81, 0x40,
+  /* '+' */
+  0x00, 0x00, 0x00, 0x81, 0x02, 0x3F, 0x88, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ',' */
+  0x00, 0x00, 0x00, 0x0D, 0x69, 0x00,
+  /* '-' */
+  0x29, 0x86, 0x3E,
+  /* '.' */
+  0x11, 0x83, 0x09,
+  /* '/' */
+  0x03, 0x03, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x30, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0x00, 0x00, 0x00,
+  /* '0' */
+  0x00, 0x71, 0xB6, 0x3C, 0x78, 0xF1, 0xE3, 0xC6, 0xD8, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  /* '1' */
+  0x00, 0x18, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '2' */
+  0x00, 0x79, 0x9E, 0x3C, 0x61, 0x86, 0x18, 0x61, 0x83, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  /* '3' */
+  0x00, 0x7E, 0xC3, 0x03, 0x06, 0x3E, 0x07, 0x03, 0x03, 0xC3, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '4' */
+  0x00, 0x38, 0x71, 0xE2, 0xCD, 0x93, 0x66, 0xFE, 0x18, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  /* '5' */
+  0x00, 0xFD, 0x83, 0x06, 0x0F, 0x91, 0x83, 0x07, 0x0D, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  /* '6' */
+  0x00, 0x3D, 0xC3, 0x0C, 0x1B, 0xB9, 0xE3, 0xC6, 0xCC, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  /* '7' */
+  0x01, 0xFE, 0x18, 0x30, 0xC1, 0x83, 0x06, 0x18, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00,
+  /* '8' */
+  0x00, 0xFB, 0x1E, 0x3C, 0x6F, 0xB1, 0xE3, 0xC7, 0x8D, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  /* '9' */
+  0x00, 0xF3, 0x36, 0x3C, 0x79, 0xDD, 0x83, 0x0C, 0x3B, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* ':' */
+  0x00, 0xF0, 0x3C, 0x00,
+  /* ';' */
+  0x00, 0x00, 0x33, 0x00, 0x06, 0x48, 0x80, 0x00,
+  /* '<' */
+  0x00, 0x00, 0x00, 0x60, 0xC0, 0x81, 0x83, 0x00, 0x60, 0x08, 0x03, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* '=' */
+  0x2C, 0x88, 0x08, 0x88, 0x47,
+  /* '>' */
+  0x00, 0x00, 0x30, 0x06, 0x00, 0x80, 0x30, 0x06, 0x0C, 0x08, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* '?' */
+  0x00, 0x01, 0xF6, 0x3C, 0x60, 0xC7, 0x18, 0x30, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  /* '@' */
+  0x00, 0xE4, 0x61, 0x86, 0x7A, 0x69, 0x9E, 0x04, 0x4E, 0x00, 0x00, 0x00,
+  /* 'A' */
+  0x00, 0x00, 0x07, 0xE0, 0x78, 0x12, 0x0C, 0xC3, 0x30, 0xFC, 0x61, 0x98, 0x6F, 0x3C, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  /* 'B' */
+  0x00, 0x00, 0xFE, 0x63, 0x63, 0x63, 0x7E, 0x63, 0x63, 0x63, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'C' */
+  0x00, 0x00, 0x0F, 0xAC, 0x3C, 0x0E, 0x03, 0x01, 0x80, 0xC0, 0xB0, 0x8F, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'D' */
+  0x00, 0x00, 0x3F, 0x8C, 0x66, 0x1B, 0x0D, 0x86, 0xC3, 0x61, 0xB1, 0xBF, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'E' */
+  0x00, 0x00, 0xFF, 0x61, 0x61, 0x64, 0x7C, 0x64, 0x61, 0x61, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'F' */
+  0x00, 0x00, 0x3F, 0xEC, 0x16, 0x0B, 0x21, 0xF0, 0xC8, 0x60, 0x30, 0x3E, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'G' */
+  0x00, 0x00, 0x0F, 0x4C, 0x6C, 0x16, 0x03, 0x01, 0x9F, 0xC3, 0x31, 0x8F, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'H' */
+  0x00, 0x00, 0x3D, 0xEC, 0x66, 0x33, 0x19, 0xFC, 0xC6, 0x63, 0x31, 0xBD, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'I' */
+  0x00, 0x00, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'J' */
+  0x00, 0x00, 0x0F, 0xE0, 0xC0, 0x60, 0x30, 0x19, 0x8C, 0xC6, 0x63, 0x1F, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'K' */
+  0x00, 0x00, 0x3D, 0xEC, 0x66, 0x63, 0x61, 0xE0, 0xF8, 0x66, 0x31, 0xBC, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'L' */
+  0x00, 0x00, 0x3F, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x61, 0x30, 0x98, 0x7F, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'M' */
+  0x00, 0x00, 0x03, 0x83, 0xB0, 0x67, 0x1C, 0xF7, 0x9A, 0xB3, 0x76, 0x64, 0xCC, 0x1B, 0xEF, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'N' */
+  0x00, 0x00, 0x39, 0xEC, 0x67, 0x33, 0xD9, 0xAC, 0xDE, 0x67, 0x31, 0xBC, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'O' */
+  0x00, 0x00, 0x0F, 0x8C, 0x6C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xB1, 0x8F, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'P' */
+  0x00, 0x00, 0xFE, 0x63, 0x63, 0x63, 0x63, 0x7E, 0x60, 0x60, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'Q' */
+  0x00, 0x00, 0x0F, 0x8C, 0x6C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xB1, 0x8F, 0x83, 0x33, 0xF0, 0x00,
+  0x00, 0x00,
+  /* 'R' */
+  0x00, 0x00, 0x0F, 0xE1, 0x8C, 0x63, 0x18, 0xC7, 0xC1, 0x98, 0x63, 0x18, 0xCF, 0x9C, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  /* 'S' */
+  0x00, 0x01, 0xFE, 0x3C, 0x7C, 0x1F, 0x07, 0xC7, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  /* 'T' */
+  0x00, 0x00, 0xFF, 0x99, 0x99, 0x99, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'U' */
+  0x00, 0x00, 0x3D, 0xEC, 0x66, 0x33, 0x19, 0x8C, 0xC6, 0x63, 0x31, 0x8F, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'V' */
+  0x00, 0x00, 0x3D, 0xEC, 0x66, 0x31, 0xB0, 0xD8, 0x6C, 0x14, 0x0E, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'W' */
+  0x00, 0x00, 0x03, 0xEF, 0xB0, 0x66, 0x4C, 0xDD, 0x9B, 0xB1, 0x54, 0x3B, 0x87, 0x70, 0xC6, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'X' */
+  0x00, 0x00, 0x3D, 0xEC, 0x63, 0x60, 0xE0, 0x70, 0x38, 0x36, 0x31, 0xBD, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'Y' */
+  0x00, 0x00, 0x0F, 0x3D, 0x86, 0x33, 0x07, 0x80, 0xC0, 0x30, 0x0C, 0x03, 0x03, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  /* 'Z' */
+  0x00, 0x03, 0xFC, 0x38, 0xC3, 0x04, 0x18, 0x63, 0x87, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  /* '[' */
+  0x0F, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xF0, 0x00,
+  /* '\\' */
+  0xC0, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x00, 0x00, 0x00,
+  /* ']' */
+  0x0F, 0x33, 0x33, 0x33, 0x33, 0x33, 0xF0, 0x00,
+  /* '^' */
+  0x10, 0x50, 0xA2, 0x28, 0x30, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '_' */
+  0x7F, 0x24, 0x8A,
+  /* '`' */
+  0x88, 0x80, 0x00, 0x00, 0x00, 0x00,
+  /* 'a' */
+  0x00, 0x00, 0x00, 0x00, 0x7C, 0x06, 0x06, 0x7E, 0xC6, 0xCE, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'b' */
+  0x00, 0x70, 0x18, 0x0C, 0x06, 0xE3, 0x99, 0x86, 0xC3, 0x61, 0xB9, 0xBB, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'c' */
+  0x00, 0x00, 0x00, 0x00, 0x3D, 0x63, 0xC1, 0xC0, 0xC1, 0x63, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'd' */
+  0x00, 0x03, 0x80, 0xC0, 0x63, 0xB3, 0x3B, 0x0D, 0x86, 0xC3, 0x33, 0x8E, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'e' */
+  0x25, 0x84, 0x02, 0x81, 0x02, 0x81, 0x00, 0x81, 0x04, 0x8C, 0x07, 0x81, 0x03, 0x81, 0x01, 0x85,
+  0x2D,
+  /* 'f' */
+  0x00, 0x0F, 0xCC, 0x06, 0x0F, 0xE1, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x3F, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'g' */
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xBB, 0x3B, 0x0D, 0x86, 0xC3, 0x33, 0x8E, 0xC0, 0x60, 0x31, 0xF0,
+  0x00, 0x00,
+  /* 'h' */
+  0x00, 0x70, 0x18, 0x0C, 0x06, 0xE3, 0x99, 0x8C, 0xC6, 0x63, 0x31, 0xBD, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'i' */
+  0x00, 0x18, 0x18, 0x00, 0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'j' */
+  0x00, 0x61, 0x80, 0xFC, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0F, 0xE0, 0x00,
+  /* 'k' */
+  0x00, 0x70, 0x18, 0x0C, 0x06, 0xF3, 0x61, 0xE0, 0xF0, 0x6C, 0x33, 0x3B, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'l' */
+  0x00, 0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'm' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x1B, 0x66, 0xD9, 0xB6, 0x6D, 0x9B, 0x6E, 0xDC, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  /* 'n' */
+  0x00, 0x00, 0x00, 0x00, 0x0E, 0xE3, 0x99, 0x8C, 0xC6, 0x63, 0x31, 0xBD, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'o' */
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xE3, 0x1B, 0x07, 0x83, 0xC1, 0xB1, 0x8F, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'p' */
+  0x00, 0x00, 0x00, 0x00, 0x0E, 0xE3, 0x99, 0x86, 0xC3, 0x61, 0xB9, 0x9B, 0x8C, 0x06, 0x07, 0xC0,
+  0x00, 0x00,
+  /* 'q' */
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xBB, 0x3B, 0x0D, 0x86, 0xC3, 0x33, 0x8E, 0xC0, 0x60, 0x30, 0x7C,
+  0x00, 0x00,
+  /* 'r' */
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0x71, 0xCC, 0xC0, 0x60, 0x30, 0x18, 0x3F, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 's' */
+  0x1C, 0x87, 0x02, 0x85, 0x03, 0x84, 0x04, 0x84, 0x02, 0x87, 0x23,
+  /* 't' */
+  0x00, 0x30, 0x30, 0x30, 0xFE, 0x30, 0x30, 0x30, 0x30, 0x31, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'u' */
+  0x00, 0x00, 0x00, 0x00, 0x0E, 0x73, 0x19, 0x8C, 0xC6, 0x63, 0x33, 0x8E, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'v' */
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0x7B, 0x19, 0x8C, 0x6C, 0x36, 0x0E, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'w' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1E, 0xC1, 0x99, 0x33, 0x76, 0x3B, 0x87, 0x70, 0xC6, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'x' */
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0x79, 0xB0, 0x70, 0x38, 0x1C, 0x1B, 0x3D, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'y' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xD8, 0x63, 0x30, 0xCC, 0x16, 0x07, 0x80, 0xC0, 0x30, 0x18,
+  0x1F, 0x00, 0x00, 0x00,
+  /* 'z' */
+  0x00, 0x00, 0x00, 0x0F, 0xF0, 0xC3, 0x1C, 0x61, 0x87, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  /* '{' */
+  0x03, 0x66, 0x66, 0x6C, 0x66, 0x66, 0x30, 0x00,
+  /* '|' */
+  0x01, 0x97, 0x05,
+  /* '}' */
+  0x0C, 0x66, 0x66, 0x63, 0x66, 0x66, 0xC0, 0x00,
+  /* '~' */
+  0x23, 0x81, 0x03, 0x80, 0x01, 0x80, 0x01, 0x80, 0x03, 0x81, 0x38,
+};
+
+static const sPGLYPH PFont16_Glyphs[] PROGMEM = {
+  {   0,  0,  5}, /* ' ' */
+  {   0,  2,  3}, /* '!' */
+  {   4,  7,  8}, /* '"' */
+  {  18,  8,  9}, /* '#' */
+  {  34,  7,  8}, /* '$' */
+  {  48,  8,  9}, /* '%' */
+  {  64,  7,  8}, /* '&' */
+  {  78,  3,  4}, /* ''' */
+  {  84,  4,  5}, /* '(' */
+  {  92,  4,  5}, /* ')' */
+  { 100,  8 | PGLYPH_RLE,  9}, /* '*' */
+  { 115,  7,  8}, /* '+' */
+  { 129,  3,  4}, /* ',' */
+  { 135,  7 | PGLYPH_RLE,  8}, /* '-' */
+  { 138,  2 | PGLYPH_RLE,  3}, /* '.' */
+  { 141,  8,  9}, /* '/' */
+  { 157,  7,  8}, /* '0' */
+  { 171,  8,  9}, /* '1' */
+  { 187,  7,  8}, /* '2' */
+  { 201,  8,  9}, /* '3' */
+  { 217,  7,  8}, /* '4' */
+  { 231,  7,  8}, /* '5' */
+  { 245,  7,  8}, /* '6' */
+  { 259,  7,  8}, /* '7' */
+  { 273,  7,  8}, /* '8' */
+  { 287,  7,  8}, /* '9' */
+  { 301,  2,  3}, /* ':' */
+  { 305,  4,  5}, /* ';' */
+  { 313,  9, 10}, /* '<' */
+  { 331,  9 | PGLYPH_RLE, 10}, /* '=' */
+  { 336,  9, 10}, /* '>' */
+  { 354,  7,  8}, /* '?' */
+  { 368,  6,  7}, /* '@' */
+  { 380, 10, 11}, /* 'A' */
+  { 400,  8,  9}, /* 'B' */
+  { 416,  9, 10}, /* 'C' */
+  { 434,  9, 10}, /* 'D' */
+  { 452,  8,  9}, /* 'E' */
+  { 468,  9, 10}, /* 'F' */
+  { 486,  9, 10}, /* 'G' */
+  { 504,  9, 10}, /* 'H' */
+  { 522,  8,  9}, /* 'I' */
+  { 538,  9, 10}, /* 'J' */
+  { 556,  9, 10}, /* 'K' */
+  { 574,  9, 10}, /* 'L' */
+  { 592, 11, 12}, /* 'M' */
+  { 614,  9, 10}, /* 'N' */
+  { 632,  9, 10}, /* 'O' */
+  { 650,  8,  9}, /* 'P' */
+  { 666,  9, 10}, /* 'Q' */
+  { 684, 10, 11}, /* 'R' */
+  { 704,  7,  8}, /* 'S' */
+  { 718,  8,  9}, /* 'T' */
+  { 734,  9, 10}, /* 'U' */
+  { 752,  9, 10}, /* 'V' */
+  { 770, 11, 12}, /* 'W' */
+  { 792,  9, 10}, /* 'X' */
+  { 810, 10, 11}, /* 'Y' */
+  { 830,  7,  8}, /* 'Z' */
+  { 844,  4,  5}, /* '[' */
+  { 852,  8,  9}, /* '\\' */
+  { 868,  4,  5}, /* ']' */
+  { 876,  7,  8}, /* '^' */
+  { 890, 11 | PGLYPH_RLE, 12}, /* '_' */
+  { 893,  3,  4}, /* '`' */
+  { 899,  8,  9}, /* 'a' */
+  { 915,  9, 10}, /* 'b' */
+  { 933,  8,  9}, /* 'c' */
+  { 949,  9, 10}, /* 'd' */
+  { 967,  9 | PGLYPH_RLE, 10}, /* 'e' */
+  { 984,  9, 10}, /* 'f' */
+  {1002,  9, 10}, /* 'g' */
+  {1020,  9, 10}, /* 'h' */
+  {1038,  8,  9}, /* 'i' */
+  {1054,  6,  7}, /* 'j' */
+  {1066,  9, 10}, /* 'k' */
+  {1084,  8,  9}, /* 'l' */
+  {1100, 10, 11}, /* 'm' */
+  {1120,  9, 10}, /* 'n' */
+  {1138,  9, 10}, /* 'o' */
+  {1156,  9, 10}, /* 'p' */
+  {1174,  9, 10}, /* 'q' */
+  {1192,  9, 10}, /* 'r' */
+  {1210,  7 | PGLYPH_RLE,  8}, /* 's' */
+  {1221,  8,  9}, /* 't' */
+  {1237,  9, 10}, /* 'u' */
+  {1255,  9, 10}, /* 'v' */
+  {1273, 11, 12}, /* 'w' */
+  {1295,  9, 10}, /* 'x' */
+  {1313, 10, 11}, /* 'y' */
+  {1333,  7,  8}, /* 'z' */
+  {1347,  4,  5}, /* '{' */
+  {1355,  2 | PGLYPH_RLE,  3}, /* '|' */
+  {1358,  4,  5}, /* '}' */
+  {1366,  7 | PGLYPH_RLE,  8}, /* '~' */
+};
+
+const sPFONT PFont16 = {
+  PFont16_Bitmaps,
+  PFont16_Glyphs,
+  ' ',
+  '~',
+  16, /* Height */
+};
@@ -0,0 +1,377 @@
+/* Generated by tools/make_proportional_fonts.cpp - do not edit */
+
+#include <pgmspace.h>
+#include "pfonts.h"
+
+static const uint8_t PFont20_Bitmaps[] PROGMEM = {
+  /* ' ' */
+  /* '!' */
+  0x1F, 0xFF, 0xFF, 0x48, 0x0F, 0xC0, 0x00, 0x00,
+  /* '"' */
+  0x00, 0x00, 0xE7, 0xE7, 0xE7, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  /* '#' */
+  0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x3F, 0xFF, 0xFC, 0xCC, 0x33, 0x3F, 0xFF, 0xFC, 0xCC, 0x33,
+  0x0C, 0xC3, 0x30, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '$' */
+  0x18, 0x18, 0x3F, 0x7F, 0xC3, 0xC0, 0xF8, 0x7E, 0x07, 0xC3, 0xC3, 0xFE, 0xFC, 0x18, 0x18, 0x18,
+  0x00, 0x00, 0x00, 0x00,
+  /* '%' */
+  0x00, 0x38, 0x22, 0x11, 0x08, 0x83, 0x8C, 0x1E, 0x7C, 0xF0, 0x63, 0x82, 0x21, 0x10, 0x88, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '&' */
+  0x00, 0x00, 0x00, 0x03, 0xE7, 0xF3, 0x01, 0x80, 0x60, 0x79, 0xFF, 0xF3, 0xD8, 0xCF, 0xF9, 0xEC,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ''' */
+  0x03, 0xFE, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '(' */
+  0x03, 0x36, 0x66, 0xCC, 0xCC, 0xCC, 0x66, 0x63, 0x30, 0x00,
+  /* ')' */
+  0x0C, 0xC6, 0x66, 0x33, 0x33, 0x33, 0x66, 0x6C, 0xC0, 0x00,
+  /* '*' */
+  0x00, 0x18, 0x18, 0x18, 0xDB, 0xFF, 0x3C, 0x3C, 0x7E, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  /* '+' */
+  0x21, 0x81, 0x07, 0x81, 0x07, 0x81, 0x07, 0x81, 0x03, 0x93, 0x03, 0x81, 0x07, 0x81, 0x07, 0x81,
+  0x07, 0x81, 0x49,
+  /* ',' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x66, 0xCC, 0x80, 0x00,
+  /* '-' */
+  0x3E, 0x91, 0x62,
+  /* '.' */
+  0x20, 0x88, 0x11,
+  /* '/' */
+  0x03, 0x03, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x60, 0x60, 0x60, 0xC0, 0xC0,
+  0x00, 0x00, 0x00, 0x00,
+  /* '0' */
+  0x00, 0x1F, 0x1F, 0xCC, 0x6C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x6C, 0x67, 0xF1, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '1' */
+  0x00, 0x18, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  /* '2' */
+  0x00, 0x1F, 0x1F, 0xDC, 0x7C, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0F, 0xFF, 0xFC,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '3' */
+  0x00, 0x07, 0xC7, 0xF9, 0x87, 0x00, 0xC0, 0x70, 0xF8, 0x3E, 0x01, 0xC0, 0x30, 0x0F, 0x07, 0xFF,
+  0x9F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '4' */
+  0x00, 0x03, 0x83, 0xC1, 0xE1, 0xB1, 0x98, 0xCC, 0xC6, 0xC3, 0x7F, 0xFF, 0xE0, 0x60, 0xF8, 0x7C,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '5' */
+  0x00, 0x3F, 0x9F, 0xCC, 0x06, 0x03, 0xF1, 0xFC, 0xC7, 0x01, 0x80, 0xC0, 0x78, 0x7F, 0xF3, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '6' */
+  0x00, 0x07, 0xCF, 0xEF, 0x06, 0x07, 0x03, 0x79, 0xFE, 0xE3, 0xE0, 0xF0, 0x6C, 0x77, 0xF0, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '7' */
+  0x00, 0x7F, 0xFF, 0xF8, 0x30, 0x18, 0x18, 0x0C, 0x06, 0x06, 0x03, 0x01, 0x81, 0x80, 0xC0, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '8' */
+  0x00, 0x1F, 0x1F, 0xDC, 0x7C, 0x1F, 0x1D, 0xFC, 0xFE, 0xE3, 0xE0, 0xF0, 0x7C, 0x77, 0xF1, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '9' */
+  0x00, 0x1E, 0x1F, 0xDC, 0x6C, 0x1E, 0x0F, 0x8E, 0xFF, 0x3D, 0x81, 0xC0, 0xC1, 0xEF, 0xE7, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ':' */
+  0x0E, 0x88, 0x08, 0x88, 0x11,
+  /* ';' */
+  0x00, 0x00, 0x00, 0x1C, 0xE7, 0x00, 0x00, 0xE6, 0x63, 0x10, 0x00, 0x00, 0x00,
+  /* '<' */
+  0x29, 0x81, 0x06, 0x83, 0x04, 0x83, 0x05, 0x82, 0x05, 0x82, 0x05, 0x83, 0x08, 0x82, 0x09, 0x82,
+  0x08, 0x83, 0x08, 0x83, 0x08, 0x81, 0x41,
+  /* '=' */
+  0x36, 0x95, 0x15, 0x95, 0x62,
+  /* '>' */
+  0x20, 0x81, 0x08, 0x83, 0x08, 0x83, 0x08, 0x82, 0x09, 0x82, 0x08, 0x83, 0x05, 0x82, 0x05, 0x82,
+  0x05, 0x83, 0x04, 0x83, 0x06, 0x81, 0x4A,
+  /* '?' */
+  0x00, 0x00, 0x7C, 0xFE, 0xC3, 0xC3, 0x03, 0x0E, 0x1C, 0x18, 0x00, 0x00, 0x38, 0x38, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  /* '@' */
+  0x00, 0x39, 0x92, 0x18, 0x30, 0x63, 0xC9, 0x93, 0x26, 0x3C, 0x04, 0x08, 0x4F, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  /* 'A' */
+  0x00, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x07, 0x00, 0xD8, 0x0D, 0x81, 0x98, 0x18, 0xC3, 0xFC, 0x3F,
+  0xC6, 0x06, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'B' */
+  0x00, 0x00, 0x0F, 0xE3, 0xFC, 0x61, 0x98, 0x66, 0x39, 0xFC, 0x7F, 0x98, 0x76, 0x0D, 0x83, 0xFF,
+  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'C' */
+  0x00, 0x00, 0x01, 0xEC, 0xFF, 0x71, 0xF8, 0x3C, 0x03, 0x00, 0xC0, 0x30, 0x0E, 0x0D, 0xC7, 0x3F,
+  0x87, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'D' */
+  0x00, 0x00, 0x03, 0xFC, 0x7F, 0xC6, 0x1C, 0xC1, 0xD8, 0x1B, 0x03, 0x60, 0x6C, 0x0D, 0x83, 0xB0,
+  0xEF, 0xF9, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'E' */
+  0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x60, 0xD8, 0x36, 0x61, 0xF8, 0x7E, 0x19, 0x86, 0x0D, 0x83, 0xFF,
+  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'F' */
+  0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x60, 0xD8, 0x36, 0x61, 0xF8, 0x7E, 0x19, 0x86, 0x01, 0x80, 0xFC,
+  0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'G' */
+  0x00, 0x00, 0x00, 0x7B, 0x3F, 0xE6, 0x1D, 0x81, 0xB0, 0x06, 0x00, 0xC7, 0xF8, 0xFF, 0x03, 0x30,
+  0x67, 0xFC, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'H' */
+  0x00, 0x00, 0x0F, 0x3F, 0xCF, 0x61, 0x98, 0x66, 0x19, 0xFE, 0x7F, 0x98, 0x66, 0x19, 0x86, 0xF3,
+  0xFC, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'I' */
+  0x00, 0x00, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  /* 'J' */
+  0x00, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0xC1, 0x98, 0x33, 0x06, 0x61,
+  0xCF, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'K' */
+  0x00, 0x00, 0x03, 0xEF, 0xFD, 0xF6, 0x38, 0xCC, 0x1B, 0x03, 0xE0, 0x76, 0x0C, 0x61, 0x8C, 0x30,
+  0xCF, 0x9F, 0xF1, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'L' */
+  0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x33, 0x0C, 0xC3, 0xFF,
+  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'M' */
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x70, 0xE7, 0x9E, 0x69, 0x66, 0xF6, 0x6F, 0x66, 0x66, 0x66,
+  0x66, 0x06, 0xF9, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'N' */
+  0x00, 0x00, 0x0E, 0x7F, 0xDF, 0x71, 0x9E, 0x67, 0x99, 0xB6, 0x6D, 0x99, 0xE6, 0x79, 0x8E, 0xFB,
+  0xBE, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'O' */
+  0x00, 0x00, 0x01, 0xE0, 0xFC, 0x73, 0xB8, 0x7C, 0x0F, 0x03, 0xC0, 0xF0, 0x3E, 0x1D, 0xCE, 0x3F,
+  0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'P' */
+  0x00, 0x00, 0x0F, 0xF3, 0xFE, 0x61, 0xD8, 0x36, 0x0D, 0x87, 0x7F, 0x9F, 0xC6, 0x01, 0x80, 0xFC,
+  0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'Q' */
+  0x00, 0x00, 0x01, 0xE0, 0xFC, 0x73, 0xB8, 0x7C, 0x0F, 0x03, 0xC0, 0xF0, 0x3E, 0x1D, 0xCE, 0x3F,
+  0x07, 0x81, 0xEC, 0xFF, 0x33, 0x80, 0x00, 0x00, 0x00,
+  /* 'R' */
+  0x00, 0x00, 0x03, 0xFC, 0x7F, 0xC6, 0x1C, 0xC1, 0x98, 0x73, 0xFC, 0x7F, 0x0C, 0x71, 0x86, 0x30,
+  0xEF, 0x8F, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'S' */
+  0x00, 0x00, 0x03, 0xED, 0xFF, 0xE1, 0xF0, 0x3E, 0x01, 0xF8, 0x1F, 0x80, 0x7C, 0x0F, 0x87, 0xFF,
+  0xB7, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'T' */
+  0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xCC, 0xF3, 0x3C, 0xCC, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x3F,
+  0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'U' */
+  0x00, 0x00, 0x0F, 0x3F, 0xCF, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0xCE, 0x3F,
+  0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'V' */
+  0x00, 0x00, 0x03, 0xC7, 0xF8, 0xF6, 0x0C, 0xC1, 0x8C, 0x61, 0x8C, 0x1B, 0x03, 0x60, 0x6C, 0x07,
+  0x00, 0xE0, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'W' */
+  0x00, 0x00, 0x00, 0x3E, 0x3F, 0xF1, 0xF6, 0x03, 0x33, 0x99, 0x9C, 0xCC, 0xE6, 0x6D, 0xB1, 0x6D,
+  0x0E, 0x38, 0x71, 0xC3, 0x8E, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00,
+  /* 'X' */
+  0x00, 0x00, 0x03, 0xC7, 0xF8, 0xF6, 0x0C, 0x63, 0x06, 0xC0, 0x70, 0x0E, 0x03, 0x60, 0xC6, 0x30,
+  0x6F, 0x1F, 0xE3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'Y' */
+  0x00, 0x00, 0x0F, 0x3F, 0xCF, 0x61, 0x8C, 0xC1, 0xE0, 0x78, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x3F,
+  0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'Z' */
+  0x00, 0x00, 0xFF, 0xFF, 0xC3, 0xC6, 0x0C, 0x18, 0x18, 0x30, 0x63, 0xC3, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  /* '[' */
+  0x0F, 0xFC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCF, 0xF0, 0x00,
+  /* '\\' */
+  0xC0, 0xC0, 0x60, 0x60, 0x60, 0x30, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x06, 0x03, 0x03,
+  0x00, 0x00, 0x00, 0x00,
+  /* ']' */
+  0x0F, 0xF3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F, 0xF0, 0x00,
+  /* '^' */
+  0x0C, 0x80, 0x06, 0x82, 0x04, 0x81, 0x00, 0x81, 0x02, 0x81, 0x02, 0x81, 0x00, 0x81, 0x04, 0x82,
+  0x06, 0x80, 0x74,
+  /* '_' */
+  0x7F, 0x7B, 0x9B,
+  /* '`' */
+  0x03, 0x80, 0x03, 0x81, 0x03, 0x80, 0x3F,
+  /* 'a' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF8, 0x06, 0x3F, 0x9F, 0xEE, 0x1B, 0x0E, 0xFF,
+  0xDF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'b' */
+  0x00, 0x1C, 0x03, 0x80, 0x30, 0x06, 0x00, 0xDE, 0x1F, 0xF3, 0x86, 0x60, 0x6C, 0x0D, 0x81, 0xB8,
+  0x6F, 0xFD, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'c' */
+  0x34, 0x83, 0x00, 0x81, 0x00, 0x88, 0x00, 0x81, 0x04, 0x83, 0x05, 0x83, 0x07, 0x81, 0x07, 0x82,
+  0x04, 0x81, 0x00, 0x88, 0x01, 0x85, 0x3D,
+  /* 'd' */
+  0x00, 0x00, 0x38, 0x07, 0x00, 0x60, 0x0C, 0x3D, 0x9F, 0xF3, 0x0E, 0xC0, 0xD8, 0x1B, 0x03, 0x70,
+  0xE7, 0xFE, 0x3D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'e' */
+  0x34, 0x83, 0x03, 0x87, 0x01, 0x81, 0x03, 0x81, 0x00, 0x95, 0x08, 0x81, 0x04, 0x81, 0x00, 0x88,
+  0x02, 0x84, 0x3D,
+  /* 'f' */
+  0x00, 0x0F, 0xCF, 0xE6, 0x03, 0x07, 0xFB, 0xFC, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x0F, 0xF7, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'g' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xDF, 0xFB, 0x0E, 0xC0, 0xD8, 0x1B, 0x03, 0x30,
+  0xE7, 0xFC, 0x3D, 0x80, 0x30, 0x0E, 0x3F, 0x87, 0xE0, 0x00, 0x00, 0x00,
+  /* 'h' */
+  0x00, 0x38, 0x0E, 0x01, 0x80, 0x60, 0x1B, 0xC7, 0xF9, 0xC6, 0x61, 0x98, 0x66, 0x19, 0x86, 0xF3,
+  0xFC, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'i' */
+  0x00, 0x18, 0x18, 0x00, 0x00, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  /* 'j' */
+  0x00, 0x0C, 0x0C, 0x00, 0x00, 0x7F, 0x7F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07,
+  0xFE, 0xFC, 0x00, 0x00,
+  /* 'k' */
+  0x00, 0x38, 0x0E, 0x01, 0x80, 0x60, 0x1B, 0xE6, 0xF9, 0xB0, 0x78, 0x1E, 0x06, 0xC1, 0x98, 0xE7,
+  0xF9, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'l' */
+  0x00, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  /* 'm' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xDC, 0xFF, 0xE6, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0xF7, 0x7F, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'n' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xCF, 0xF9, 0xC6, 0x61, 0x98, 0x66, 0x19, 0x86, 0xF3,
+  0xFC, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'o' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x87, 0xF9, 0x86, 0xC0, 0xF0, 0x3C, 0x0D, 0x86, 0x7F,
+  0x87, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'p' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDE, 0x3F, 0xF3, 0x86, 0x60, 0x6C, 0x0D, 0x81, 0xB8,
+  0x67, 0xFC, 0xDE, 0x18, 0x03, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00,
+  /* 'q' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xDF, 0xFB, 0x0E, 0xC0, 0xD8, 0x1B, 0x03, 0x30,
+  0xE7, 0xFC, 0x3D, 0x80, 0x30, 0x06, 0x03, 0xE0, 0x7C, 0x00, 0x00, 0x00,
+  /* 'r' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xEF, 0x7C, 0xF3, 0x38, 0x0C, 0x03, 0x00, 0xC0, 0xFF,
+  0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 's' */
+  0x29, 0x8F, 0x03, 0x85, 0x04, 0x85, 0x04, 0x85, 0x03, 0x8F, 0x31,
+  /* 't' */
+  0x00, 0x00, 0x03, 0x00, 0xC0, 0x30, 0x3F, 0xEF, 0xF8, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC3, 0x3F,
+  0xC7, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'u' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xEE, 0x39, 0x86, 0x61, 0x98, 0x66, 0x19, 0x8E, 0x7F,
+  0xCF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'v' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE3, 0xFC, 0x7B, 0x06, 0x31, 0x86, 0x30, 0x6C, 0x0D,
+  0x80, 0xE0, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'w' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE3, 0xFC, 0x7B, 0x26, 0x64, 0xCD, 0xF8, 0xEE, 0x1D,
+  0xC3, 0x18, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'x' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x3C, 0xCC, 0x1E, 0x03, 0x01, 0xE0, 0xCC, 0xF3,
+  0xFC, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'y' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE3, 0xFC, 0x7B, 0x06, 0x31, 0x86, 0x30, 0x6C, 0x0F,
+  0x80, 0xE0, 0x18, 0x03, 0x00, 0xC0, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x00,
+  /* 'z' */
+  0x27, 0x91, 0x02, 0x81, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81, 0x02, 0x91, 0x2F,
+  /* '{' */
+  0x00, 0x73, 0xCC, 0x30, 0xC3, 0x0C, 0x73, 0x87, 0x0C, 0x30, 0xC3, 0x0F, 0x1C, 0x00, 0x00,
+  /* '|' */
+  0x01, 0x9F, 0x05,
+  /* '}' */
+  0x03, 0x8F, 0x0C, 0x30, 0xC3, 0x0C, 0x38, 0x73, 0x8C, 0x30, 0xC3, 0x3C, 0xE0, 0x00, 0x00,
+  /* '~' */
+  0x3D, 0x82, 0x04, 0x85, 0x01, 0x83, 0x01, 0x85, 0x04, 0x83, 0x64,
+};
+
+static const sPGLYPH PFont20_Glyphs[] PROGMEM = {
+  {   0,  0,  7}, /* ' ' */
+  {   0,  3,  4}, /* '!' */
+  {   8,  8,  9}, /* '"' */
+  {  28, 10, 11}, /* '#' */
+  {  53,  8,  9}, /* '$' */
+  {  73,  9, 10}, /* '%' */
+  {  96,  9, 10}, /* '&' */
+  { 119,  3,  4}, /* ''' */
+  { 127,  4,  5}, /* '(' */
+  { 137,  4,  5}, /* ')' */
+  { 147,  8,  9}, /* '*' */
+  { 167, 10 | PGLYPH_RLE, 11}, /* '+' */
+  { 186,  4,  5}, /* ',' */
+  { 196,  9 | PGLYPH_RLE, 10}, /* '-' */
+  { 199,  3 | PGLYPH_RLE,  4}, /* '.' */
+  { 202,  8,  9}, /* '/' */
+  { 222,  9, 10}, /* '0' */
+  { 245,  8,  9}, /* '1' */
+  { 265,  9, 10}, /* '2' */
+  { 288, 10, 11}, /* '3' */
+  { 313,  9, 10}, /* '4' */
+  { 336,  9, 10}, /* '5' */
+  { 359,  9, 10}, /* '6' */
+  { 382,  9, 10}, /* '7' */
+  { 405,  9, 10}, /* '8' */
+  { 428,  9, 10}, /* '9' */
+  { 451,  3 | PGLYPH_RLE,  4}, /* ':' */
+  { 456,  5,  6}, /* ';' */
+  { 469, 11 | PGLYPH_RLE, 12}, /* '<' */
+  { 492, 11 | PGLYPH_RLE, 12}, /* '=' */
+  { 497, 11 | PGLYPH_RLE, 12}, /* '>' */
+  { 520,  8,  9}, /* '?' */
+  { 540,  7,  8}, /* '@' */
+  { 558, 12, 13}, /* 'A' */
+  { 588, 10, 11}, /* 'B' */
+  { 613, 10, 11}, /* 'C' */
+  { 638, 11, 12}, /* 'D' */
+  { 666, 10, 11}, /* 'E' */
+  { 691, 10, 11}, /* 'F' */
+  { 716, 11, 12}, /* 'G' */
+  { 744, 10, 11}, /* 'H' */
+  { 769,  8,  9}, /* 'I' */
+  { 789, 11, 12}, /* 'J' */
+  { 817, 11, 12}, /* 'K' */
+  { 845, 10, 11}, /* 'L' */
+  { 870, 12, 13}, /* 'M' */
+  { 900, 10, 11}, /* 'N' */
+  { 925, 10, 11}, /* 'O' */
+  { 950, 10, 11}, /* 'P' */
+  { 975, 10, 11}, /* 'Q' */
+  {1000, 11, 12}, /* 'R' */
+  {1028, 10, 11}, /* 'S' */
+  {1053, 10, 11}, /* 'T' */
+  {1078, 10, 11}, /* 'U' */
+  {1103, 11, 12}, /* 'V' */
+  {1131, 13, 14}, /* 'W' */
+  {1164, 11, 12}, /* 'X' */
+  {1192, 10, 11}, /* 'Y' */
+  {1217,  8,  9}, /* 'Z' */
+  {1237,  4,  5}, /* '[' */
+  {1247,  8,  9}, /* '\\' */
+  {1267,  4,  5}, /* ']' */
+  {1277,  9 | PGLYPH_RLE, 10}, /* '^' */
+  {1296, 14 | PGLYPH_RLE, 15}, /* '_' */
+  {1299,  4 | PGLYPH_RLE,  5}, /* '`' */
+  {1306, 10, 11}, /* 'a' */
+  {1331, 11, 12}, /* 'b' */
+  {1359, 10 | PGLYPH_RLE, 11}, /* 'c' */
+  {1382, 11, 12}, /* 'd' */
+  {1410, 10 | PGLYPH_RLE, 11}, /* 'e' */
+  {1429,  9, 10}, /* 'f' */
+  {1452, 11, 12}, /* 'g' */
+  {1480, 10, 11}, /* 'h' */
+  {1505,  8,  9}, /* 'i' */
+  {1525,  8,  9}, /* 'j' */
+  {1545, 10, 11}, /* 'k' */
+  {1570,  8,  9}, /* 'l' */
+  {1590, 12, 13}, /* 'm' */
+  {1620, 10, 11}, /* 'n' */
+  {1645, 10, 11}, /* 'o' */
+  {1670, 11, 12}, /* 'p' */
+  {1698, 11, 12}, /* 'q' */
+  {1726, 10, 11}, /* 'r' */
+  {1751,  8 | PGLYPH_RLE,  9}, /* 's' */
+  {1762, 10, 11}, /* 't' */
+  {1787, 10, 11}, /* 'u' */
+  {1812, 11, 12}, /* 'v' */
+  {1840, 11, 12}, /* 'w' */
+  {1868, 10, 11}, /* 'x' */
+  {1893, 11, 12}, /* 'y' */
+  {1921,  8 | PGLYPH_RLE,  9}, /* 'z' */
+  {1936,  6,  7}, /* '{' */
+  {1951,  2 | PGLYPH_RLE,  3}, /* '|' */
+  {1954,  6,  7}, /* '}' */
+  {1969, 10 | PGLYPH_RLE, 11}, /* '~' */
+};
+
+const sPFONT PFont20 = {
+  PFont20_Bitmaps,
+  PFont20_Glyphs,
+  ' ',
+  '~',
+  20, /* Height */
+};
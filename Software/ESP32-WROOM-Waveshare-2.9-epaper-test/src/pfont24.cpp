@@ -0,0 +1,428 @@
+/* Generated by tools/make_proportional_fonts.cpp - do not edit */
+
+#include <pgmspace.h>
+#include "pfonts.h"
+
+static const uint8_t PFont24_Bitmaps[] PROGMEM = {
+  /* ' ' */
+  /* '!' */
+  0x03, 0xFF, 0xFF, 0xFF, 0xA4, 0x07, 0xE0, 0x00, 0x00,
+  /* '"' */
+  0x00, 0x00, 0x00, 0xE7, 0xE7, 0xE7, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '#' */
+  0x00, 0x00, 0x00, 0x66, 0x0C, 0xC1, 0x98, 0x33, 0x06, 0x67, 0xFF, 0xFF, 0xE3, 0x30, 0xCC, 0x7F,
+  0xFF, 0xFE, 0x66, 0x0C, 0xC1, 0x98, 0x33, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00,
+  /* '$' */
+  0x00, 0x06, 0x03, 0x07, 0xB7, 0xFE, 0x1F, 0x0F, 0xC0, 0x7C, 0x1F, 0x81, 0xF8, 0x3E, 0x1F, 0x1F,
+  0xFD, 0xBC, 0x0C, 0x06, 0x03, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
+  /* '%' */
+  0x00, 0x00, 0x03, 0xC1, 0xF8, 0xE7, 0x30, 0xCC, 0x33, 0x9C, 0x7F, 0xCF, 0xCF, 0xF8, 0xE7, 0x30,
+  0xCC, 0x33, 0x9C, 0x7E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '&' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x7F, 0x18, 0xC3, 0x00, 0x60, 0x06, 0x00, 0xE0, 0x3E,
+  0x7E, 0xFF, 0x8F, 0x30, 0xE3, 0xFF, 0x3E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00,
+  /* ''' */
+  0x00, 0x7F, 0xD2, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '(' */
+  0x00, 0x00, 0xC7, 0x39, 0xE7, 0x1C, 0xE3, 0x8E, 0x38, 0xE3, 0x87, 0x1C, 0x38, 0xE1, 0xC3, 0x00,
+  0x00, 0x00,
+  /* ')' */
+  0x00, 0x0C, 0x38, 0x71, 0xC3, 0x8E, 0x1C, 0x71, 0xC7, 0x1C, 0x73, 0x8E, 0x79, 0xCE, 0x30, 0x00,
+  0x00, 0x00,
+  /* '*' */
+  0x17, 0x81, 0x07, 0x81, 0x07, 0x81, 0x03, 0x82, 0x00, 0x81, 0x00, 0x8C, 0x01, 0x85, 0x04, 0x83,
+  0x05, 0x83, 0x04, 0x81, 0x01, 0x81, 0x03, 0x81, 0x01, 0x81, 0x79,
+  /* '+' */
+  0x34, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x04, 0x97, 0x04, 0x81, 0x09, 0x81,
+  0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x64,
+  /* ',' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0x73, 0x19, 0x8C, 0x00, 0x00,
+  /* '-' */
+  0x59, 0x93, 0x7F, 0x01,
+  /* '.' */
+  0x37, 0x8B, 0x1B,
+  /* '/' */
+  0x00, 0xC0, 0x30, 0x1C, 0x06, 0x03, 0x80, 0xC0, 0x30, 0x18, 0x06, 0x03, 0x00, 0xC0, 0x60, 0x18,
+  0x0C, 0x03, 0x01, 0xC0, 0x60, 0x38, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '0' */
+  0x00, 0x00, 0x01, 0xE0, 0xFC, 0x61, 0x98, 0x6C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0,
+  0xD8, 0x66, 0x18, 0xFC, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '1' */
+  0x00, 0x00, 0x00, 0x40, 0xF0, 0xFC, 0x3B, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C,
+  0x03, 0x00, 0xC3, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '2' */
+  0x00, 0x00, 0x00, 0x7C, 0x3F, 0xEE, 0x0D, 0x80, 0xF0, 0x18, 0x03, 0x00, 0xC0, 0x30, 0x1C, 0x07,
+  0x01, 0x80, 0x60, 0x18, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00,
+  /* '3' */
+  0x00, 0x00, 0x01, 0xE1, 0xFC, 0x63, 0x80, 0x60, 0x18, 0x0C, 0x1E, 0x07, 0xC0, 0x38, 0x03, 0x00,
+  0xC0, 0x3C, 0x1F, 0xFE, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '4' */
+  0x00, 0x00, 0x00, 0x0E, 0x03, 0xC0, 0x78, 0x1B, 0x06, 0x60, 0xCC, 0x31, 0x86, 0x31, 0x86, 0x60,
+  0xCF, 0xFF, 0xFF, 0xC0, 0x60, 0x7F, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00,
+  /* '5' */
+  0x00, 0x00, 0x01, 0xFF, 0x3F, 0xE6, 0x00, 0xC0, 0x18, 0x03, 0x78, 0x7F, 0xCE, 0x18, 0x01, 0x80,
+  0x30, 0x06, 0x00, 0xF0, 0x37, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00,
+  /* '6' */
+  0x00, 0x00, 0x00, 0x7C, 0x7F, 0x38, 0x1C, 0x06, 0x03, 0x00, 0xDE, 0x3F, 0xEE, 0x1B, 0x03, 0xC0,
+  0xF0, 0x36, 0x1D, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '7' */
+  0x13, 0x95, 0x05, 0x83, 0x04, 0x82, 0x06, 0x81, 0x07, 0x81, 0x06, 0x82, 0x06, 0x81, 0x07, 0x81,
+  0x06, 0x82, 0x06, 0x81, 0x07, 0x81, 0x06, 0x82, 0x06, 0x81, 0x07, 0x81, 0x49,
+  /* '8' */
+  0x00, 0x00, 0x03, 0xF1, 0xFE, 0xE1, 0xF0, 0x3C, 0x0D, 0x86, 0x3F, 0x0F, 0xC6, 0x1B, 0x03, 0xC0,
+  0xF0, 0x3E, 0x1D, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '9' */
+  0x00, 0x00, 0x03, 0xE1, 0xFE, 0xE1, 0xB0, 0x3C, 0x0F, 0x03, 0x61, 0xDF, 0xF1, 0xEC, 0x03, 0x01,
+  0x80, 0xE0, 0x73, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ':' */
+  0x17, 0x8B, 0x13, 0x8B, 0x1B,
+  /* ';' */
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xCF, 0x3C, 0x00, 0x00, 0x00, 0xE7, 0x18, 0x63, 0x08, 0x00, 0x00,
+  0x00, 0x00,
+  /* '<' */
+  0x42, 0x82, 0x09, 0x83, 0x07, 0x83, 0x07, 0x83, 0x07, 0x83, 0x07, 0x83, 0x07, 0x83, 0x0B, 0x83,
+  0x0B, 0x83, 0x0B, 0x83, 0x0B, 0x83, 0x0B, 0x83, 0x0A, 0x82, 0x61,
+  /* '=' */
+  0x5A, 0x99, 0x19, 0x99, 0x7F, 0x0E,
+  /* '>' */
+  0x37, 0x82, 0x0A, 0x83, 0x0B, 0x83, 0x0B, 0x83, 0x0B, 0x83, 0x0B, 0x83, 0x0B, 0x83, 0x07, 0x83,
+  0x07, 0x83, 0x07, 0x83, 0x07, 0x83, 0x07, 0x83, 0x09, 0x82, 0x6C,
+  /* '?' */
+  0x00, 0x00, 0x00, 0x07, 0xC7, 0xF6, 0x1F, 0x07, 0x83, 0x03, 0x83, 0x87, 0x83, 0x81, 0x80, 0x00,
+  0x00, 0x70, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '@' */
+  0x00, 0x00, 0x01, 0xF0, 0xFE, 0x71, 0xD8, 0x3C, 0x3F, 0x1F, 0xCE, 0xF3, 0x3C, 0xCF, 0x33, 0xC7,
+  0xF0, 0xFC, 0x01, 0x80, 0x70, 0xCF, 0xF1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'A' */
+  0x32, 0x85, 0x09, 0x86, 0x0C, 0x82, 0x0B, 0x81, 0x00, 0x81, 0x0A, 0x81, 0x00, 0x81, 0x09, 0x81,
+  0x02, 0x81, 0x08, 0x81, 0x02, 0x81, 0x07, 0x81, 0x03, 0x81, 0x07, 0x88, 0x05, 0x89, 0x05, 0x81,
+  0x06, 0x81, 0x03, 0x81, 0x07, 0x81, 0x01, 0x85, 0x02, 0x8C, 0x02, 0x86, 0x6F,
+  /* 'B' */
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x8F, 0xFE, 0x18, 0x38, 0xC0, 0xC6, 0x06, 0x30, 0x71, 0xFF,
+  0x0F, 0xFC, 0x60, 0x73, 0x01, 0x98, 0x0C, 0xC0, 0x7F, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'C' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x3F, 0xF7, 0x07, 0x60, 0x3C, 0x03, 0xC0, 0x0C, 0x00, 0xC0,
+  0x0C, 0x00, 0xC0, 0x06, 0x03, 0x70, 0x73, 0xFE, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  /* 'D' */
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x0F, 0xFE, 0x18, 0x38, 0xC0, 0xC6, 0x03, 0x30, 0x19, 0x80,
+  0xCC, 0x06, 0x60, 0x33, 0x01, 0x98, 0x18, 0xC1, 0xDF, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'E' */
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF3, 0x03, 0x30, 0x33, 0x33, 0x33, 0x03, 0xF0, 0x3F,
+  0x03, 0x30, 0x33, 0x33, 0x03, 0x30, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  /* 'F' */
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF3, 0x03, 0x30, 0x33, 0x33, 0x33, 0x03, 0xF0, 0x3F,
+  0x03, 0x30, 0x33, 0x03, 0x00, 0x30, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  /* 'G' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x63, 0xFF, 0x38, 0x39, 0x80, 0xD8, 0x06, 0xC0, 0x06, 0x00,
+  0x30, 0xFF, 0x87, 0xFC, 0x03, 0x70, 0x19, 0xC1, 0xC7, 0xFE, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'H' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0xFC, 0xFC, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30,
+  0xFF, 0xC3, 0xFF, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x3F, 0x3F, 0xFC, 0xFC, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'I' */
+  0x1D, 0x93, 0x03, 0x81, 0x07, 0x81, 0x07, 0x81, 0x07, 0x81, 0x07, 0x81, 0x07, 0x81, 0x07, 0x81,
+  0x07, 0x81, 0x07, 0x81, 0x07, 0x81, 0x03, 0x93, 0x45,
+  /* 'J' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x60, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x06,
+  0x30, 0x31, 0x81, 0x8C, 0x0C, 0x60, 0x63, 0x06, 0x1F, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'K' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF3, 0xEF, 0xE7, 0xC6, 0x0C, 0x0C, 0x30, 0x18, 0xC0, 0x33,
+  0x00, 0x6E, 0x00, 0xFE, 0x01, 0xCE, 0x03, 0x0E, 0x06, 0x0C, 0x0C, 0x1C, 0x7F, 0x1F, 0xFE, 0x3E,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'L' */
+  0x26, 0x87, 0x04, 0x87, 0x07, 0x81, 0x0A, 0x81, 0x0A, 0x81, 0x0A, 0x81, 0x0A, 0x81, 0x0A, 0x81,
+  0x0A, 0x81, 0x05, 0x81, 0x02, 0x81, 0x05, 0x81, 0x02, 0x81, 0x05, 0x81, 0x02, 0x81, 0x05, 0x9B,
+  0x5A,
+  /* 'M' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0xF8, 0x1F, 0x38, 0x1C, 0x3C, 0x3C, 0x3C, 0x3C,
+  0x36, 0x6C, 0x36, 0x6C, 0x33, 0xCC, 0x33, 0xCC, 0x31, 0x8C, 0x30, 0x0C, 0x30, 0x0C, 0xFE, 0x7F,
+  0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'N' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x7F, 0xF1, 0xFC, 0xE0, 0xC3, 0xC3, 0x0F, 0x8C, 0x36, 0x30,
+  0xDC, 0xC3, 0x3B, 0x0C, 0x6C, 0x31, 0xF0, 0xC3, 0xC3, 0x07, 0x3F, 0x8C, 0xFE, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'O' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0xC7, 0x0E, 0x60, 0x6E, 0x07, 0xC0, 0x3C, 0x03, 0xC0,
+  0x3C, 0x03, 0xE0, 0x76, 0x06, 0x70, 0xE3, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  /* 'P' */
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xE3, 0x07, 0x30, 0x33, 0x03, 0x30, 0x33, 0x06, 0x3F,
+  0xE3, 0xF8, 0x30, 0x03, 0x00, 0x30, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  /* 'Q' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0xC7, 0x0E, 0x60, 0x6E, 0x07, 0xC0, 0x3C, 0x03, 0xC0,
+  0x3C, 0x03, 0xE0, 0x76, 0x06, 0x70, 0xE3, 0xFC, 0x1F, 0x01, 0xF3, 0x3F, 0xF3, 0x0E, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  /* 'R' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xE0, 0xC1, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x70,
+  0xFF, 0x83, 0xF8, 0x0C, 0x70, 0x30, 0xE0, 0xC1, 0x83, 0x07, 0x3F, 0x8F, 0xFE, 0x1C, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'S' */
+  0x1F, 0x84, 0x00, 0x81, 0x00, 0x8B, 0x03, 0x84, 0x05, 0x83, 0x05, 0x85, 0x06, 0x85, 0x05, 0x85,
+  0x06, 0x85, 0x05, 0x83, 0x05, 0x84, 0x03, 0x8B, 0x00, 0x81, 0x00, 0x84, 0x47,
+  /* 'T' */
+  0x23, 0x99, 0x02, 0x81, 0x02, 0x83, 0x02, 0x81, 0x02, 0x83, 0x02, 0x81, 0x02, 0x83, 0x02, 0x81,
+  0x02, 0x81, 0x04, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x06, 0x87,
+  0x03, 0x87, 0x55,
+  /* 'U' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0xFC, 0xFC, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30,
+  0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC1, 0x86, 0x07, 0xF8, 0x07, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'V' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF7, 0xFF, 0xEF, 0xE6, 0x03, 0x06, 0x0C, 0x0C, 0x18, 0x18,
+  0x30, 0x18, 0xC0, 0x31, 0x80, 0x36, 0x00, 0x6C, 0x00, 0xD8, 0x00, 0xE0, 0x01, 0xC0, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'W' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xFF, 0xE3, 0xF9, 0x80, 0x30, 0xC0, 0x18, 0x61,
+  0x0C, 0x19, 0xCC, 0x0C, 0xE6, 0x06, 0xDB, 0x03, 0x6D, 0x81, 0xE7, 0xC0, 0x71, 0xC0, 0x38, 0xE0,
+  0x18, 0x30, 0x0C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  /* 'X' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0xFC, 0xFC, 0xC0, 0xC1, 0x86, 0x03, 0x30, 0x07, 0x80,
+  0x0C, 0x00, 0x30, 0x01, 0xE0, 0x0C, 0xC0, 0x61, 0x83, 0x03, 0x3F, 0x3F, 0xFC, 0xFC, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'Y' */
+  0x29, 0x84, 0x02, 0x8A, 0x02, 0x85, 0x01, 0x81, 0x05, 0x81, 0x04, 0x81, 0x03, 0x81, 0x06, 0x81,
+  0x01, 0x81, 0x07, 0x81, 0x01, 0x81, 0x08, 0x83, 0x0A, 0x81, 0x0B, 0x81, 0x0B, 0x81, 0x0B, 0x81,
+  0x0B, 0x81, 0x08, 0x87, 0x05, 0x87, 0x64,
+  /* 'Z' */
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0xF7, 0xFE, 0xC0, 0xD8, 0x33, 0x0C, 0x63, 0x00, 0xC0, 0x30, 0x0C,
+  0x33, 0x06, 0xC0, 0xF0, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00,
+  /* '[' */
+  0x00, 0x3F, 0xFC, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x3F, 0xF0, 0x00, 0x00,
+  /* '\\' */
+  0xC0, 0x30, 0x0E, 0x01, 0x80, 0x70, 0x0C, 0x03, 0x00, 0x60, 0x18, 0x03, 0x00, 0xC0, 0x18, 0x06,
+  0x00, 0xC0, 0x30, 0x0E, 0x01, 0x80, 0x70, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ']' */
+  0x00, 0x3F, 0xF1, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xFF, 0xF0, 0x00, 0x00,
+  /* '^' */
+  0x0F, 0x80, 0x08, 0x82, 0x06, 0x84, 0x04, 0x82, 0x00, 0x82, 0x03, 0x81, 0x02, 0x81, 0x02, 0x81,
+  0x04, 0x81, 0x00, 0x81, 0x06, 0x82, 0x08, 0x80, 0x7F, 0x24,
+  /* '_' */
+  0x7F, 0x7F, 0x5F, 0x9F,
+  /* '`' */
+  0x04, 0x81, 0x02, 0x82, 0x03, 0x82, 0x02, 0x81, 0x5E,
+  /* 'a' */
+  0x49, 0x85, 0x04, 0x87, 0x0A, 0x81, 0x09, 0x81, 0x04, 0x86, 0x02, 0x88, 0x01, 0x82, 0x04, 0x81,
+  0x01, 0x81, 0x05, 0x81, 0x01, 0x81, 0x04, 0x82, 0x02, 0x8A, 0x01, 0x84, 0x00, 0x83, 0x53,
+  /* 'b' */
+  0x00, 0x00, 0x00, 0x3C, 0x01, 0xE0, 0x03, 0x00, 0x18, 0x00, 0xDF, 0x07, 0xFE, 0x38, 0x31, 0x80,
+  0xCC, 0x06, 0x60, 0x33, 0x01, 0x98, 0x0C, 0xE0, 0xDF, 0xFE, 0xF7, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'c' */
+  0x4B, 0x84, 0x00, 0x81, 0x01, 0x89, 0x00, 0x82, 0x04, 0x85, 0x06, 0x83, 0x07, 0x83, 0x09, 0x81,
+  0x09, 0x82, 0x06, 0x81, 0x00, 0x82, 0x04, 0x82, 0x01, 0x88, 0x04, 0x85, 0x55,
+  /* 'd' */
+  0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xC0, 0x06, 0x00, 0x30, 0x7D, 0x8F, 0xFC, 0x60, 0xE6, 0x03,
+  0x30, 0x19, 0x80, 0xCC, 0x06, 0x60, 0x31, 0x83, 0x8F, 0xFF, 0x1F, 0x78, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'e' */
+  0x4A, 0x85, 0x03, 0x89, 0x01, 0x81, 0x05, 0x81, 0x00, 0x81, 0x07, 0x9B, 0x09, 0x81, 0x0A, 0x81,
+  0x06, 0x81, 0x00, 0x8A, 0x02, 0x86, 0x55,
+  /* 'f' */
+  0x1C, 0x86, 0x03, 0x87, 0x02, 0x81, 0x09, 0x81, 0x06, 0x8A, 0x00, 0x8A, 0x03, 0x81, 0x09, 0x81,
+  0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x06, 0x89, 0x01, 0x89, 0x55,
+  /* 'g' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xEF, 0xFF, 0x60, 0xE6, 0x03,
+  0x30, 0x19, 0x80, 0xCC, 0x06, 0x60, 0x31, 0x83, 0x8F, 0xFC, 0x1F, 0x60, 0x03, 0x00, 0x18, 0x01,
+  0xC3, 0xFC, 0x1F, 0x80, 0x00, 0x00, 0x00,
+  /* 'h' */
+  0x00, 0x00, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x7C, 0x0F, 0xF8, 0x38, 0x70,
+  0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x3F, 0x3F, 0xFC, 0xFC, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'i' */
+  0x1C, 0x81, 0x09, 0x81, 0x1D, 0x85, 0x05, 0x85, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81,
+  0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x04, 0x97, 0x53,
+  /* 'j' */
+  0x00, 0x00, 0x01, 0x80, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C,
+  0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x7F, 0xF7, 0xE0, 0x00, 0x00,
+  /* 'k' */
+  0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x30, 0x03, 0x00, 0x33, 0xE3, 0x3E, 0x33, 0x03, 0x60, 0x3E,
+  0x03, 0xC0, 0x3E, 0x03, 0x70, 0x33, 0x8F, 0x1F, 0xF1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  /* 'l' */
+  0x18, 0x85, 0x05, 0x85, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81,
+  0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x04, 0x97, 0x53,
+  /* 'm' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x78, 0xFF, 0xFC,
+  0x39, 0xCC, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0xFD, 0xEF,
+  0xFD, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'n' */
+  0x53, 0x83, 0x00, 0x84, 0x03, 0x8A, 0x04, 0x82, 0x03, 0x82, 0x03, 0x81, 0x05, 0x81, 0x03, 0x81,
+  0x05, 0x81, 0x03, 0x81, 0x05, 0x81, 0x03, 0x81, 0x05, 0x81, 0x03, 0x81, 0x05, 0x81, 0x03, 0x81,
+  0x05, 0x81, 0x01, 0x85, 0x01, 0x8B, 0x01, 0x85, 0x61,
+  /* 'o' */
+  0x4B, 0x83, 0x05, 0x87, 0x02, 0x82, 0x03, 0x82, 0x00, 0x82, 0x05, 0x84, 0x07, 0x83, 0x07, 0x83,
+  0x07, 0x84, 0x05, 0x82, 0x00, 0x82, 0x03, 0x82, 0x02, 0x87, 0x05, 0x83, 0x57,
+  /* 'p' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDF, 0x1F, 0xFE, 0x38, 0x31, 0x80,
+  0xCC, 0x06, 0x60, 0x33, 0x01, 0x98, 0x0C, 0xE0, 0xC7, 0xFE, 0x37, 0xC1, 0x80, 0x0C, 0x00, 0x60,
+  0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00,
+  /* 'q' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xEF, 0xFF, 0x60, 0xE6, 0x03,
+  0x30, 0x19, 0x80, 0xCC, 0x06, 0x60, 0x31, 0x83, 0x8F, 0xFC, 0x1F, 0x60, 0x03, 0x00, 0x18, 0x00,
+  0xC0, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x00,
+  /* 'r' */
+  0x47, 0x84, 0x01, 0x83, 0x00, 0x84, 0x00, 0x85, 0x02, 0x84, 0x01, 0x81, 0x02, 0x82, 0x08, 0x81,
+  0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x06, 0x89, 0x01, 0x89, 0x55,
+  /* 's' */
+  0x3D, 0x87, 0x00, 0x8A, 0x05, 0x83, 0x05, 0x87, 0x04, 0x87, 0x05, 0x86, 0x05, 0x83, 0x04, 0x8B,
+  0x00, 0x87, 0x47,
+  /* 't' */
+  0x19, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x07, 0x89, 0x01, 0x89, 0x03, 0x81, 0x09, 0x81,
+  0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x04, 0x82, 0x02, 0x88, 0x03, 0x85,
+  0x55,
+  /* 'u' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x3C, 0x3C, 0x30, 0x30,
+  0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x07, 0x07, 0xFF, 0x0F, 0xBC, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'v' */
+  0x53, 0x84, 0x03, 0x89, 0x03, 0x84, 0x01, 0x81, 0x05, 0x81, 0x03, 0x81, 0x05, 0x81, 0x04, 0x81,
+  0x03, 0x81, 0x05, 0x81, 0x03, 0x81, 0x06, 0x81, 0x01, 0x81, 0x07, 0x81, 0x01, 0x81, 0x07, 0x85,
+  0x08, 0x83, 0x09, 0x83, 0x66,
+  /* 'w' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC1, 0xFE, 0x0F, 0x62, 0x33, 0x39,
+  0x99, 0xCC, 0x6A, 0xC3, 0xDE, 0x1E, 0xF0, 0xE3, 0x03, 0x18, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* 'x' */
+  0x47, 0x84, 0x01, 0x89, 0x01, 0x84, 0x01, 0x81, 0x03, 0x81, 0x04, 0x81, 0x01, 0x81, 0x06, 0x83,
+  0x08, 0x81, 0x08, 0x83, 0x06, 0x81, 0x01, 0x81, 0x04, 0x81, 0x03, 0x81, 0x01, 0x84, 0x01, 0x89,
+  0x01, 0x84, 0x53,
+  /* 'y' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0xFE, 0x1F, 0x30,
+  0x18, 0x30, 0x60, 0x60, 0xC0, 0x63, 0x00, 0xC6, 0x00, 0xD8, 0x01, 0xF0, 0x01, 0xC0, 0x01, 0x80,
+  0x06, 0x00, 0x0C, 0x00, 0x30, 0x07, 0xF8, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  /* 'z' */
+  0x3B, 0x95, 0x04, 0x81, 0x00, 0x81, 0x03, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81,
+  0x03, 0x81, 0x00, 0x81, 0x04, 0x95, 0x45,
+  /* '{' */
+  0x00, 0x01, 0xCF, 0x30, 0xC3, 0x0C, 0x30, 0xC7, 0x38, 0x70, 0xC3, 0x0C, 0x30, 0xC3, 0xC7, 0x00,
+  0x00, 0x00,
+  /* '|' */
+  0x03, 0xA3, 0x07,
+  /* '}' */
+  0x00, 0x0E, 0x3C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x87, 0x38, 0xC3, 0x0C, 0x30, 0xCF, 0x38, 0x00,
+  0x00, 0x00,
+  /* '~' */
+  0x59, 0x82, 0x06, 0x84, 0x02, 0x84, 0x00, 0x82, 0x00, 0x84, 0x02, 0x84, 0x06, 0x82, 0x7A,
+};
+
+static const sPGLYPH PFont24_Glyphs[] PROGMEM = {
+  {   0,  0,  8}, /* ' ' */
+  {   0,  3,  4}, /* '!' */
+  {   9,  8,  9}, /* '"' */
+  {  33, 11, 12}, /* '#' */
+  {  66,  9, 10}, /* '$' */
+  {  93, 10, 11}, /* '%' */
+  { 123, 11, 12}, /* '&' */
+  { 156,  3,  4}, /* ''' */
+  { 165,  6,  7}, /* '(' */
+  { 183,  6,  7}, /* ')' */
+  { 201, 10 | PGLYPH_RLE, 11}, /* '*' */
+  { 228, 12 | PGLYPH_RLE, 13}, /* '+' */
+  { 251,  5,  6}, /* ',' */
+  { 266, 10 | PGLYPH_RLE, 11}, /* '-' */
+  { 270,  4 | PGLYPH_RLE,  5}, /* '.' */
+  { 273, 10, 11}, /* '/' */
+  { 303, 10, 11}, /* '0' */
+  { 333, 10, 11}, /* '1' */
+  { 363, 11, 12}, /* '2' */
+  { 396, 10, 11}, /* '3' */
+  { 426, 11, 12}, /* '4' */
+  { 459, 11, 12}, /* '5' */
+  { 492, 10, 11}, /* '6' */
+  { 522, 10 | PGLYPH_RLE, 11}, /* '7' */
+  { 551, 10, 11}, /* '8' */
+  { 581, 10, 11}, /* '9' */
+  { 611,  4 | PGLYPH_RLE,  5}, /* ':' */
+  { 616,  6,  7}, /* ';' */
+  { 634, 14 | PGLYPH_RLE, 15}, /* '<' */
+  { 661, 13 | PGLYPH_RLE, 14}, /* '=' */
+  { 667, 14 | PGLYPH_RLE, 15}, /* '>' */
+  { 694,  9, 10}, /* '?' */
+  { 721, 10, 11}, /* '@' */
+  { 751, 16 | PGLYPH_RLE, 17}, /* 'A' */
+  { 796, 13, 14}, /* 'B' */
+  { 835, 12, 13}, /* 'C' */
+  { 871, 13, 14}, /* 'D' */
+  { 910, 12, 13}, /* 'E' */
+  { 946, 12, 13}, /* 'F' */
+  { 982, 13, 14}, /* 'G' */
+  {1021, 14, 15}, /* 'H' */
+  {1063, 10 | PGLYPH_RLE, 11}, /* 'I' */
+  {1088, 13, 14}, /* 'J' */
+  {1127, 15, 16}, /* 'K' */
+  {1172, 13 | PGLYPH_RLE, 14}, /* 'L' */
+  {1205, 16, 17}, /* 'M' */
+  {1253, 14, 15}, /* 'N' */
+  {1295, 12, 13}, /* 'O' */
+  {1331, 12, 13}, /* 'P' */
+  {1367, 12, 13}, /* 'Q' */
+  {1403, 14, 15}, /* 'R' */
+  {1445, 10 | PGLYPH_RLE, 11}, /* 'S' */
+  {1474, 12 | PGLYPH_RLE, 13}, /* 'T' */
+  {1509, 14, 15}, /* 'U' */
+  {1551, 15, 16}, /* 'V' */
+  {1596, 17, 18}, /* 'W' */
+  {1647, 14, 15}, /* 'X' */
+  {1689, 14 | PGLYPH_RLE, 15}, /* 'Y' */
+  {1728, 11, 12}, /* 'Z' */
+  {1761,  5,  6}, /* '[' */
+  {1776, 10, 11}, /* '\\' */
+  {1806,  5,  6}, /* ']' */
+  {1821, 11 | PGLYPH_RLE, 12}, /* '^' */
+  {1847, 16 | PGLYPH_RLE, 17}, /* '_' */
+  {1851,  5 | PGLYPH_RLE,  6}, /* '`' */
+  {1860, 12 | PGLYPH_RLE, 13}, /* 'a' */
+  {1891, 13, 14}, /* 'b' */
+  {1930, 12 | PGLYPH_RLE, 13}, /* 'c' */
+  {1959, 13, 14}, /* 'd' */
+  {1998, 12 | PGLYPH_RLE, 13}, /* 'e' */
+  {2021, 12 | PGLYPH_RLE, 13}, /* 'f' */
+  {2052, 13, 14}, /* 'g' */
+  {2091, 14, 15}, /* 'h' */
+  {2133, 12 | PGLYPH_RLE, 13}, /* 'i' */
+  {2158,  9, 10}, /* 'j' */
+  {2185, 12, 13}, /* 'k' */
+  {2221, 12 | PGLYPH_RLE, 13}, /* 'l' */
+  {2250, 16, 17}, /* 'm' */
+  {2298, 14 | PGLYPH_RLE, 15}, /* 'n' */
+  {2339, 12 | PGLYPH_RLE, 13}, /* 'o' */
+  {2368, 13, 14}, /* 'p' */
+  {2407, 13, 14}, /* 'q' */
+  {2446, 12 | PGLYPH_RLE, 13}, /* 'r' */
+  {2475, 10 | PGLYPH_RLE, 11}, /* 's' */
+  {2494, 12 | PGLYPH_RLE, 13}, /* 't' */
+  {2527, 14, 15}, /* 'u' */
+  {2569, 14 | PGLYPH_RLE, 15}, /* 'v' */
+  {2606, 13, 14}, /* 'w' */
+  {2645, 12 | PGLYPH_RLE, 13}, /* 'x' */
+  {2680, 15, 16}, /* 'y' */
+  {2725, 10 | PGLYPH_RLE, 11}, /* 'z' */
+  {2748,  6,  7}, /* '{' */
+  {2766,  2 | PGLYPH_RLE,  3}, /* '|' */
+  {2769,  6,  7}, /* '}' */
+  {2787, 11 | PGLYPH_RLE, 12}, /* '~' */
+};
+
+const sPFONT PFont24 = {
+  PFont24_Bitmaps,
+  PFont24_Glyphs,
+  ' ',
+  '~',
+  24, /* Height */
+};
@@ -0,0 +1,123 @@
+/* Generated by tools/make_proportional_fonts.cpp - do not edit */
+
+#include <pgmspace.h>
+#include "pfonts.h"
+
+static const uint8_t PFont24Digits_Bitmaps[] PROGMEM = {
+  /* ' ' */
+  /* '!' */
+  0x03, 0xFF, 0xFF, 0xFF, 0xA4, 0x07, 0xE0, 0x00, 0x00,
+  /* '"' */
+  0x00, 0x00, 0x00, 0xE7, 0xE7, 0xE7, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '#' */
+  0x00, 0x00, 0x00, 0x66, 0x0C, 0xC1, 0x98, 0x33, 0x06, 0x67, 0xFF, 0xFF, 0xE3, 0x30, 0xCC, 0x7F,
+  0xFF, 0xFE, 0x66, 0x0C, 0xC1, 0x98, 0x33, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00,
+  /* '$' */
+  0x00, 0x06, 0x03, 0x07, 0xB7, 0xFE, 0x1F, 0x0F, 0xC0, 0x7C, 0x1F, 0x81, 0xF8, 0x3E, 0x1F, 0x1F,
+  0xFD, 0xBC, 0x0C, 0x06, 0x03, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
+  /* '%' */
+  0x00, 0x00, 0x03, 0xC1, 0xF8, 0xE7, 0x30, 0xCC, 0x33, 0x9C, 0x7F, 0xCF, 0xCF, 0xF8, 0xE7, 0x30,
+  0xCC, 0x33, 0x9C, 0x7E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '&' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x7F, 0x18, 0xC3, 0x00, 0x60, 0x06, 0x00, 0xE0, 0x3E,
+  0x7E, 0xFF, 0x8F, 0x30, 0xE3, 0xFF, 0x3E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00,
+  /* ''' */
+  0x00, 0x7F, 0xD2, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '(' */
+  0x00, 0x00, 0xC7, 0x39, 0xE7, 0x1C, 0xE3, 0x8E, 0x38, 0xE3, 0x87, 0x1C, 0x38, 0xE1, 0xC3, 0x00,
+  0x00, 0x00,
+  /* ')' */
+  0x00, 0x0C, 0x38, 0x71, 0xC3, 0x8E, 0x1C, 0x71, 0xC7, 0x1C, 0x73, 0x8E, 0x79, 0xCE, 0x30, 0x00,
+  0x00, 0x00,
+  /* '*' */
+  0x17, 0x81, 0x07, 0x81, 0x07, 0x81, 0x03, 0x82, 0x00, 0x81, 0x00, 0x8C, 0x01, 0x85, 0x04, 0x83,
+  0x05, 0x83, 0x04, 0x81, 0x01, 0x81, 0x03, 0x81, 0x01, 0x81, 0x79,
+  /* '+' */
+  0x34, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x04, 0x97, 0x04, 0x81, 0x09, 0x81,
+  0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x64,
+  /* ',' */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0x73, 0x19, 0x8C, 0x00, 0x00,
+  /* '-' */
+  0x59, 0x93, 0x7F, 0x01,
+  /* '.' */
+  0x37, 0x8B, 0x1B,
+  /* '/' */
+  0x00, 0xC0, 0x30, 0x1C, 0x06, 0x03, 0x80, 0xC0, 0x30, 0x18, 0x06, 0x03, 0x00, 0xC0, 0x60, 0x18,
+  0x0C, 0x03, 0x01, 0xC0, 0x60, 0x38, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '0' */
+  0x00, 0x00, 0x01, 0xE0, 0xFC, 0x61, 0x98, 0x6C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0,
+  0xD8, 0x66, 0x18, 0xFC, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '1' */
+  0x00, 0x00, 0x00, 0x40, 0xF0, 0xFC, 0x3B, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C,
+  0x03, 0x00, 0xC3, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '2' */
+  0x00, 0x00, 0x00, 0x7C, 0x3F, 0xEE, 0x0D, 0x80, 0xF0, 0x18, 0x03, 0x00, 0xC0, 0x30, 0x1C, 0x07,
+  0x01, 0x80, 0x60, 0x18, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00,
+  /* '3' */
+  0x00, 0x00, 0x01, 0xE1, 0xFC, 0x63, 0x80, 0x60, 0x18, 0x0C, 0x1E, 0x07, 0xC0, 0x38, 0x03, 0x00,
+  0xC0, 0x3C, 0x1F, 0xFE, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '4' */
+  0x00, 0x00, 0x00, 0x0E, 0x03, 0xC0, 0x78, 0x1B, 0x06, 0x60, 0xCC, 0x31, 0x86, 0x31, 0x86, 0x60,
+  0xCF, 0xFF, 0xFF, 0xC0, 0x60, 0x7F, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00,
+  /* '5' */
+  0x00, 0x00, 0x01, 0xFF, 0x3F, 0xE6, 0x00, 0xC0, 0x18, 0x03, 0x78, 0x7F, 0xCE, 0x18, 0x01, 0x80,
+  0x30, 0x06, 0x00, 0xF0, 0x37, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00,
+  /* '6' */
+  0x00, 0x00, 0x00, 0x7C, 0x7F, 0x38, 0x1C, 0x06, 0x03, 0x00, 0xDE, 0x3F, 0xEE, 0x1B, 0x03, 0xC0,
+  0xF0, 0x36, 0x1D, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '7' */
+  0x13, 0x95, 0x05, 0x83, 0x04, 0x82, 0x06, 0x81, 0x07, 0x81, 0x06, 0x82, 0x06, 0x81, 0x07, 0x81,
+  0x06, 0x82, 0x06, 0x81, 0x07, 0x81, 0x06, 0x82, 0x06, 0x81, 0x07, 0x81, 0x49,
+  /* '8' */
+  0x00, 0x00, 0x03, 0xF1, 0xFE, 0xE1, 0xF0, 0x3C, 0x0D, 0x86, 0x3F, 0x0F, 0xC6, 0x1B, 0x03, 0xC0,
+  0xF0, 0x3E, 0x1D, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* '9' */
+  0x00, 0x00, 0x03, 0xE1, 0xFE, 0xE1, 0xB0, 0x3C, 0x0F, 0x03, 0x61, 0xDF, 0xF1, 0xEC, 0x03, 0x01,
+  0x80, 0xE0, 0x73, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* ':' */
+  0x17, 0x8B, 0x13, 0x8B, 0x1B,
+};
+
+static const sPGLYPH PFont24Digits_Glyphs[] PROGMEM = {
+  {   0,  0,  8}, /* ' ' */
+  {   0,  3,  4}, /* '!' */
+  {   9,  8,  9}, /* '"' */
+  {  33, 11, 12}, /* '#' */
+  {  66,  9, 10}, /* '$' */
+  {  93, 10, 11}, /* '%' */
+  { 123, 11, 12}, /* '&' */
+  { 156,  3,  4}, /* ''' */
+  { 165,  6,  7}, /* '(' */
+  { 183,  6,  7}, /* ')' */
+  { 201, 10 | PGLYPH_RLE, 11}, /* '*' */
+  { 228, 12 | PGLYPH_RLE, 13}, /* '+' */
+  { 251,  5,  6}, /* ',' */
+  { 266, 10 | PGLYPH_RLE, 11}, /* '-' */
+  { 270,  4 | PGLYPH_RLE,  5}, /* '.' */
+  { 273, 10, 11}, /* '/' */
+  { 303, 10, 11}, /* '0' */
+  { 333, 10, 11}, /* '1' */
+  { 363, 11, 12}, /* '2' */
+  { 396, 10, 11}, /* '3' */
+  { 426, 11, 12}, /* '4' */
+  { 459, 11, 12}, /* '5' */
+  { 492, 10, 11}, /* '6' */
+  { 522, 10 | PGLYPH_RLE, 11}, /* '7' */
+  { 551, 10, 11}, /* '8' */
+  { 581, 10, 11}, /* '9' */
+  { 611,  4 | PGLYPH_RLE,  5}, /* ':' */
+};
+
+const sPFONT PFont24Digits = {
+  PFont24Digits_Bitmaps,
+  PFont24Digits_Glyphs,
+  ' ',
+  ':',
+  24, /* Height */
+};
@@ -0,0 +1,302 @@
+/* Generated by tools/make_proportional_fonts.cpp - do not edit */
+
+#include <pgmspace.h>
+#include "pfonts.h"
+
+static const uint8_t PFont8_Bitmaps[] PROGMEM = {
+  /* ' ' */
+  /* '!' */
+  0xF4,
+  /* '"' */
+  0xB4, 0x00, 0x00,
+  /* '#' */
+  0x2A, 0xBE, 0xAF, 0xAA, 0x80,
+  /* '$' */
+  0x4F, 0x33, 0x90,
+  /* '%' */
+  0x44, 0x3C, 0x22, 0x00,
+  /* '&' */
+  0x07, 0x4C, 0xAF, 0x00,
+  /* ''' */
+  0xE0,
+  /* '(' */
+  0x6A, 0xA4,
+  /* ')' */
+  0x95, 0x58,
+  /* '*' */
+  0x5D, 0x50, 0x00,
+  /* '+' */
+  0x01, 0x09, 0xF2, 0x10, 0x00,
+  /* ',' */
+  0x00, 0x68,
+  /* '-' */
+  0x00, 0x70, 0x00,
+  /* '.' */
+  0x04,
+  /* '/' */
+  0x12, 0x22, 0x44, 0x80,
+  /* '0' */
+  0x56, 0xDA, 0x80,
+  /* '1' */
+  0x61, 0x08, 0x42, 0x7C, 0x00,
+  /* '2' */
+  0x55, 0x29, 0xC0,
+  /* '3' */
+  0x54, 0xA3, 0x80,
+  /* '4' */
+  0x26, 0xAF, 0x27, 0x00,
+  /* '5' */
+  0xF3, 0x1A, 0x80,
+  /* '6' */
+  0x73, 0x5B, 0x80,
+  /* '7' */
+  0xF4, 0xA4, 0x80,
+  /* '8' */
+  0x55, 0x5A, 0x80,
+  /* '9' */
+  0x76, 0xB3, 0x80,
+  /* ':' */
+  0x24,
+  /* ';' */
+  0x04, 0x60,
+  /* '<' */
+  0x01, 0x2C, 0x21, 0x00,
+  /* '=' */
+  0x1C, 0x70, 0x00,
+  /* '>' */
+  0x08, 0x43, 0x48, 0x00,
+  /* '?' */
+  0x54, 0xA0, 0x80,
+  /* '@' */
+  0x69, 0x9B, 0x98, 0x70,
+  /* 'A' */
+  0x61, 0x14, 0xE8, 0xEC, 0x00,
+  /* 'B' */
+  0xF2, 0x5C, 0x94, 0xF8, 0x00,
+  /* 'C' */
+  0xF6, 0x48, 0xC0,
+  /* 'D' */
+  0xF2, 0x52, 0x94, 0xF8, 0x00,
+  /* 'E' */
+  0xFA, 0x58, 0x84, 0xFC, 0x00,
+  /* 'F' */
+  0xFA, 0x58, 0x84, 0x70, 0x00,
+  /* 'G' */
+  0xE8, 0x8B, 0xA6, 0x00,
+  /* 'H' */
+  0xEA, 0x5E, 0x94, 0xF4, 0x00,
+  /* 'I' */
+  0xE9, 0x25, 0xC0,
+  /* 'J' */
+  0x72, 0x2A, 0xA4, 0x00,
+  /* 'K' */
+  0xDA, 0x98, 0xE5, 0x6C, 0x00,
+  /* 'L' */
+  0xE2, 0x10, 0x84, 0xFC, 0x00,
+  /* 'M' */
+  0xDE, 0xF7, 0x58, 0xEC, 0x00,
+  /* 'N' */
+  0xDB, 0x5A, 0xB5, 0xF4, 0x00,
+  /* 'O' */
+  0x69, 0x99, 0x96, 0x00,
+  /* 'P' */
+  0xF2, 0x52, 0xE4, 0x70, 0x00,
+  /* 'Q' */
+  0x69, 0x99, 0x96, 0x30,
+  /* 'R' */
+  0xF2, 0x52, 0xE4, 0xF4, 0x00,
+  /* 'S' */
+  0xF5, 0x1B, 0xC0,
+  /* 'T' */
+  0xFD, 0x48, 0x42, 0x38, 0x00,
+  /* 'U' */
+  0xDA, 0x52, 0x94, 0x98, 0x00,
+  /* 'V' */
+  0xDC, 0x52, 0xA5, 0x18, 0x00,
+  /* 'W' */
+  0xDC, 0x6B, 0x5A, 0xA8, 0x00,
+  /* 'X' */
+  0xDA, 0x88, 0x45, 0x6C, 0x00,
+  /* 'Y' */
+  0xDC, 0x54, 0x42, 0x38, 0x00,
+  /* 'Z' */
+  0xF9, 0x24, 0x9F, 0x00,
+  /* '[' */
+  0xEA, 0xAC,
+  /* '\\' */
+  0x84, 0x42, 0x22, 0x10,
+  /* ']' */
+  0xD5, 0x5C,
+  /* '^' */
+  0x4A, 0x80, 0x00,
+  /* '_' */
+  0x22, 0x84,
+  /* '`' */
+  0x90, 0x00,
+  /* 'a' */
+  0x00, 0x62, 0xEF, 0x00,
+  /* 'b' */
+  0xC2, 0x1C, 0x94, 0xF8, 0x00,
+  /* 'c' */
+  0x03, 0xC9, 0xC0,
+  /* 'd' */
+  0x31, 0x79, 0x97, 0x00,
+  /* 'e' */
+  0x03, 0xF8, 0xC0,
+  /* 'f' */
+  0x2B, 0xA5, 0xC0,
+  /* 'g' */
+  0x00, 0x79, 0x97, 0x16,
+  /* 'h' */
+  0xC2, 0x1C, 0x94, 0xF4, 0x00,
+  /* 'i' */
+  0x43, 0x25, 0xC0,
+  /* 'j' */
+  0x43, 0x92, 0x4F,
+  /* 'k' */
+  0xC2, 0x16, 0xE5, 0x6C, 0x00,
+  /* 'l' */
+  0xC9, 0x25, 0xC0,
+  /* 'm' */
+  0x00, 0x35, 0x5A, 0xD4, 0x00,
+  /* 'n' */
+  0x00, 0x3C, 0x94, 0xE4, 0x00,
+  /* 'o' */
+  0x00, 0x69, 0x96, 0x00,
+  /* 'p' */
+  0x00, 0x3C, 0x94, 0xB9, 0x1C,
+  /* 'q' */
+  0x00, 0x79, 0x97, 0x13,
+  /* 'r' */
+  0x00, 0xF4, 0x4E, 0x00,
+  /* 's' */
+  0x01, 0xA3, 0x80,
+  /* 't' */
+  0x02, 0x3C, 0x84, 0x98, 0x00,
+  /* 'u' */
+  0x00, 0x36, 0x94, 0x9C, 0x00,
+  /* 'v' */
+  0x00, 0x32, 0x93, 0x18, 0x00,
+  /* 'w' */
+  0x00, 0x37, 0x5A, 0xA8, 0x00,
+  /* 'x' */
+  0x00, 0x96, 0x69, 0x00,
+  /* 'y' */
+  0x00, 0x36, 0xA5, 0x10, 0x8C,
+  /* 'z' */
+  0x00, 0xFA, 0x5F, 0x00,
+  /* '{' */
+  0x29, 0x64, 0x88,
+  /* '|' */
+  0xFE,
+  /* '}' */
+  0x89, 0x34, 0xA0,
+  /* '~' */
+  0x00, 0x05, 0xA0, 0x00,
+};
+
+static const sPGLYPH PFont8_Glyphs[] PROGMEM = {
+  {   0,  0,  2}, /* ' ' */
+  {   0,  1,  2}, /* '!' */
+  {   1,  3,  4}, /* '"' */
+  {   4,  5,  6}, /* '#' */
+  {   9,  3,  4}, /* '$' */
+  {  12,  4,  5}, /* '%' */
+  {  16,  4,  5}, /* '&' */
+  {  20,  1,  2}, /* ''' */
+  {  21,  2,  3}, /* '(' */
+  {  23,  2,  3}, /* ')' */
+  {  25,  3,  4}, /* '*' */
+  {  28,  5,  6}, /* '+' */
+  {  33,  2,  3}, /* ',' */
+  {  35,  3,  4}, /* '-' */
+  {  38,  1,  2}, /* '.' */
+  {  39,  4,  5}, /* '/' */
+  {  43,  3,  4}, /* '0' */
+  {  46,  5,  6}, /* '1' */
+  {  51,  3,  4}, /* '2' */
+  {  54,  3,  4}, /* '3' */
+  {  57,  4,  5}, /* '4' */
+  {  61,  3,  4}, /* '5' */
+  {  64,  3,  4}, /* '6' */
+  {  67,  3,  4}, /* '7' */
+  {  70,  3,  4}, /* '8' */
+  {  73,  3,  4}, /* '9' */
+  {  76,  1,  2}, /* ':' */
+  {  77,  2,  3}, /* ';' */
+  {  79,  4,  5}, /* '<' */
+  {  83,  3,  4}, /* '=' */
+  {  86,  4,  5}, /* '>' */
+  {  90,  3,  4}, /* '?' */
+  {  93,  4,  5}, /* '@' */
+  {  97,  5,  6}, /* 'A' */
+  { 102,  5,  6}, /* 'B' */
+  { 107,  3,  4}, /* 'C' */
+  { 110,  5,  6}, /* 'D' */
+  { 115,  5,  6}, /* 'E' */
+  { 120,  5,  6}, /* 'F' */
+  { 125,  4,  5}, /* 'G' */
+  { 129,  5,  6}, /* 'H' */
+  { 134,  3,  4}, /* 'I' */
+  { 137,  4,  5}, /* 'J' */
+  { 141,  5,  6}, /* 'K' */
+  { 146,  5,  6}, /* 'L' */
+  { 151,  5,  6}, /* 'M' */
+  { 156,  5,  6}, /* 'N' */
+  { 161,  4,  5}, /* 'O' */
+  { 165,  5,  6}, /* 'P' */
+  { 170,  4,  5}, /* 'Q' */
+  { 174,  5,  6}, /* 'R' */
+  { 179,  3,  4}, /* 'S' */
+  { 182,  5,  6}, /* 'T' */
+  { 187,  5,  6}, /* 'U' */
+  { 192,  5,  6}, /* 'V' */
+  { 197,  5,  6}, /* 'W' */
+  { 202,  5,  6}, /* 'X' */
+  { 207,  5,  6}, /* 'Y' */
+  { 212,  4,  5}, /* 'Z' */
+  { 216,  2,  3}, /* '[' */
+  { 218,  4,  5}, /* '\\' */
+  { 222,  2,  3}, /* ']' */
+  { 224,  3,  4}, /* '^' */
+  { 227,  5 | PGLYPH_RLE,  6}, /* '_' */
+  { 229,  2,  3}, /* '`' */
+  { 231,  4,  5}, /* 'a' */
+  { 235,  5,  6}, /* 'b' */
+  { 240,  3,  4}, /* 'c' */
+  { 243,  4,  5}, /* 'd' */
+  { 247,  3,  4}, /* 'e' */
+  { 250,  3,  4}, /* 'f' */
+  { 253,  4,  5}, /* 'g' */
+  { 257,  5,  6}, /* 'h' */
+  { 262,  3,  4}, /* 'i' */
+  { 265,  3,  4}, /* 'j' */
+  { 268,  5,  6}, /* 'k' */
+  { 273,  3,  4}, /* 'l' */
+  { 276,  5,  6}, /* 'm' */
+  { 281,  5,  6}, /* 'n' */
+  { 286,  4,  5}, /* 'o' */
+  { 290,  5,  6}, /* 'p' */
+  { 295,  4,  5}, /* 'q' */
+  { 299,  4,  5}, /* 'r' */
+  { 303,  3,  4}, /* 's' */
+  { 306,  5,  6}, /* 't' */
+  { 311,  5,  6}, /* 'u' */
+  { 316,  5,  6}, /* 'v' */
+  { 321,  5,  6}, /* 'w' */
+  { 326,  4,  5}, /* 'x' */
+  { 330,  5,  6}, /* 'y' */
+  { 335,  4,  5}, /* 'z' */
+  { 339,  3,  4}, /* '{' */
+  { 342,  1,  2}, /* '|' */
+  { 343,  3,  4}, /* '}' */
+  { 346,  4,  5}, /* '~' */
+};
+
+const sPFONT PFont8 = {
+  PFont8_Bitmaps,
+  PFont8_Glyphs,
+  ' ',
+  '~',
+  8, /* Height */
+};
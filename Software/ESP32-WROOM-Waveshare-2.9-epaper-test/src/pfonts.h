@@ -0,0 +1,29 @@
+/* Generated by tools/make_proportional_fonts.cpp - do not edit */
+
+#ifndef __PFONTS_H
+#define __PFONTS_H
+
+#include "fonts.h"
+
+/* Proportional versions of the fonts in fonts.h - draw them with the
+   sPFONT overloads of Paint::DrawStringAt */
+
+/* Font8, ' ' to '~' */
+extern const sPFONT PFont8;
+
+/* Font12, ' ' to '~' */
+extern const sPFONT PFont12;
+
+/* Font16, ' ' to '~' */
+extern const sPFONT PFont16;
+
+/* Font20, ' ' to '~' */
+extern const sPFONT PFont20;
+
+/* Font24, ' ' to '~' */
+extern const sPFONT PFont24;
+
+/* Font24, ' ' to ':' */
+extern const sPFONT PFont24Digits;
+
+#endif /* __PFONTS_H */
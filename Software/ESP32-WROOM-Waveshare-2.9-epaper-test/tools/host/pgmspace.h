@@ -0,0 +1,7 @@
+#pragma once
+
+/* Flash is just memory on the host - enough for epdpaint.cpp and the font tables, see tools/paint_benchmark.cpp */
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#define pgm_read_word(addr) (*(const unsigned short *)(addr))
@@ -0,0 +1,206 @@
+/**
+ *  Writes src/pfonts.h and one src/pfontNN.cpp per font: the fonts in fonts.h
+ *  as proportional sPFONTs (see fonts.h). The blank columns either side of
+ *  each glyph are trimmed off, the bitmap is packed with no row padding and
+ *  run length encoded when that is smaller. The space keeps half the width of
+ *  the monospace font as its advance.
+ *
+ *  Each font is in a file of its own, and a sketch that only draws digits can
+ *  use a font of just the characters it needs (PFont24Digits), so only what a
+ *  build names is linked.
+ *
+ *  Prints the flash each font takes against its sFONT table.
+ *
+ *    g++ -O2 -std=gnu++11 -I tools/host -I src tools/make_proportional_fonts.cpp src/font[0-9]*.cpp -o /tmp/make_proportional_fonts
+ *    /tmp/make_proportional_fonts src
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "fonts.h"
+
+namespace {
+
+struct Font {
+    const char* name;
+    const char* file;
+    const char* source_name;
+    const sFONT* font;
+    char first;
+    char last;
+};
+
+const Font fonts[] = {
+    {"PFont8", "pfont8.cpp", "Font8", &Font8, ' ', '~'},
+    {"PFont12", "pfont12.cpp", "Font12", &Font12, ' ', '~'},
+    {"PFont16", "pfont16.cpp", "Font16", &Font16, ' ', '~'},
+    {"PFont20", "pfont20.cpp", "Font20", &Font20, ' ', '~'},
+    {"PFont24", "pfont24.cpp", "Font24", &Font24, ' ', '~'},
+    {"PFont24Digits", "pfont24digits.cpp", "Font24", &Font24, ' ', ':'},
+};
+
+/* The longest run one RLE byte holds */
+const int max_run = 128;
+
+bool FontPixel(const sFONT* font, int glyph, int i, int j) {
+    int stride = (font->Width + 7) / 8;
+    const uint8_t* row = font->table + (glyph * font->Height + j) * stride;
+    return (row[i / 8] >> (7 - i % 8)) & 1;
+}
+
+struct Glyph {
+    int width;
+    int advance;
+    bool rle;
+    std::vector<uint8_t> bytes;
+};
+
+Glyph MakeGlyph(const sFONT* font, int glyph) {
+    int left = font->Width;
+    int right = -1;
+    for (int j = 0; j < font->Height; j++) {
+        for (int i = 0; i < font->Width; i++) {
+            if (FontPixel(font, glyph, i, j)) {
+                left = i < left ? i : left;
+                right = i > right ? i : right;
+            }
+        }
+    }
+
+    Glyph result;
+    if (right < 0) {
+        /* Blank - the space */
+        result.width = 0;
+        result.advance = font->Width / 2 > 2 ? font->Width / 2 : 2;
+        result.rle = false;
+        return result;
+    }
+    result.width = right - left + 1;
+    result.advance = result.width + 1;
+
+    std::vector<bool> bits;
+    for (int j = 0; j < font->Height; j++) {
+        for (int i = left; i <= right; i++) {
+            bits.push_back(FontPixel(font, glyph, i, j));
+        }
+    }
+
+    std::vector<uint8_t> packed((bits.size() + 7) / 8, 0);
+    for (size_t n = 0; n < bits.size(); n++) {
+        if (bits[n]) {
+            packed[n / 8] |= 0x80 >> (n % 8);
+        }
+    }
+
+    std::vector<uint8_t> runs;
+    for (size_t n = 0; n < bits.size(); ) {
+        size_t length = 1;
+        while (n + length < bits.size() && bits[n + length] == bits[n] && length < max_run) {
+            length++;
+        }
+        runs.push_back((bits[n] ? 0x80 : 0) | (length - 1));
+        n += length;
+    }
+
+    result.rle = runs.size() < packed.size();
+    result.bytes = result.rle ? runs : packed;
+    return result;
+}
+
+bool WriteIfChanged(const std::string& path, const std::string& text) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file != NULL) {
+        std::string old;
+        char buffer[4096];
+        size_t n;
+        while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+            old.append(buffer, n);
+        }
+        fclose(file);
+        if (old == text) {
+            return true;
+        }
+    }
+
+    file = fopen(path.c_str(), "wb");
+    if (file == NULL) {
+        perror(path.c_str());
+        return false;
+    }
+    fwrite(text.data(), 1, text.size(), file);
+    fclose(file);
+    printf("wrote %s\n", path.c_str());
+    return true;
+}
+
+}
+
+int main(int argc, char** argv) {
+    std::string directory = argc > 1 ? argv[1] : "src";
+    const char banner[] = "/* Generated by tools/make_proportional_fonts.cpp - do not edit */\n\n";
+    std::string header = banner;
+    char line[256];
+    bool ok = true;
+
+    header += "#ifndef __PFONTS_H\n#define __PFONTS_H\n\n#include \"fonts.h\"\n\n"
+              "/* Proportional versions of the fonts in fonts.h - draw them with the\n"
+              "   sPFONT overloads of Paint::DrawStringAt */\n";
+
+    printf("%-14s %6s %6s %6s %6s %6s\n", "font", "glyphs", "sFONT", "sPFONT", "bitmap", "index");
+    for (const Font& font : fonts) {
+        const sFONT* source_font = font.font;
+        std::string source = banner;
+        std::string bitmaps;
+        std::string glyphs;
+        size_t offset = 0;
+        int rle_glyphs = 0;
+
+        source += "#include <pgmspace.h>\n#include \"pfonts.h\"\n";
+        for (char c = font.first; c <= font.last; c++) {
+            Glyph glyph = MakeGlyph(source_font, c - ' ');
+            snprintf(line, sizeof(line), "  /* '%s%c' */", c == '\\' ? "\\" : "", c);
+            bitmaps += line;
+            for (size_t i = 0; i < glyph.bytes.size(); i++) {
+                snprintf(line, sizeof(line), "%s0x%02X,", i % 16 == 0 ? "\n  " : " ", glyph.bytes[i]);
+                bitmaps += line;
+            }
+            bitmaps += "\n";
+
+            snprintf(line, sizeof(line), "  {%4u, %2d%s, %2d}, /* '%s%c' */\n", (unsigned)offset, glyph.width,
+                     glyph.rle ? " | PGLYPH_RLE" : "", glyph.advance, c == '\\' ? "\\" : "", c);
+            glyphs += line;
+            offset += glyph.bytes.size();
+            rle_glyphs += glyph.rle;
+        }
+        if (offset > 0xFFFF) {
+            fprintf(stderr, "%s: %u bytes of bitmaps do not fit a 16 bit offset\n", font.name, (unsigned)offset);
+            return 1;
+        }
+
+        source += "\nstatic const uint8_t " + std::string(font.name) + "_Bitmaps[] PROGMEM = {\n" + bitmaps + "};\n";
+        source += "\nstatic const sPGLYPH " + std::string(font.name) + "_Glyphs[] PROGMEM = {\n" + glyphs + "};\n";
+        snprintf(line, sizeof(line), "\nconst sPFONT %s = {\n  %s_Bitmaps,\n  %s_Glyphs,\n  '%c',\n  '%c',\n"
+                 "  %d, /* Height */\n};\n", font.name, font.name, font.name, font.first, font.last,
+                 source_font->Height);
+        source += line;
+
+        snprintf(line, sizeof(line), "\n/* %s, '%c' to '%c' */\nextern const sPFONT %s;\n", font.source_name,
+                 font.first, font.last, font.name);
+        header += line;
+
+        ok = WriteIfChanged(directory + "/" + font.file, source) && ok;
+
+        int count = font.last - font.first + 1;
+        size_t table = (size_t)count * source_font->Height * ((source_font->Width + 7) / 8) + sizeof(sFONT);
+        size_t index = count * sizeof(sPGLYPH);
+        printf("%-14s %6d %6u %6u %6u %6u  (%d of them run length encoded)\n", font.name, count, (unsigned)table,
+               (unsigned)(offset + index + sizeof(sPFONT)), (unsigned)offset, (unsigned)index, rle_glyphs);
+    }
+    header += "\n#endif /* __PFONTS_H */\n";
+
+    return WriteIfChanged(directory + "/pfonts.h", header) && ok ? 0 : 1;
+}
@@ -0,0 +1,151 @@
+/**
+ *  Writes src/fonts_rotated.h / src/fonts_rotated.cpp: every font in fonts.h
+ *  laid out for ROTATE_90, ROTATE_180 and ROTATE_270, so Paint draws a glyph
+ *  with one BitBlt instead of rotating it a pixel at a time (see
+ *  Paint::BlitCharAt). Each glyph is stored as it lands in the image - for
+ *  ROTATE_90 and ROTATE_270 that is Height pixels wide and Width rows tall -
+ *  with its rows padded to whole bytes.
+ *
+ *  Only the fonts a sketch names end up in the firmware (the linker drops
+ *  unused data), so all of them are generated.
+ *
+ *    g++ -O2 -std=gnu++11 -I tools/host -I src tools/make_rotated_fonts.cpp src/font[0-9]*.cpp -o /tmp/make_rotated_fonts
+ *    /tmp/make_rotated_fonts src
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "epdpaint.h"
+
+namespace {
+
+/* ' ' to '~', as in the font tables */
+const int glyph_count = 95;
+
+struct Font {
+    const char* name;
+    const sFONT* font;
+};
+
+const Font fonts[] = {
+    {"Font8", &Font8},
+    {"Font12", &Font12},
+    {"Font16", &Font16},
+    {"Font20", &Font20},
+    {"Font24", &Font24},
+};
+
+const char* rotation_names[] = {"ROTATE_0", "ROTATE_90", "ROTATE_180", "ROTATE_270"};
+
+bool FontPixel(const sFONT* font, int glyph, int i, int j) {
+    int stride = (font->Width + 7) / 8;
+    const uint8_t* row = font->table + (glyph * font->Height + j) * stride;
+    return (row[i / 8] >> (7 - i % 8)) & 1;
+}
+
+/* The glyph as it lands in the image at "rotate" - pixel (i, j) of the font goes
+   to (u, v) of the image glyph, the mapping of Paint::DrawPixel / MapRect */
+std::vector<uint8_t> RotateGlyph(const sFONT* font, int glyph, int rotate) {
+    int w = font->Width;
+    int h = font->Height;
+    bool turned = rotate == ROTATE_90 || rotate == ROTATE_270;
+    int image_width = turned ? h : w;
+    int image_height = turned ? w : h;
+    int stride = (image_width + 7) / 8;
+    std::vector<uint8_t> bytes(stride * image_height, 0);
+
+    for (int j = 0; j < h; j++) {
+        for (int i = 0; i < w; i++) {
+            if (!FontPixel(font, glyph, i, j)) {
+                continue;
+            }
+            int u = i, v = j;
+            if (rotate == ROTATE_90) {
+                u = h - 1 - j;
+                v = i;
+            } else if (rotate == ROTATE_180) {
+                u = w - 1 - i;
+                v = h - 1 - j;
+            } else if (rotate == ROTATE_270) {
+                u = j;
+                v = w - 1 - i;
+            }
+            bytes[v * stride + u / 8] |= 0x80 >> (u % 8);
+        }
+    }
+    return bytes;
+}
+
+bool WriteIfChanged(const std::string& path, const std::string& text) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file != NULL) {
+        std::string old;
+        char buffer[4096];
+        size_t n;
+        while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+            old.append(buffer, n);
+        }
+        fclose(file);
+        if (old == text) {
+            return true;
+        }
+    }
+
+    file = fopen(path.c_str(), "wb");
+    if (file == NULL) {
+        perror(path.c_str());
+        return false;
+    }
+    fwrite(text.data(), 1, text.size(), file);
+    fclose(file);
+    printf("wrote %s\n", path.c_str());
+    return true;
+}
+
+}
+
+int main(int argc, char** argv) {
+    std::string directory = argc > 1 ? argv[1] : "src";
+    const char banner[] = "/* Generated by tools/make_rotated_fonts.cpp - do not edit */\n\n";
+    std::string header = banner;
+    std::string source = banner;
+    char line[256];
+
+    header += "#ifndef __FONTS_ROTATED_H\n#define __FONTS_ROTATED_H\n\n#include \"fonts.h\"\n\n"
+              "/* Fonts laid out for one Paint rotation - use FontNN_RotateRR at that rotation and a glyph\n"
+              "   is a single BitBlt. At any other rotation they draw like FontNN */\n";
+    source += "#include <pgmspace.h>\n#include \"epdpaint.h\"\n#include \"fonts_rotated.h\"\n";
+
+    for (const Font& font : fonts) {
+        header += "\n";
+        for (int rotate = ROTATE_90; rotate <= ROTATE_270; rotate++) {
+            snprintf(line, sizeof(line), "%s_Rotate%d", font.name, rotate * 90);
+            std::string name = line;
+            header += "extern sFONT " + name + ";\n";
+
+            source += "\nstatic const uint8_t " + name + "_Table[] PROGMEM = {\n";
+            for (int glyph = 0; glyph < glyph_count; glyph++) {
+                std::vector<uint8_t> bytes = RotateGlyph(font.font, glyph, rotate);
+                snprintf(line, sizeof(line), "  /* '%s%c' */", glyph + ' ' == '\\' ? "\\" : "", glyph + ' ');
+                source += line;
+                for (size_t i = 0; i < bytes.size(); i++) {
+                    snprintf(line, sizeof(line), "%s0x%02X,", i % 16 == 0 ? "\n  " : " ", bytes[i]);
+                    source += line;
+                }
+                source += "\n";
+            }
+            snprintf(line, sizeof(line), "};\n\nsFONT %s = {\n  %s_Table,\n  %d, /* Width */\n  %d, /* Height */\n"
+                     "  %s,\n  &%s,\n};\n", name.c_str(), name.c_str(), font.font->Width, font.font->Height,
+                     rotation_names[rotate], font.name);
+            source += line;
+        }
+    }
+    header += "\n#endif /* __FONTS_ROTATED_H */\n";
+
+    return WriteIfChanged(directory + "/fonts_rotated.h", header) &&
+           WriteIfChanged(directory + "/fonts_rotated.cpp", source) ? 0 : 1;
+}
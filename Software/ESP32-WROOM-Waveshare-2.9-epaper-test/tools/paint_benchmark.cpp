@@ -0,0 +1,491 @@
+/**
+ *  Host benchmark for Paint (src/epdpaint.cpp) - pixels per second for each
+ *  primitive, next to the same drawing done a pixel at a time or through the
+ *  old pixel path, and checks that they all give the same image.
+ *
+ *    g++ -O2 -std=gnu++11 -I tools/host -I src tools/paint_benchmark.cpp src/epdpaint.cpp src/font[0-9]*.cpp \
+ *        src/fonts_rotated.cpp src/pfont*.cpp src/imagedata.cpp -o /tmp/paint_benchmark
+ *    /tmp/paint_benchmark
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+
+#include "epdpaint.h"
+#include "fonts_rotated.h"
+#include "imagedata.h"
+#include "pfonts.h"
+
+namespace {
+
+/* The whole 2.9" panel - 128x296, as in the demo's full frame */
+const int panel_width = 128;
+const int panel_height = 296;
+const int image_size = panel_width / 8 * panel_height;
+
+unsigned char image[image_size];
+unsigned char reference[image_size];
+
+/* Paint's pixel path as it was - a switch on the rotation and a second bounds check per pixel */
+namespace legacy {
+
+void DrawAbsolutePixel(unsigned char* image, int width, int height, int x, int y, int colored) {
+    if (x < 0 || x >= width || y < 0 || y >= height) {
+        return;
+    }
+    if (IF_INVERT_COLOR) {
+        if (colored) {
+            image[(x + y * width) / 8] |= 0x80 >> (x % 8);
+        } else {
+            image[(x + y * width) / 8] &= ~(0x80 >> (x % 8));
+        }
+    } else {
+        if (colored) {
+            image[(x + y * width) / 8] &= ~(0x80 >> (x % 8));
+        } else {
+            image[(x + y * width) / 8] |= 0x80 >> (x % 8);
+        }
+    }
+}
+
+/* out of line, as Paint::DrawPixel was */
+__attribute__((noinline))
+void DrawPixel(unsigned char* image, int width, int height, int rotate, int x, int y, int colored) {
+    int point_temp;
+    if (rotate == ROTATE_0) {
+        if(x < 0 || x >= width || y < 0 || y >= height) {
+            return;
+        }
+        DrawAbsolutePixel(image, width, height, x, y, colored);
+    } else if (rotate == ROTATE_90) {
+        if(x < 0 || x >= height || y < 0 || y >= width) {
+          return;
+        }
+        point_temp = x;
+        x = width - y;
+        y = point_temp;
+        DrawAbsolutePixel(image, width, height, x, y, colored);
+    } else if (rotate == ROTATE_180) {
+        if(x < 0 || x >= width || y < 0 || y >= height) {
+          return;
+        }
+        x = width - x;
+        y = height - y;
+        DrawAbsolutePixel(image, width, height, x, y, colored);
+    } else if (rotate == ROTATE_270) {
+        if(x < 0 || x >= height || y < 0 || y >= width) {
+          return;
+        }
+        point_temp = x;
+        x = y;
+        y = height - point_temp;
+        DrawAbsolutePixel(image, width, height, x, y, colored);
+    }
+}
+
+void DrawCharAt(unsigned char* image, int width, int height, int rotate, int x, int y, char ascii_char, sFONT* font, int colored) {
+    int i, j;
+    unsigned int char_offset = (ascii_char - ' ') * font->Height * (font->Width / 8 + (font->Width % 8 ? 1 : 0));
+    const unsigned char* ptr = &font->table[char_offset];
+
+    for (j = 0; j < font->Height; j++) {
+        for (i = 0; i < font->Width; i++) {
+            if (pgm_read_byte(ptr) & (0x80 >> (i % 8))) {
+                DrawPixel(image, width, height, rotate, x + i, y + j, colored);
+            }
+            if (i % 8 == 7) {
+                ptr++;
+            }
+        }
+        if (font->Width % 8 != 0) {
+            ptr++;
+        }
+    }
+}
+
+void DrawStringAt(unsigned char* image, int width, int height, int rotate, int x, int y, const char* text, sFONT* font, int colored) {
+    for (; *text != 0; text++, x += font->Width) {
+        DrawCharAt(image, width, height, rotate, x, y, *text, font, colored);
+    }
+}
+
+void DrawLine(unsigned char* image, int width, int height, int rotate, int x0, int y0, int x1, int y1, int colored) {
+    int dx = x1 - x0 >= 0 ? x1 - x0 : x0 - x1;
+    int sx = x0 < x1 ? 1 : -1;
+    int dy = y1 - y0 <= 0 ? y1 - y0 : y0 - y1;
+    int sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+
+    while((x0 != x1) && (y0 != y1)) {
+        DrawPixel(image, width, height, rotate, x0, y0 , colored);
+        if (2 * err >= dy) {
+            err += dy;
+            x0 += sx;
+        }
+        if (2 * err <= dx) {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+void DrawCircle(unsigned char* image, int width, int height, int rotate, int x, int y, int radius, int colored) {
+    int x_pos = -radius;
+    int y_pos = 0;
+    int err = 2 - 2 * radius;
+    int e2;
+
+    do {
+        DrawPixel(image, width, height, rotate, x - x_pos, y + y_pos, colored);
+        DrawPixel(image, width, height, rotate, x + x_pos, y + y_pos, colored);
+        DrawPixel(image, width, height, rotate, x + x_pos, y - y_pos, colored);
+        DrawPixel(image, width, height, rotate, x - x_pos, y - y_pos, colored);
+        e2 = err;
+        if (e2 <= y_pos) {
+            err += ++y_pos * 2 + 1;
+            if(-x_pos == y_pos && e2 <= x_pos) {
+              e2 = 0;
+            }
+        }
+        if (e2 > x_pos) {
+            err += ++x_pos * 2 + 1;
+        }
+    } while (x_pos <= 0);
+}
+
+}
+
+double SecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/* Runs "draw" until at least 0.2s has passed - returns the seconds per call */
+template<typename Draw>
+double Time(Draw draw) {
+    long calls = 0;
+    auto start = std::chrono::steady_clock::now();
+    double seconds;
+    do {
+        for (int i = 0; i < 16; i++) {
+            draw();
+        }
+        calls += 16;
+        seconds = SecondsSince(start);
+    } while (seconds < 0.2);
+    return seconds / calls;
+}
+
+void Report(const char* name, long pixels, double seconds, double reference_seconds) {
+    printf("%-28s %10.3f us %8.1f Mpixel/s", name, seconds * 1e6, pixels / seconds / 1e6);
+    if (reference_seconds > 0) {
+        printf("   baseline %10.3f us  x%.1f", reference_seconds * 1e6, reference_seconds / seconds);
+    }
+    printf("\n");
+}
+
+/* Text (plain and pre-rotated fonts), lines and circles at every rotation, partly off the image - they must
+   match the old pixel path exactly */
+bool CheckRotations() {
+    Paint paint(image, panel_width, panel_height);
+    const char text[] = "12:34 Hello world! ~";
+    sFONT* fonts[] = {&Font8, &Font12, &Font16, &Font20, &Font24};
+    sFONT* rotated_fonts[][3] = {
+        {&Font8_Rotate90, &Font8_Rotate180, &Font8_Rotate270},
+        {&Font12_Rotate90, &Font12_Rotate180, &Font12_Rotate270},
+        {&Font16_Rotate90, &Font16_Rotate180, &Font16_Rotate270},
+        {&Font20_Rotate90, &Font20_Rotate180, &Font20_Rotate270},
+        {&Font24_Rotate90, &Font24_Rotate180, &Font24_Rotate270},
+    };
+
+    for (int rotate = ROTATE_0; rotate <= ROTATE_270; rotate++) {
+        paint.SetRotate(rotate);
+        paint.Clear(0);
+        memset(reference, 0, image_size);
+
+        for (int f = 0; f < 5; f++) {
+            paint.DrawStringAt(-7, f * 60 - 10, text, fonts[f], 1);
+            legacy::DrawStringAt(reference, panel_width, panel_height, rotate, -7, f * 60 - 10, text, fonts[f], 1);
+            /* every pre-rotated font, at its own rotation (blitted) and the others (drawn from the plain table) */
+            for (int r = 0; r < 3; r++) {
+                paint.DrawStringAt(-3 + 40 * r, f * 60 + 20, "Ag~", rotated_fonts[f][r], 1);
+                paint.DrawStringAt(-3 + 40 * r, f * 60 + 20, "Ag~", rotated_fonts[f][r], 0);
+                legacy::DrawStringAt(reference, panel_width, panel_height, rotate, -3 + 40 * r, f * 60 + 20, "Ag~", fonts[f], 1);
+                legacy::DrawStringAt(reference, panel_width, panel_height, rotate, -3 + 40 * r, f * 60 + 20, "Ag~", fonts[f], 0);
+            }
+            paint.DrawStringAt(200, f * 60 + 90, "12:34", rotated_fonts[f][0], 1);
+            legacy::DrawStringAt(reference, panel_width, panel_height, rotate, 200, f * 60 + 90, "12:34", fonts[f], 1);
+        }
+        for (int x = -20; x < 320; x += 7) {
+            paint.DrawCircle(x, x / 2, 25, x & 1);
+            legacy::DrawCircle(reference, panel_width, panel_height, rotate, x, x / 2, 25, x & 1);
+            paint.DrawLine(0, 300 - x, x, 0, 1);
+            legacy::DrawLine(reference, panel_width, panel_height, rotate, 0, 300 - x, x, 0, 1);
+        }
+        if (memcmp(image, reference, image_size) != 0) {
+            printf("drawing at rotation %d differs from the old pixel path\n", rotate);
+            return false;
+        }
+    }
+    return true;
+}
+
+int GetBit(const unsigned char* bitmap, int stride, int x, int y) {
+    return (bitmap[y * stride + x / 8] >> (7 - x % 8)) & 1;
+}
+
+/* BitBlt a bit at a time, to compare with */
+void PixelBlt(unsigned char* target, int width, int height, int x, int y, const unsigned char* source, int source_width,
+              int source_x, int source_y, int w, int h, int rop) {
+    for (int j = 0; j < h; j++) {
+        for (int i = 0; i < w; i++) {
+            int tx = x + i;
+            int ty = y + j;
+            if (tx < 0 || ty < 0 || tx >= width || ty >= height) {
+                continue;
+            }
+            int d = GetBit(target, width / 8, tx, ty);
+            int s = GetBit(source, (source_width + 7) / 8, source_x + i, source_y + j);
+            int r = rop == BLT_OR ? (d | s) : rop == BLT_AND ? (d & s) : rop == BLT_XOR ? (d ^ s) : rop == BLT_NOT ? !s : s;
+            unsigned char bit = 0x80 >> (tx % 8);
+            target[ty * (width / 8) + tx / 8] = r ? (target[ty * (width / 8) + tx / 8] | bit) : (target[ty * (width / 8) + tx / 8] & ~bit);
+        }
+    }
+}
+
+/* Random blits of IMAGE_DATA (any alignment, partly off the image) with every raster operation */
+bool CheckBitBlt() {
+    Paint paint(image, panel_width, panel_height);
+    srand(2);
+    for (int i = 0; i < image_size; i++) {
+        image[i] = reference[i] = rand();
+    }
+
+    for (int i = 0; i < 5000; i++) {
+        int w = rand() % 90 + 1;
+        int h = rand() % 60 + 1;
+        int source_x = rand() % (panel_width - w + 1);
+        int source_y = rand() % (panel_height - h + 1);
+        int x = rand() % 180 - 30;
+        int y = rand() % 340 - 30;
+        int rop = rand() % 5;
+        paint.BitBlt(x, y, IMAGE_DATA, panel_width, source_x, source_y, w, h, rop);
+        PixelBlt(reference, panel_width, panel_height, x, y, IMAGE_DATA, panel_width, source_x, source_y, w, h, rop);
+        if (memcmp(image, reference, image_size) != 0) {
+            printf("BitBlt(%d, %d, %d, %d, %d, %d, rop %d) differs from a bit at a time\n", x, y, source_x, source_y, w, h, rop);
+            return false;
+        }
+    }
+    return true;
+}
+
+/* The same rectangle drawn with DrawPixel, to compare with */
+void PixelRect(Paint& paint, int x, int y, int w, int h, int colored) {
+    for (int j = y; j < y + h; j++) {
+        for (int i = x; i < x + w; i++) {
+            paint.DrawPixel(i, j, colored);
+        }
+    }
+}
+
+/* A proportional glyph drawn with DrawPixel straight from the monospace font it was made from - the glyph starts
+   at its font's first non-blank column */
+int PixelCharAt(Paint& paint, int x, int y, char c, const sPFONT* pfont, const sFONT* font, int colored) {
+    if (c < pfont->First || c > pfont->Last) {
+        return 0;
+    }
+    int stride = (font->Width + 7) / 8;
+    const unsigned char* glyph = font->table + (c - ' ') * font->Height * stride;
+    int left = font->Width;
+    for (int j = 0; j < font->Height; j++) {
+        for (int i = 0; i < left; i++) {
+            if (GetBit(glyph, stride, i, j)) {
+                left = i;
+            }
+        }
+    }
+    for (int j = 0; j < font->Height; j++) {
+        for (int i = left; i < font->Width; i++) {
+            if (GetBit(glyph, stride, i, j)) {
+                paint.DrawPixel(x + i - left, y + j, colored);
+            }
+        }
+    }
+    return pfont->glyphs[c - pfont->First].Advance;
+}
+
+/* Every proportional font at every rotation, partly off the image - it must match its monospace font drawn a pixel
+   at a time, and StringWidth must agree with DrawStringAt */
+bool CheckProportional() {
+    Paint paint(image, panel_width, panel_height);
+    Paint pixels(reference, panel_width, panel_height);
+    const char text[] = "12:34 Hello world! ~";
+    const sPFONT* pfonts[] = {&PFont8, &PFont12, &PFont16, &PFont20, &PFont24, &PFont24Digits};
+    const sFONT* fonts[] = {&Font8, &Font12, &Font16, &Font20, &Font24, &Font24};
+
+    for (int rotate = ROTATE_0; rotate <= ROTATE_270; rotate++) {
+        paint.SetRotate(rotate);
+        pixels.SetRotate(rotate);
+        paint.Clear(0);
+        pixels.Clear(0);
+
+        for (int f = 0; f < 6; f++) {
+            for (int colored = 1; colored >= 0; colored--) {
+                int width = paint.DrawStringAt(-5, f * 50 - 10, text, pfonts[f], colored);
+                int x = -5;
+                for (const char* c = text; *c != 0; c++) {
+                    x += PixelCharAt(pixels, x, f * 50 - 10, *c, pfonts[f], fonts[f], colored);
+                }
+                if (width != x + 5 || width != Paint::StringWidth(text, pfonts[f])) {
+                    printf("proportional font %d: string width %d, expected %d\n", f, width, x + 5);
+                    return false;
+                }
+                paint.DrawStringAt(30, f * 50 + 20, "0123456789", pfonts[f], colored);
+                x = 30;
+                for (const char* c = "0123456789"; *c != 0; c++) {
+                    x += PixelCharAt(pixels, x, f * 50 + 20, *c, pfonts[f], fonts[f], colored);
+                }
+            }
+            paint.DrawStringAt(40, f * 50, "#@&$", pfonts[f], 1);
+            int x = 40;
+            for (const char* c = "#@&$"; *c != 0; c++) {
+                x += PixelCharAt(pixels, x, f * 50, *c, pfonts[f], fonts[f], 1);
+            }
+        }
+        if (memcmp(image, reference, image_size) != 0) {
+            printf("proportional text at rotation %d differs from DrawPixel\n", rotate);
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Random rectangles (many partly off the image) at every rotation - the fills must match DrawPixel exactly */
+bool CheckFills() {
+    Paint paint(image, panel_width, panel_height);
+    Paint pixels(reference, panel_width, panel_height);
+    srand(1);
+
+    for (int rotate = ROTATE_0; rotate <= ROTATE_270; rotate++) {
+        paint.SetRotate(rotate);
+        pixels.SetRotate(rotate);
+        paint.Clear(0);
+        pixels.Clear(0);
+
+        for (int i = 0; i < 2000; i++) {
+            int x = rand() % 340 - 20;
+            int y = rand() % 340 - 20;
+            int w = rand() % 80 - 5;
+            int h = rand() % 80 - 5;
+            int colored = rand() % 2;
+            paint.FillRect(x, y, w, h, colored);
+            PixelRect(pixels, x, y, w, h, colored);
+            if (memcmp(image, reference, image_size) != 0) {
+                printf("FillRect(%d, %d, %d, %d) at rotation %d differs from DrawPixel\n", x, y, w, h, rotate);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+}
+
+int main() {
+    if (!CheckFills() || !CheckRotations() || !CheckBitBlt() || !CheckProportional()) {
+        return 1;
+    }
+
+    Paint paint(image, panel_width, panel_height);
+    const long frame = (long)panel_width * panel_height;
+
+    printf("%dx%d image - baseline is the same drawing with DrawPixel\n", panel_width, panel_height);
+
+    double seconds = Time([&] { paint.Clear(1); });
+    double pixel_seconds = Time([&] { PixelRect(paint, 0, 0, panel_width, panel_height, 1); });
+    Report("Clear", frame, seconds, pixel_seconds);
+
+    for (int rotate = ROTATE_0; rotate <= ROTATE_90; rotate++) {
+        const char* suffix = rotate == ROTATE_0 ? "ROTATE_0" : "ROTATE_90";
+        char name[64];
+        paint.SetRotate(rotate);
+
+        snprintf(name, sizeof(name), "DrawHorizontalLine %s", suffix);
+        seconds = Time([&] { paint.DrawHorizontalLine(3, 40, 120, 1); });
+        pixel_seconds = Time([&] { PixelRect(paint, 3, 40, 120, 1, 1); });
+        Report(name, 120, seconds, pixel_seconds);
+
+        snprintf(name, sizeof(name), "DrawVerticalLine %s", suffix);
+        seconds = Time([&] { paint.DrawVerticalLine(40, 3, 120, 1); });
+        pixel_seconds = Time([&] { PixelRect(paint, 40, 3, 1, 120, 1); });
+        Report(name, 120, seconds, pixel_seconds);
+
+        snprintf(name, sizeof(name), "DrawFilledRectangle %s", suffix);
+        seconds = Time([&] { paint.DrawFilledRectangle(5, 7, 104, 90, 1); });
+        pixel_seconds = Time([&] { PixelRect(paint, 5, 7, 100, 84, 1); });
+        Report(name, 100 * 84, seconds, pixel_seconds);
+    }
+
+    /* A 32x32 icon at an odd position, and the whole of IMAGE_DATA shifted off the byte grid */
+    printf("\nBitBlt from IMAGE_DATA - baseline is a bit at a time\n");
+    seconds = Time([&] { paint.BitBlt(13, 50, IMAGE_DATA, panel_width, 40, 100, 32, 32, BLT_OR); });
+    pixel_seconds = Time([&] { PixelBlt(image, panel_width, panel_height, 13, 50, IMAGE_DATA, panel_width, 40, 100, 32, 32, BLT_OR); });
+    Report("BitBlt 32x32 OR at x=13", 32 * 32, seconds, pixel_seconds);
+    seconds = Time([&] { paint.BitBlt(0, 0, IMAGE_DATA, panel_width, 0, 0, panel_width, panel_height, BLT_COPY); });
+    pixel_seconds = Time([&] { PixelBlt(image, panel_width, panel_height, 0, 0, IMAGE_DATA, panel_width, 0, 0, panel_width, panel_height, BLT_COPY); });
+    Report("BitBlt frame COPY at x=0", frame, seconds, pixel_seconds);
+    seconds = Time([&] { paint.BitBlt(3, 0, IMAGE_DATA, panel_width, 0, 0, panel_width, panel_height, BLT_XOR); });
+    pixel_seconds = Time([&] { PixelBlt(image, panel_width, panel_height, 3, 0, IMAGE_DATA, panel_width, 0, 0, panel_width, panel_height, BLT_XOR); });
+    Report("BitBlt frame XOR at x=3", frame - 3 * panel_height, seconds, pixel_seconds);
+
+    /* Per pixel: the old path against the runtime-rotation dispatch and a PaintRotated used directly */
+    const int pixel_count = 4096;
+    /* a runtime value, as on the board - otherwise the old path is folded down to one rotation here */
+    volatile int rotate_setting = ROTATE_90;
+    int rotate = rotate_setting;
+    paint.SetRotate(rotate);
+    PaintRotated<ROTATE_90> rotated(image, panel_width, panel_height);
+    printf("\nDrawPixel at ROTATE_90, %d pixels - baseline is the old pixel path\n", pixel_count);
+    double legacy_seconds = Time([&] {
+        for (int i = 0; i < pixel_count; i++) {
+            legacy::DrawPixel(image, panel_width, panel_height, rotate, i % 296, i % 128, i & 1);
+        }
+    });
+    seconds = Time([&] {
+        for (int i = 0; i < pixel_count; i++) {
+            paint.DrawPixel(i % 296, i % 128, i & 1);
+        }
+    });
+    Report("Paint::DrawPixel", pixel_count, seconds, legacy_seconds);
+    seconds = Time([&] {
+        for (int i = 0; i < pixel_count; i++) {
+            rotated.DrawPixel(i % 296, i % 128, i & 1);
+        }
+    });
+    Report("PaintRotated::DrawPixel", pixel_count, seconds, legacy_seconds);
+
+    /* The clock demo's string */
+    const char clock[] = "12:34";
+    const long clock_pixels = 5L * Font24.Width * Font24.Height;
+    printf("\nDrawStringAt(\"%s\", Font24) at ROTATE_90, %ld font pixels - baseline is the old pixel path\n", clock, clock_pixels);
+    legacy_seconds = Time([&] { legacy::DrawStringAt(image, panel_width, panel_height, rotate, 0, 4, clock, &Font24, 1); });
+    seconds = Time([&] { paint.DrawStringAt(0, 4, clock, &Font24, 1); });
+    Report("DrawStringAt Font24", clock_pixels, seconds, legacy_seconds);
+    seconds = Time([&] { paint.DrawStringAt(0, 4, clock, &Font24_Rotate90, 1); });
+    Report("DrawStringAt Font24_Rotate90", clock_pixels, seconds, legacy_seconds);
+    seconds = Time([&] { paint.DrawStringAt(0, 4, clock, &PFont24Digits, 1); });
+    Report("DrawStringAt PFont24Digits", clock_pixels, seconds, legacy_seconds);
+
+    const char hello[] = "Hello world!";
+    const long hello_pixels = 12L * Font12.Width * Font12.Height;
+    paint.SetRotate(ROTATE_0);
+    printf("\nDrawStringAt(\"%s\", Font12) at ROTATE_0, %ld font pixels - baseline is the old pixel path\n", hello, hello_pixels);
+    legacy_seconds = Time([&] { legacy::DrawStringAt(image, panel_width, panel_height, rotate_setting - ROTATE_90, 0, 4, hello, &Font12, 1); });
+    seconds = Time([&] { paint.DrawStringAt(0, 4, hello, &Font12, 1); });
+    Report("DrawStringAt Font12", hello_pixels, seconds, legacy_seconds);
+    seconds = Time([&] { paint.DrawStringAt(0, 4, hello, &PFont12, 1); });
+    Report("DrawStringAt PFont12", hello_pixels, seconds, legacy_seconds);
+    return 0;
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+/// ST7789 driver that keeps a running count of the bytes it sends over SPI and the pixels it writes - used to measure
+/// how much each screen refresh actually costs. Only the Adafruit_GFX drawing entry points are counted (not init / raw
+/// commands).
+/// It also adds the hardware scrolling commands that the Adafruit driver does not expose.
+///
+/// Each primitive is one address window (CASET + 4 bytes, RASET + 4 bytes, RAMWR = 11 bytes) followed by 2 bytes per
+/// pixel, after clipping to the screen.
+///
+/// Shared by the PZEM and TFT test projects through lib_extra_dirs = ../lib in their platformio.ini.
+
+#include <Adafruit_ST7789.h>
+
+class CountingST7789 : public Adafruit_ST7789
+{
+public:
+  static const uint32_t addressWindowBytes = 11;
+
+  CountingST7789(SPIClass *spiClass, int8_t cs, int8_t dc, int8_t rst) : Adafruit_ST7789(spiClass, cs, dc, rst) {}
+
+  uint32_t spiBytes() const { return bytes; }
+  uint32_t pixelsWritten() const { return pixels; }
+  uint32_t addressWindows() const { return windows; }
+  void resetCounters() { bytes = 0; pixels = 0; windows = 0; }
+
+  /// For code that streams pixels itself (setAddrWindow() + writePixels())
+  void countPixels(uint32_t count) { bytes += addressWindowBytes + 2 * count; pixels += count; windows += 1; }
+
+  /// Hardware vertical scrolling (VSCRDEF / VSCRSADD). These address the panel's 320 rows of frame memory - with the
+  /// row / column exchange of rotations 1 and 3 those run along the screen's x axis, at memory row x + xOffset()
+  void setScrollArea(uint16_t top, uint16_t area, uint16_t bottom)
+  {
+    uint8_t data[] = { (uint8_t)(top >> 8), (uint8_t)top, (uint8_t)(area >> 8), (uint8_t)area, (uint8_t)(bottom >> 8), (uint8_t)bottom };
+    sendCommand(ST77XX_VSCRDEF, data, sizeof(data));
+    bytes += 1 + sizeof(data);
+  }
+
+  void setScrollStart(uint16_t row)
+  {
+    uint8_t data[] = { (uint8_t)(row >> 8), (uint8_t)row };
+    sendCommand(ST77XX_VSCRSADD, data, sizeof(data));
+    bytes += 1 + sizeof(data);
+  }
+
+  /// No scrolling - frame memory row n is shown on display line n again
+  void resetScroll()
+  {
+    setScrollArea(0, frameMemoryRows, 0);
+    setScrollStart(0);
+  }
+
+  int16_t xOffset() const { return _xstart; }
+
+  static const uint16_t frameMemoryRows = 320;
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override { countRect(x, y, 1, 1); Adafruit_ST7789::drawPixel(x, y, color); }
+  void writePixel(int16_t x, int16_t y, uint16_t color) override { countRect(x, y, 1, 1); Adafruit_ST7789::writePixel(x, y, color); }
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override
+  {
+    countRect(x, y, w, h);
+    Adafruit_ST7789::fillRect(x, y, w, h, color);
+  }
+
+  void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override
+  {
+    countRect(x, y, w, h);
+    Adafruit_ST7789::writeFillRect(x, y, w, h, color);
+  }
+
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override { countRect(x, y, w, 1); Adafruit_ST7789::drawFastHLine(x, y, w, color); }
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override { countRect(x, y, 1, h); Adafruit_ST7789::drawFastVLine(x, y, h, color); }
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override { countRect(x, y, w, 1); Adafruit_ST7789::writeFastHLine(x, y, w, color); }
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override { countRect(x, y, 1, h); Adafruit_ST7789::writeFastVLine(x, y, h, color); }
+
+private:
+  uint32_t bytes = 0;
+  uint32_t pixels = 0;
+  uint32_t windows = 0;
+
+  void countRect(int32_t x, int32_t y, int32_t w, int32_t h)
+  {
+    if(w < 0) { x += w + 1; w = -w; }
+    if(h < 0) { y += h + 1; h = -h; }
+
+    int32_t x1 = min<int32_t>(x + w, width());
+    int32_t y1 = min<int32_t>(y + h, height());
+    x = max<int32_t>(x, 0);
+    y = max<int32_t>(y, 0);
+
+    if(x1 > x && y1 > y)
+      countPixels((x1 - x) * (y1 - y));
+  }
+};